@@ -587,6 +587,33 @@ GROUP_BY_BENCHMARK(MinMaxLongStringsGroupedByMediumInt, [&] {
   BenchmarkAggregate(state, {{"hash_min_max", ""}}, {input}, {int_key});
 });
 
+// Several aggregates over the same column
+
+GROUP_BY_BENCHMARK(SumMinMaxCountMeanDoublesGroupedByMediumInt, [&] {
+  auto input = rng.Float64(args.size,
+                           /*min=*/0.0,
+                           /*max=*/1.0e14,
+                           /*null_probability=*/args.null_proportion);
+  auto int_key = rng.Int64(args.size, /*min=*/0, /*max=*/63);
+
+  BenchmarkAggregate(state,
+                     {{"hash_sum", ""},
+                      {"hash_min_max", ""},
+                      {"hash_count", ""},
+                      {"hash_mean", ""}},
+                     {input, input, input, input}, {int_key});
+});
+
+GROUP_BY_BENCHMARK(SumMinMaxCountMeanDoublesScalar, [&] {
+  auto input = rng.Float64(args.size,
+                           /*min=*/0.0,
+                           /*max=*/1.0e14,
+                           /*null_probability=*/args.null_proportion);
+
+  BenchmarkAggregate(state, {{"sum", ""}, {"min_max", ""}, {"count", ""}, {"mean", ""}},
+                     {input, input, input, input}, {});
+});
+
 //
 // Sum
 //
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <forward_list>
 #include <mutex>
 #include <sstream>
@@ -142,6 +143,38 @@ Status HandleSegments(RowSegmenter* segmenter, const ExecBatch& batch,
   return Status::OK();
 }
 
+// Blocks of rows small enough for all the columns an aggregation reads to stay in
+// cache while every kernel consumes them.
+constexpr int64_t kAggregateBlockLength = 1 << 14;
+
+// Run the given handler on consecutive blocks of a batch.  Consuming a large batch
+// one kernel at a time would stream each column through memory again for every
+// aggregate over it, visiting all kernels block by block reads it only once.  The
+// null count of each block is computed up front, so that kernels sharing a column
+// don't all scan its validity bitmap.
+template <typename BlockHandler>
+Status HandleBlocks(const ExecSpan& batch, const BlockHandler& handle_block) {
+  if (batch.length <= kAggregateBlockLength) {
+    return handle_block(batch);
+  }
+  ExecSpan block = batch;
+  for (int64_t offset = 0; offset < batch.length; offset += kAggregateBlockLength) {
+    block.length = std::min(kAggregateBlockLength, batch.length - offset);
+    for (size_t i = 0; i < block.values.size(); ++i) {
+      if (block.values[i].is_array()) {
+        // Start over from the batch's span: the null count of the previous block
+        // must not carry over to this one
+        ArraySpan& span = block.values[i].array;
+        span = batch.values[i].array;
+        span.SetSlice(batch.values[i].array.offset + offset, block.length);
+        span.GetNullCount();
+      }
+    }
+    ARROW_RETURN_NOT_OK(handle_block(block));
+  }
+  return Status::OK();
+}
+
 /// @brief Extract values of segment keys from a segment batch
 /// @param[out] values_ptr Vector to store the extracted segment key values
 /// @param[in] input_batch Segment batch. Must have the a constant value for segment key
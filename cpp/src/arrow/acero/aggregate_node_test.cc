@@ -23,11 +23,13 @@
 #include <memory>
 
 #include "arrow/acero/test_util_internal.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/test_util_internal.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/string.h"
 
@@ -116,6 +118,80 @@ TEST(GroupByConvenienceFunc, Basic) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST(GroupByConvenienceFunc, LargeBatch) {
+  // Batches longer than the aggregation block length are consumed block by block,
+  // which must give the same results as the same rows in small batches
+  constexpr int64_t kLength = 100000;
+  random::RandomArrayGenerator rng(42);
+  auto in_schema = schema({field("key", int32()), field("value", int64())});
+  auto large = Table::Make(in_schema, {rng.Int32(kLength, 0, 9),
+                                       rng.Int64(kLength, -1000, 1000,
+                                                 /*null_probability=*/0.1)});
+  TableBatchReader reader(*large);
+  reader.set_chunksize(1000);
+  ASSERT_OK_AND_ASSIGN(auto small, reader.ToTable());
+  ASSERT_GT(small->column(0)->num_chunks(), 1);
+
+  for (bool grouped : {false, true}) {
+    ARROW_SCOPED_TRACE("grouped = ", grouped);
+    const std::string prefix = grouped ? "hash_" : "";
+    std::vector<FieldRef> keys;
+    if (grouped) {
+      keys.emplace_back("key");
+    }
+    std::vector<Aggregate> aggregates = {{prefix + "sum", {"value"}, "sum"},
+                                         {prefix + "min_max", {"value"}, "min_max"},
+                                         {prefix + "count", {"value"}, "count"},
+                                         {prefix + "mean", {"value"}, "mean"}};
+    ASSERT_OK_AND_ASSIGN(auto expected, TableGroupBy(small, aggregates, keys));
+    ASSERT_OK_AND_ASSIGN(auto actual, TableGroupBy(large, aggregates, keys));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(GroupByConvenienceFunc, LargeBatchNullsAfterFirstBlock) {
+  // The first blocks have no nulls, which must not be assumed of the later ones
+  constexpr int64_t kLength = 40000;
+  constexpr int64_t kNumLeadingValid = 20000;
+  Int32Builder key_builder;
+  Int64Builder value_builder;
+  for (int64_t i = 0; i < kLength; ++i) {
+    ASSERT_OK(key_builder.Append(static_cast<int32_t>(i % 3)));
+    if (i >= kNumLeadingValid && i % 2 == 1) {
+      ASSERT_OK(value_builder.AppendNull());
+    } else {
+      ASSERT_OK(value_builder.Append(i));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto keys_array, key_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto values_array, value_builder.Finish());
+  auto in_schema = schema({field("key", int32()), field("value", int64())});
+  auto large = Table::Make(in_schema, {keys_array, values_array});
+  TableBatchReader reader(*large);
+  reader.set_chunksize(1000);
+  ASSERT_OK_AND_ASSIGN(auto small, reader.ToTable());
+
+  ASSERT_OK_AND_ASSIGN(
+      auto counted, TableGroupBy(large, {{"count", {"value"}, "count"}}, /*keys=*/{}));
+  AssertTablesEqual(*TableFromJSON(schema({field("count", int64())}), {"[[30000]]"}),
+                    *counted, /*same_chunk_layout=*/false);
+
+  for (bool grouped : {false, true}) {
+    ARROW_SCOPED_TRACE("grouped = ", grouped);
+    const std::string prefix = grouped ? "hash_" : "";
+    std::vector<FieldRef> keys;
+    if (grouped) {
+      keys.emplace_back("key");
+    }
+    std::vector<Aggregate> aggregates = {{prefix + "sum", {"value"}, "sum"},
+                                         {prefix + "count", {"value"}, "count"},
+                                         {prefix + "mean", {"value"}, "mean"}};
+    ASSERT_OK_AND_ASSIGN(auto expected, TableGroupBy(small, aggregates, keys));
+    ASSERT_OK_AND_ASSIGN(auto actual, TableGroupBy(large, aggregates, keys));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(GroupByConvenienceFunc, Invalid) {
   std::shared_ptr<Schema> in_schema =
       schema({field("key1", utf8()), field("key2", int32()), field("value", int32())});
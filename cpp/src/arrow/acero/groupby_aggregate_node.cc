@@ -227,29 +227,37 @@ Status GroupByNode::Consume(ExecSpan batch) {
   // Create a batch with group ids
   ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
 
-  // Execute aggregate kernels
+  auto ctx = plan_->query_context()->exec_context();
   for (size_t i = 0; i < agg_kernels_.size(); ++i) {
-    arrow::util::tracing::Span span;
-    START_COMPUTE_SPAN(span, aggs_[i].function,
-                       {{"function.name", aggs_[i].function},
-                        {"function.options",
-                         aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
-                        {"function.kind", std::string(kind_name()) + "::Consume"}});
-    auto ctx = plan_->query_context()->exec_context();
     KernelContext kernel_ctx{ctx};
     kernel_ctx.SetState(state->agg_states[i].get());
-
-    std::vector<ExecValue> column_values;
-    for (const int field : agg_src_fieldsets_[i]) {
-      column_values.push_back(batch[field]);
-    }
-    column_values.emplace_back(*id_batch.array());
-    ExecSpan agg_batch(std::move(column_values), batch.length);
     RETURN_NOT_OK(agg_kernels_[i]->resize(&kernel_ctx, state->grouper->num_groups()));
-    RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
   }
 
-  return Status::OK();
+  // Execute aggregate kernels, the group ids are appended after the input columns
+  const int id_field = static_cast<int>(batch.values.size());
+  batch.values.emplace_back(*id_batch.array());
+  return HandleBlocks(batch, [&](const ExecSpan& block) -> Status {
+    for (size_t i = 0; i < agg_kernels_.size(); ++i) {
+      arrow::util::tracing::Span span;
+      START_COMPUTE_SPAN(span, aggs_[i].function,
+                         {{"function.name", aggs_[i].function},
+                          {"function.options",
+                           aggs_[i].options ? aggs_[i].options->ToString() : "<NULLPTR>"},
+                          {"function.kind", std::string(kind_name()) + "::Consume"}});
+      KernelContext kernel_ctx{ctx};
+      kernel_ctx.SetState(state->agg_states[i].get());
+
+      std::vector<ExecValue> column_values;
+      for (const int field : agg_src_fieldsets_[i]) {
+        column_values.push_back(block[field]);
+      }
+      column_values.push_back(block[id_field]);
+      ExecSpan agg_batch(std::move(column_values), block.length);
+      RETURN_NOT_OK(agg_kernels_[i]->consume(&kernel_ctx, agg_batch));
+    }
+    return Status::OK();
+  });
 }
 
 Status GroupByNode::Merge() {
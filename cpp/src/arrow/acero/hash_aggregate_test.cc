@@ -882,6 +882,47 @@ TEST_P(GroupBy, SumOnly) {
   }
 }
 
+TEST_P(GroupBy, RunEndEncodedArgument) {
+  auto table =
+      TableFromJSON(schema({field("argument", int64()), field("key", int64())}), {R"([
+    [1,    1],
+    [1,    2],
+    [1,    1]
+  ])",
+                                                                                  R"([
+    [null, 3],
+    [null, 1],
+    [5,    2],
+    [5,    null],
+    [-2,   2],
+    [7,    1],
+    [7,    3]
+  ])"});
+  ASSERT_OK_AND_ASSIGN(auto encoded_table, RunEndEncodeTableColumns(*table, {0}));
+
+  const std::vector<TestAggregate> aggregates = {
+      {"hash_sum", nullptr},  {"hash_product", nullptr}, {"hash_mean", nullptr},
+      {"hash_min", nullptr},  {"hash_max", nullptr},     {"hash_min_max", nullptr},
+      {"hash_count", nullptr}};
+  const std::vector<Datum> arguments(aggregates.size(),
+                                     table->GetColumnByName("argument"));
+  const std::vector<Datum> encoded_arguments(
+      aggregates.size(), encoded_table->GetColumnByName("argument"));
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         GroupByTest(arguments, {table->GetColumnByName("key")},
+                                     aggregates, use_threads));
+    SortBy({"key_0"}, &expected);
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         GroupByTest(encoded_arguments,
+                                     {encoded_table->GetColumnByName("key")},
+                                     aggregates, use_threads));
+    SortBy({"key_0"}, &actual);
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 TEST_P(GroupBy, SumMeanProductDecimal) {
   auto in_schema = schema({
       field("argument0", decimal128(3, 2)),
@@ -26,6 +26,7 @@
 #include "arrow/api.h"
 #include "arrow/compute/row/row_encoder_internal.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/thread_pool.h"
 
@@ -240,6 +241,27 @@ static void BM_HashJoinBasic_KeyTypes(benchmark::State& st,
   HashJoinBasicBenchmarkImpl(st, settings);
 }
 
+// The hash table and key comparisons of the join dispatch to AVX-512 when available;
+// the second argument masks off the AVX-512 feature flags to compare with AVX2.
+static void BM_HashJoinBasic_Avx512(benchmark::State& st,
+                                    std::vector<std::shared_ptr<DataType>> key_types) {
+  auto cpu_info =
+      const_cast<arrow::internal::CpuInfo*>(arrow::internal::CpuInfo::GetInstance());
+  if (!cpu_info->IsDetected(arrow::internal::CpuInfo::AVX512)) {
+    st.SkipWithError("AVX-512 not available");
+    return;
+  }
+  BenchmarkSettings settings;
+  settings.num_build_batches = static_cast<int>(st.range(0));
+  settings.num_probe_batches = settings.num_build_batches;
+  settings.key_types = std::move(key_types);
+
+  const bool was_enabled = cpu_info->IsSupported(arrow::internal::CpuInfo::AVX512);
+  cpu_info->EnableFeature(arrow::internal::CpuInfo::AVX512, st.range(1) != 0);
+  HashJoinBasicBenchmarkImpl(st, settings);
+  cpu_info->EnableFeature(arrow::internal::CpuInfo::AVX512, was_enabled);
+}
+
 static void BM_HashJoinBasic_ProbeParallelism(benchmark::State& st) {
   BenchmarkSettings settings;
   settings.num_threads = static_cast<int>(st.range(0));
@@ -389,6 +411,14 @@ static void BM_HashJoinBasic_HeavyBuildPayload(benchmark::State& st) {
 std::vector<int64_t> hashtable_krows = benchmark::CreateRange(1, 4096, 8);
 
 std::vector<std::string> keytypes_argnames = {"Hashtable krows"};
+
+BENCHMARK_CAPTURE(BM_HashJoinBasic_Avx512, "{int32}", {int32()})
+    ->ArgNames({"Hashtable krows", "AVX-512"})
+    ->ArgsProduct({hashtable_krows, {0, 1}});
+BENCHMARK_CAPTURE(BM_HashJoinBasic_Avx512, "{int64,int64}", {int64(), int64()})
+    ->ArgNames({"Hashtable krows", "AVX-512"})
+    ->ArgsProduct({hashtable_krows, {0, 1}});
+
 #ifdef ARROW_BUILD_DETAILED_BENCHMARKS
 BENCHMARK_CAPTURE(BM_HashJoinBasic_KeyTypes, "{int32}", {int32()})
     ->ArgNames(keytypes_argnames)
@@ -67,8 +67,9 @@ using compute::Take;
 namespace acero {
 
 std::vector<int64_t> HardwareFlagsForTesting() {
-  // Acero currently only has AVX2 optimizations
-  return arrow::GetSupportedHardwareFlags({CpuInfo::AVX2});
+  // The hash join and group-by build on key hashing, the swiss table and row
+  // comparison, which have AVX2 and AVX-512 optimizations
+  return arrow::GetSupportedHardwareFlags({CpuInfo::AVX2, CpuInfo::AVX512});
 }
 
 namespace {
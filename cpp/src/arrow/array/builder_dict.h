@@ -711,6 +711,21 @@ class Dictionary32Builder : public internal::DictionaryBuilderBase<Int32Builder,
     this->null_count_ += this->indices_builder_.null_count() - null_count_before;
     return Status::OK();
   }
+
+  /// \brief Append dictionary indices directly without modifying memo, along
+  /// with a validity bitmap (may be null)
+  ///
+  /// NOTE: Experimental API
+  Status AppendIndices(const int32_t* values, int64_t length, const uint8_t* bitmap,
+                       int64_t bitmap_offset) {
+    int64_t null_count_before = this->indices_builder_.null_count();
+    ARROW_RETURN_NOT_OK(
+        this->indices_builder_.AppendValues(values, length, bitmap, bitmap_offset));
+    this->capacity_ = this->indices_builder_.capacity();
+    this->length_ += length;
+    this->null_count_ += this->indices_builder_.null_count() - null_count_before;
+    return Status::OK();
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -338,6 +338,10 @@ static auto kMakeStructOptionsType = GetFunctionOptionsType<MakeStructOptions>(
 static auto kMapLookupOptionsType = GetFunctionOptionsType<MapLookupOptions>(
     DataMember("occurrence", &MapLookupOptions::occurrence),
     DataMember("query_key", &MapLookupOptions::query_key));
+static auto kMatchAnySubstringOptionsType =
+    GetFunctionOptionsType<MatchAnySubstringOptions>(
+        DataMember("patterns", &MatchAnySubstringOptions::patterns),
+        DataMember("ignore_case", &MatchAnySubstringOptions::ignore_case));
 static auto kMatchSubstringOptionsType = GetFunctionOptionsType<MatchSubstringOptions>(
     DataMember("pattern", &MatchSubstringOptions::pattern),
     DataMember("ignore_case", &MatchSubstringOptions::ignore_case));
@@ -479,6 +483,15 @@ MapLookupOptions::MapLookupOptions()
     : MapLookupOptions(std::make_shared<NullScalar>(), Occurrence::FIRST) {}
 constexpr char MapLookupOptions::kTypeName[];
 
+MatchAnySubstringOptions::MatchAnySubstringOptions(std::vector<std::string> patterns,
+                                                   bool ignore_case)
+    : FunctionOptions(internal::kMatchAnySubstringOptionsType),
+      patterns(std::move(patterns)),
+      ignore_case(ignore_case) {}
+MatchAnySubstringOptions::MatchAnySubstringOptions()
+    : MatchAnySubstringOptions(std::vector<std::string>()) {}
+constexpr char MatchAnySubstringOptions::kTypeName[];
+
 MatchSubstringOptions::MatchSubstringOptions(std::string pattern, bool ignore_case)
     : FunctionOptions(internal::kMatchSubstringOptionsType),
       pattern(std::move(pattern)),
@@ -698,6 +711,7 @@ void RegisterScalarOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kListSliceOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMakeStructOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMapLookupOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kMatchAnySubstringOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMatchSubstringOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kNullOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kPadOptionsType));
@@ -160,6 +160,11 @@ static auto kRankQuantileOptionsType = GetFunctionOptionsType<RankQuantileOption
     DataMember("null_placement", &RankQuantileOptions::null_placement));
 static auto kPairwiseOptionsType = GetFunctionOptionsType<PairwiseOptions>(
     DataMember("periods", &PairwiseOptions::periods));
+static auto kRollingOptionsType = GetFunctionOptionsType<RollingOptions>(
+    DataMember("window_size", &RollingOptions::window_size),
+    DataMember("min_periods", &RollingOptions::min_periods),
+    DataMember("center", &RollingOptions::center),
+    DataMember("ddof", &RollingOptions::ddof));
 static auto kListFlattenOptionsType = GetFunctionOptionsType<ListFlattenOptions>(
     DataMember("recursive", &ListFlattenOptions::recursive));
 static auto kInversePermutationOptionsType =
@@ -251,6 +256,15 @@ PairwiseOptions::PairwiseOptions(int64_t periods)
     : FunctionOptions(internal::kPairwiseOptionsType), periods(periods) {}
 constexpr char PairwiseOptions::kTypeName[];
 
+RollingOptions::RollingOptions(int64_t window_size, std::optional<int64_t> min_periods,
+                               bool center, int ddof)
+    : FunctionOptions(internal::kRollingOptionsType),
+      window_size(window_size),
+      min_periods(min_periods),
+      center(center),
+      ddof(ddof) {}
+constexpr char RollingOptions::kTypeName[];
+
 ListFlattenOptions::ListFlattenOptions(bool recursive)
     : FunctionOptions(internal::kListFlattenOptionsType), recursive(recursive) {}
 constexpr char ListFlattenOptions::kTypeName[];
@@ -280,6 +294,7 @@ void RegisterVectorOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kRankOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kRankQuantileOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kPairwiseOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kRollingOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kListFlattenOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kInversePermutationOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kScatterOptionsType));
@@ -469,6 +484,34 @@ Result<Datum> CumulativeMean(const Datum& values, const CumulativeOptions& optio
   return CallFunction("cumulative_mean", {Datum(values)}, &options, ctx);
 }
 
+// ----------------------------------------------------------------------
+// Rolling functions
+
+Result<Datum> RollingSum(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx) {
+  return CallFunction("rolling_sum", {values}, &options, ctx);
+}
+
+Result<Datum> RollingMean(const Datum& values, const RollingOptions& options,
+                          ExecContext* ctx) {
+  return CallFunction("rolling_mean", {values}, &options, ctx);
+}
+
+Result<Datum> RollingMin(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx) {
+  return CallFunction("rolling_min", {values}, &options, ctx);
+}
+
+Result<Datum> RollingMax(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx) {
+  return CallFunction("rolling_max", {values}, &options, ctx);
+}
+
+Result<Datum> RollingStddev(const Datum& values, const RollingOptions& options,
+                            ExecContext* ctx) {
+  return CallFunction("rolling_stddev", {values}, &options, ctx);
+}
+
 // ----------------------------------------------------------------------
 // Swizzle functions
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "arrow/compute/function_options.h"
@@ -283,6 +284,33 @@ class ARROW_EXPORT PairwiseOptions : public FunctionOptions {
   int64_t periods = 1;
 };
 
+/// \brief Options for rolling window functions
+class ARROW_EXPORT RollingOptions : public FunctionOptions {
+ public:
+  explicit RollingOptions(int64_t window_size = 1,
+                          std::optional<int64_t> min_periods = std::nullopt,
+                          bool center = false, int ddof = 1);
+  static constexpr char const kTypeName[] = "RollingOptions";
+  static RollingOptions Defaults() { return RollingOptions(); }
+
+  /// Size of the window.
+  ///
+  /// For fixed windows, the number of rows in each window.  For time-based
+  /// windows ("_by_time" functions), the duration of each window, in the unit
+  /// of the times.
+  int64_t window_size = 1;
+  /// Minimum number of non-null values in a window to produce a non-null output.
+  ///
+  /// If not given, defaults to the window size for fixed windows and to 1 for
+  /// time-based windows.
+  std::optional<int64_t> min_periods;
+  /// If true, center fixed windows on each row rather than ending them at it.
+  /// Not supported for time-based windows.
+  bool center = false;
+  /// Delta degrees of freedom for the standard deviation.
+  int ddof = 1;
+};
+
 /// \brief Options for list_flatten function
 class ARROW_EXPORT ListFlattenOptions : public FunctionOptions {
  public:
@@ -755,6 +783,54 @@ Result<Datum> CumulativeMean(
     const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
     ExecContext* ctx = NULLPTR);
 
+/// \brief Compute the sum over a sliding window of an array-like object
+///
+/// Nulls in a window are skipped.  Results will wrap around on integer overflow.
+///
+/// \param[in] values array-like input
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+ARROW_EXPORT
+Result<Datum> RollingSum(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the mean over a sliding window of an array-like object
+///
+/// \param[in] values array-like input
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+ARROW_EXPORT
+Result<Datum> RollingMean(const Datum& values, const RollingOptions& options,
+                          ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the minimum over a sliding window of an array-like object
+///
+/// \param[in] values array-like input
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+ARROW_EXPORT
+Result<Datum> RollingMin(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the maximum over a sliding window of an array-like object
+///
+/// \param[in] values array-like input
+/// \param[in] options configures the window
+/// \param[in] ctx the function execution context, optional
+ARROW_EXPORT
+Result<Datum> RollingMax(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the standard deviation over a sliding window of an array-like
+/// object
+///
+/// \param[in] values array-like input
+/// \param[in] options configures the window and the delta degrees of freedom
+/// \param[in] ctx the function execution context, optional
+ARROW_EXPORT
+Result<Datum> RollingStddev(const Datum& values, const RollingOptions& options,
+                            ExecContext* ctx = NULLPTR);
+
 /// \brief Return the first order difference of an array.
 ///
 /// Computes the first order difference of an array, i.e.
@@ -780,6 +780,19 @@ class KernelExecutorImpl : public KernelExecutor {
 
 class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
+  Status Init(KernelContext* kernel_ctx, KernelInitArgs args) override {
+    RETURN_NOT_OK(KernelExecutorImpl<ScalarKernel>::Init(kernel_ctx, args));
+    // The output layout only depends on the resolved output type, so that
+    // repeated calls to Execute (e.g. through a FunctionExecutor) don't have
+    // to recompute it for every batch
+    output_num_buffers_ = static_cast<int>(output_type_.type->layout().buffers.size());
+    data_preallocated_.clear();
+    if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
+      ComputeDataPreallocate(*output_type_.type, &data_preallocated_);
+    }
+    return Status::OK();
+  }
+
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
     RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
 
@@ -929,7 +942,6 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   }
 
   Status SetupPreallocation(int64_t total_length, const std::vector<Datum>& args) {
-    output_num_buffers_ = static_cast<int>(output_type_.type->layout().buffers.size());
     auto out_type_id = output_type_.type->id();
     // Default to no validity pre-allocation for following cases:
     // - Output Array is NullArray
@@ -953,10 +965,6 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
         elide_validity_bitmap_ = true;
       }
     }
-    if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
-      data_preallocated_.clear();
-      ComputeDataPreallocate(*output_type_.type, &data_preallocated_);
-    }
 
     // Validity bitmap either preallocated or elided, and all data
     // buffers allocated. This is basically only true for primitive
@@ -1021,6 +1029,20 @@ Status CheckCanExecuteChunked(const VectorKernel* kernel) {
 
 class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
  public:
+  Status Init(KernelContext* kernel_ctx, KernelInitArgs args) override {
+    RETURN_NOT_OK(KernelExecutorImpl<VectorKernel>::Init(kernel_ctx, args));
+    // Decide once if we need to preallocate memory for this kernel
+    output_num_buffers_ = static_cast<int>(output_type_.type->layout().buffers.size());
+    validity_preallocated_ =
+        (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
+         kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL);
+    data_preallocated_.clear();
+    if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
+      ComputeDataPreallocate(*output_type_.type, &data_preallocated_);
+    }
+    return Status::OK();
+  }
+
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
     // Some vector kernels have a separate code path for handling
     // chunked arrays (VectorKernel::exec_chunked) so we check if we
@@ -1031,17 +1053,6 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
       if (arg.is_chunked_array()) have_chunked_arrays = true;
     }
 
-    output_num_buffers_ = static_cast<int>(output_type_.type->layout().buffers.size());
-
-    // Decide if we need to preallocate memory for this kernel
-    validity_preallocated_ =
-        (kernel_->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
-         kernel_->null_handling != NullHandling::OUTPUT_NOT_NULL);
-    if (kernel_->mem_allocation == MemAllocation::PREALLOCATE) {
-      data_preallocated_.clear();
-      ComputeDataPreallocate(*output_type_.type, &data_preallocated_);
-    }
-
     if (kernel_->can_execute_chunkwise) {
       RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
       ExecSpan span;
@@ -238,15 +238,18 @@ struct FunctionExecutorImpl : public FunctionExecutor {
       ARROW_RETURN_NOT_OK(Init(NULLPTR, default_exec_context()));
     }
     ExecContext* ctx = kernel_ctx.exec_context();
-    // Cast arguments if necessary
-    std::vector<Datum> args_with_cast(args.size());
+    // Cast arguments if necessary. Arguments already of the preconfigured
+    // types (the common case when the executor is reused) are copied as-is.
+    std::vector<Datum> args_with_cast;
+    args_with_cast.reserve(args.size());
     for (size_t i = 0; i != args.size(); ++i) {
       const auto& in_type = in_types[i];
-      auto arg = args[i];
       if (in_type != args[i].type()) {
-        ARROW_ASSIGN_OR_RAISE(arg, Cast(args[i], CastOptions::Safe(in_type), ctx));
+        ARROW_ASSIGN_OR_RAISE(auto arg, Cast(args[i], CastOptions::Safe(in_type), ctx));
+        args_with_cast.push_back(std::move(arg));
+      } else {
+        args_with_cast.push_back(args[i]);
       }
-      args_with_cast[i] = std::move(arg);
     }
 
     detail::DatumAccumulator listener;
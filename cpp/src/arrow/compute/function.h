@@ -113,6 +113,12 @@ struct ARROW_EXPORT FunctionDoc {
 };
 
 /// \brief An executor of a function with a preconfigured kernel
+///
+/// Kernel dispatch, kernel state initialization and output type resolution
+/// all happen when the executor is obtained and initialized, so an executor
+/// can be kept around as a "prepared call" and executed repeatedly on
+/// batches of the same types. This avoids most of the per-call overhead of
+/// CallFunction, which matters for small batches.
 class ARROW_EXPORT FunctionExecutor {
  public:
   virtual ~FunctionExecutor() = default;
@@ -21,6 +21,7 @@
 #include "arrow/compute/api.h"
 #include "arrow/compute/cast_internal.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/expression.h"
 #include "arrow/memory_pool.h"
 #include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
@@ -174,6 +175,57 @@ void BM_ExecuteScalarKernelOnScalar(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * N);
 }
 
+// The following benchmarks call "add" on small batches, where the cost of each
+// call is dominated by dispatch and setup rather than the kernel itself. Items
+// are calls, so that the reported rate is the per-call overhead.
+
+static std::vector<Datum> MakeSmallBatchArgs(int64_t length) {
+  random::RandomArrayGenerator rag(kSeed);
+  return {rag.Int64(length, 0, 1 << 20, /*null_probability=*/0),
+          rag.Int64(length, 0, 1 << 20, /*null_probability=*/0)};
+}
+
+void BM_CallFunctionSmallBatch(benchmark::State& state) {
+  // Kernel dispatch and initialization on every call
+  const auto args = MakeSmallBatchArgs(state.range(0));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("add", args));
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FunctionExecutorSmallBatch(benchmark::State& state) {
+  // Prepared call: dispatch and initialization happen once, outside the hot loop
+  const auto args = MakeSmallBatchArgs(state.range(0));
+  ASSERT_OK_AND_ASSIGN(auto executor, GetFunctionExecutor("add", args));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(Datum result, executor->Execute(args));
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ExecuteScalarExpressionSmallBatch(benchmark::State& state) {
+  // Bound expression: dispatch happens once at bind time
+  const auto args = MakeSmallBatchArgs(state.range(0));
+  auto schema = ::arrow::schema({field("a", int64()), field("b", int64())});
+  ASSERT_OK_AND_ASSIGN(auto expr,
+                       call("add", {field_ref("a"), field_ref("b")}).Bind(*schema));
+  const ExecBatch batch(args, state.range(0));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(Datum result, ExecuteScalarExpression(expr, batch));
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
 void BM_ExecSpanIterator(benchmark::State& state) {
   // Measure overhead related to splitting ExecBatch into smaller non-owning
   // ExecSpans for parallelism or more optimal CPU cache affinity
@@ -215,6 +267,9 @@ BENCHMARK(BM_CastDispatchBaseline);
 BENCHMARK(BM_AddDispatch);
 BENCHMARK(BM_ExecuteScalarFunctionOnScalar);
 BENCHMARK(BM_ExecuteScalarKernelOnScalar);
+BENCHMARK(BM_CallFunctionSmallBatch)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_FunctionExecutorSmallBatch)->Arg(1)->Arg(64)->Arg(1024);
+BENCHMARK(BM_ExecuteScalarExpressionSmallBatch)->Arg(1)->Arg(64)->Arg(1024);
 BENCHMARK(BM_ExecSpanIterator)->RangeMultiplier(4)->Range(1024, 64 * 1024);
 
 }  // namespace compute
@@ -78,6 +78,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
+  options.emplace_back(new MatchAnySubstringOptions({"pattern", "other"}));
+  options.emplace_back(
+      new MatchAnySubstringOptions({"pattern", "other"}, /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
   options.emplace_back(new SplitOptions(/*max_splits=*/2, /*reverse=*/true));
   options.emplace_back(new SplitPatternOptions("pattern"));
@@ -134,6 +137,9 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new PartitionNthOptions(/*pivot=*/42));
   options.emplace_back(new SelectKOptions(0, {}));
   options.emplace_back(new SelectKOptions(5, {{SortKey("key", SortOrder::Ascending)}}));
+  options.emplace_back(new RollingOptions());
+  options.emplace_back(new RollingOptions(/*window_size=*/5, /*min_periods=*/2,
+                                          /*center=*/true, /*ddof=*/0));
   options.emplace_back(new Utf8NormalizeOptions());
   options.emplace_back(new Utf8NormalizeOptions(Utf8NormalizeOptions::NFD));
   options.emplace_back(
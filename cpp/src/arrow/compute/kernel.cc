@@ -350,6 +350,46 @@ std::shared_ptr<TypeMatcher> RunEndEncoded(
                                                 std::move(value_type_matcher));
 }
 
+class DictionaryEncodedMatcher : public TypeMatcher {
+ public:
+  explicit DictionaryEncodedMatcher(std::shared_ptr<TypeMatcher> value_type_matcher)
+      : value_type_matcher{std::move(value_type_matcher)} {}
+
+  ~DictionaryEncodedMatcher() override = default;
+
+  bool Matches(const DataType& type) const override {
+    if (type.id() == Type::DICTIONARY) {
+      const auto& dict_type = checked_cast<const DictionaryType&>(type);
+      return value_type_matcher->Matches(*dict_type.value_type());
+    }
+    return false;
+  }
+
+  bool Equals(const TypeMatcher& other) const override {
+    if (this == &other) {
+      return true;
+    }
+    const auto* casted = dynamic_cast<const DictionaryEncodedMatcher*>(&other);
+    return casted != nullptr && value_type_matcher->Equals(*casted->value_type_matcher);
+  }
+
+  std::string ToString() const override {
+    return "dictionary(" + value_type_matcher->ToString() + ")";
+  };
+
+ private:
+  std::shared_ptr<TypeMatcher> value_type_matcher;
+};
+
+std::shared_ptr<TypeMatcher> DictionaryEncoded(
+    std::shared_ptr<TypeMatcher> value_type_matcher) {
+  return std::make_shared<DictionaryEncodedMatcher>(std::move(value_type_matcher));
+}
+
+std::shared_ptr<TypeMatcher> DictionaryEncoded(Type::type value_type_id) {
+  return DictionaryEncoded(SameTypeId(value_type_id));
+}
+
 }  // namespace match
 
 // ----------------------------------------------------------------------
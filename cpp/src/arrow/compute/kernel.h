@@ -173,6 +173,19 @@ ARROW_EXPORT std::shared_ptr<TypeMatcher> RunEndEncoded(
     std::shared_ptr<TypeMatcher> run_end_type_matcher,
     std::shared_ptr<TypeMatcher> value_type_matcher);
 
+/// \brief Match dictionary-encoded types that use any index type and encode
+/// specific value types
+///
+/// @param[in] value_type_matcher a matcher that is applied to the value type
+ARROW_EXPORT std::shared_ptr<TypeMatcher> DictionaryEncoded(
+    std::shared_ptr<TypeMatcher> value_type_matcher);
+
+/// \brief Match dictionary-encoded types that use any index type and encode
+/// specific value types
+///
+/// @param[in] value_type_id a type id that the value type should match
+ARROW_EXPORT std::shared_ptr<TypeMatcher> DictionaryEncoded(Type::type value_type_id);
+
 }  // namespace match
 
 /// \brief An object used for type-checking arguments to be passed to a kernel
@@ -98,6 +98,21 @@ TEST(TypeMatcher, RunEndEncoded) {
   }
 }
 
+TEST(TypeMatcher, DictionaryEncoded) {
+  auto string_dict_matcher = match::DictionaryEncoded(Type::STRING);
+  auto int32_dict_matcher = match::DictionaryEncoded(match::SameTypeId(Type::INT32));
+  for (auto index_type : {int8(), int16(), int32(), uint64()}) {
+    ASSERT_TRUE(string_dict_matcher->Matches(*dictionary(index_type, utf8())));
+    ASSERT_FALSE(string_dict_matcher->Matches(*dictionary(index_type, int32())));
+
+    ASSERT_FALSE(int32_dict_matcher->Matches(*dictionary(index_type, utf8())));
+    ASSERT_TRUE(int32_dict_matcher->Matches(*dictionary(index_type, int32())));
+  }
+  ASSERT_FALSE(string_dict_matcher->Matches(*utf8()));
+  ASSERT_TRUE(string_dict_matcher->Equals(*match::DictionaryEncoded(Type::STRING)));
+  ASSERT_FALSE(string_dict_matcher->Equals(*int32_dict_matcher));
+}
+
 // ----------------------------------------------------------------------
 // InputType
 
@@ -101,7 +101,9 @@ struct CountImpl : public ScalarAggregator {
       this->non_nulls += batch.length;
     } else if (batch[0].is_array()) {
       const ArraySpan& input = batch[0].array;
-      const int64_t nulls = input.GetNullCount();
+      const int64_t nulls = input.type->id() == Type::RUN_END_ENCODED
+                                ? ::arrow::ree_util::LogicalNullCount(input)
+                                : input.GetNullCount();
       this->nulls += nulls;
       this->non_nulls += input.length - nulls;
     } else {
@@ -265,6 +267,8 @@ void AddCountDistinctKernels(ScalarAggregateFunction* func) {
   AddCountDistinctKernel<BinaryType, std::string_view>(match::BinaryLike(), func);
   AddCountDistinctKernel<LargeBinaryType, std::string_view>(match::LargeBinaryLike(),
                                                             func);
+  AddCountDistinctKernel<BinaryViewType, std::string_view>(binary_view(), func);
+  AddCountDistinctKernel<BinaryViewType, std::string_view>(utf8_view(), func);
   // Fixed binary & Decimal
   AddCountDistinctKernel<FixedSizeBinaryType, std::string_view>(
       match::FixedSizeBinaryLike(), func);
@@ -281,7 +285,7 @@ struct SumImplDefault : public SumImpl<ArrowType, SimdLevel::NONE> {
 Result<std::unique_ptr<KernelState>> SumInit(KernelContext* ctx,
                                              const KernelInitArgs& args) {
   SumLikeInit<SumImplDefault> visitor(
-      ctx, args.inputs[0].GetSharedPtr(),
+      ctx, GetAggregatedType(args.inputs[0]).GetSharedPtr(),
       static_cast<const ScalarAggregateOptions&>(*args.options));
   return visitor.Create();
 }
@@ -297,7 +301,7 @@ struct MeanImplDefault : public MeanImpl<ArrowType, SimdLevel::NONE> {
 Result<std::unique_ptr<KernelState>> MeanInit(KernelContext* ctx,
                                               const KernelInitArgs& args) {
   MeanKernelInit<MeanImplDefault> visitor(
-      ctx, args.inputs[0].GetSharedPtr(),
+      ctx, GetAggregatedType(args.inputs[0]).GetSharedPtr(),
       static_cast<const ScalarAggregateOptions&>(*args.options));
   return visitor.Create();
 }
@@ -492,7 +496,7 @@ Result<std::unique_ptr<KernelState>> MinMaxInitDefault(KernelContext* ctx,
   ARROW_ASSIGN_OR_RAISE(TypeHolder out_type,
                         args.kernel->signature->out_type().Resolve(ctx, args.inputs));
   MinMaxInitState<SimdLevel::NONE> visitor(
-      ctx, *args.inputs[0], out_type.GetSharedPtr(),
+      ctx, *GetAggregatedType(args.inputs[0]), out_type.GetSharedPtr(),
       static_cast<const ScalarAggregateOptions&>(*args.options));
   return visitor.Create();
 }
@@ -501,7 +505,7 @@ Result<std::unique_ptr<KernelState>> MinMaxInitDefault(KernelContext* ctx,
 template <MinOrMax min_or_max>
 void AddMinOrMaxAggKernel(ScalarAggregateFunction* func,
                           ScalarAggregateFunction* min_max_func) {
-  auto sig = KernelSignature::Make({InputType::Any()}, FirstType);
+  auto sig = KernelSignature::Make({InputType::Any()}, FirstAggregatedType);
   auto init = [min_max_func](
                   KernelContext* ctx,
                   const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
@@ -874,10 +878,20 @@ namespace {
 
 Result<TypeHolder> MinMaxType(KernelContext*, const std::vector<TypeHolder>& types) {
   // T -> struct<min: T, max: T>
-  auto ty = types.front().GetSharedPtr();
+  auto ty = GetAggregatedType(types.front()).GetSharedPtr();
   return struct_({field("min", ty), field("max", ty)});
 }
 
+void AddRunEndEncodedAggKernels(KernelInit init,
+                                const std::vector<std::shared_ptr<DataType>>& types,
+                                OutputType out_type, ScalarAggregateFunction* func) {
+  for (const auto& ty : types) {
+    // run_end_encoded<R, InT> -> OutT
+    auto sig = KernelSignature::Make({match::RunEndEncoded(ty->id())}, out_type);
+    AddAggKernel(std::move(sig), init, func, SimdLevel::NONE);
+  }
+}
+
 }  // namespace
 
 Result<TypeHolder> FirstLastType(KernelContext*, const std::vector<TypeHolder>& types) {
@@ -1056,6 +1070,10 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddArrayScalarAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
   AddArrayScalarAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   AddArrayScalarAggKernels(SumInit, {null()}, int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, {boolean()}, uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, SignedIntTypes(), int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
@@ -1081,6 +1099,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddAggKernel(KernelSignature::Make({Type::DECIMAL256}, FirstType), MeanInit, func.get(),
                SimdLevel::NONE);
   AddArrayScalarAggKernels(MeanInit, {null()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, {boolean()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, NumericTypes(), float64(), func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -1127,6 +1147,10 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddMinMaxKernel(MinMaxInitDefault, Type::INTERVAL_MONTHS, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL128, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL256, func.get());
+  AddRunEndEncodedAggKernels(MinMaxInitDefault, NumericTypes(), MinMaxType, func.get());
+  AddRunEndEncodedAggKernels(MinMaxInitDefault, TemporalTypes(), MinMaxType, func.get());
+  AddRunEndEncodedAggKernels(MinMaxInitDefault, BaseBinaryTypes(), MinMaxType,
+                             func.get());
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -37,6 +37,7 @@
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow::compute::internal {
 namespace {
@@ -59,6 +60,9 @@ struct SumImpl : public ScalarAggregator {
   Status Consume(KernelContext*, const ExecSpan& batch) override {
     if (batch[0].is_array()) {
       const ArraySpan& data = batch[0].array;
+      if (data.type->id() == Type::RUN_END_ENCODED) {
+        return ConsumeRunEndEncoded(data);
+      }
       this->count += data.length - data.GetNullCount();
       this->nulls_observed = this->nulls_observed || data.GetNullCount();
 
@@ -73,7 +77,7 @@ struct SumImpl : public ScalarAggregator {
         this->sum += SumArray<CType, SumCType, SimdLevel>(data);
       }
     } else {
-      const Scalar& data = *batch[0].scalar;
+      const Scalar& data = GetAggregatedScalar(*batch[0].scalar);
       this->count += data.is_valid * batch.length;
       this->nulls_observed = this->nulls_observed || !data.is_valid;
       if (data.is_valid) {
@@ -84,6 +88,53 @@ struct SumImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  // Each run contributes its value weighted by the run length
+  template <typename RunEndCType>
+  Status ConsumeRuns(const ArraySpan& data) {
+    const ArraySpan& values = ::arrow::ree_util::ValuesArray(data);
+    const ::arrow::ree_util::RunEndEncodedArraySpan<RunEndCType> runs(data);
+    for (auto it = runs.begin(); !it.is_end(runs); ++it) {
+      const int64_t i = it.index_into_array();
+      if (!values.IsValid(i)) {
+        this->nulls_observed = true;
+        continue;
+      }
+      const int64_t run_length = it.run_length();
+      this->count += run_length;
+      if constexpr (is_boolean_type<ArrowType>::value) {
+        this->sum += bit_util::GetBit(values.buffers[1].data, values.offset + i)
+                         ? static_cast<SumCType>(run_length)
+                         : 0;
+      } else {
+        AddRun(static_cast<SumCType>(values.GetValues<CType>(1)[i]), run_length);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Integer sums wrap around on overflow, as when adding the run values one by one
+  void AddRun(SumCType value, int64_t run_length) {
+    if constexpr (std::is_integral_v<SumCType>) {
+      using UnsignedType = std::make_unsigned_t<SumCType>;
+      this->sum = static_cast<SumCType>(static_cast<UnsignedType>(this->sum) +
+                                        static_cast<UnsignedType>(value) *
+                                            static_cast<UnsignedType>(run_length));
+    } else {
+      this->sum += value * static_cast<SumCType>(run_length);
+    }
+  }
+
+  Status ConsumeRunEndEncoded(const ArraySpan& data) {
+    switch (checked_cast<const RunEndEncodedType&>(*data.type).run_end_type()->id()) {
+      case Type::INT16:
+        return ConsumeRuns<int16_t>(data);
+      case Type::INT32:
+        return ConsumeRuns<int32_t>(data);
+      default:
+        return ConsumeRuns<int64_t>(data);
+    }
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->count += other.count;
@@ -767,9 +818,12 @@ struct MinMaxImpl : public ScalarAggregator {
 
   Status Consume(KernelContext*, const ExecSpan& batch) override {
     if (batch[0].is_array()) {
+      if (batch[0].array.type->id() == Type::RUN_END_ENCODED) {
+        return ConsumeRunEndEncoded(batch[0].array);
+      }
       return ConsumeArray(batch[0].array);
     }
-    return ConsumeScalar(*batch[0].scalar);
+    return ConsumeScalar(GetAggregatedScalar(*batch[0].scalar));
   }
 
   Status ConsumeScalar(const Scalar& scalar) {
@@ -806,6 +860,19 @@ struct MinMaxImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  // The extrema only depend on the values of the runs, but the count
+  // depends on their lengths
+  Status ConsumeRunEndEncoded(const ArraySpan& data) {
+    const auto [physical_offset, physical_length] =
+        ::arrow::ree_util::FindPhysicalRange(data, data.offset, data.length);
+    ArraySpan values = ::arrow::ree_util::ValuesArray(data);
+    values.SetSlice(values.offset + physical_offset, physical_length);
+    const int64_t count = this->count;
+    RETURN_NOT_OK(ConsumeArray(values));
+    this->count = count + data.length - ::arrow::ree_util::LogicalNullCount(data);
+    return Status::OK();
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->state += other.state;
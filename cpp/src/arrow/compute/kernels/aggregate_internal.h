@@ -127,6 +127,29 @@ void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
                   ScalarAggregateFinalize finalize, ScalarAggregateFunction* func,
                   SimdLevel::type simd_level = SimdLevel::NONE, bool ordered = false);
 
+// Run-end encoded inputs are aggregated on the values of their runs, so
+// aggregators are created for (and output) the value type of such inputs.
+inline TypeHolder GetAggregatedType(const TypeHolder& type) {
+  if (type.id() == Type::RUN_END_ENCODED) {
+    return ::arrow::internal::checked_cast<const RunEndEncodedType&>(*type)
+        .value_type();
+  }
+  return type;
+}
+
+inline const Scalar& GetAggregatedScalar(const Scalar& scalar) {
+  if (scalar.type->id() == Type::RUN_END_ENCODED) {
+    return *::arrow::internal::checked_cast<const RunEndEncodedScalar&>(scalar).value;
+  }
+  return scalar;
+}
+
+// OutputType::Resolver returning the aggregated type of the first input
+inline Result<TypeHolder> FirstAggregatedType(KernelContext*,
+                                              const std::vector<TypeHolder>& types) {
+  return GetAggregatedType(types.front());
+}
+
 using arrow::internal::VisitSetBitRunsVoid;
 
 template <typename T, typename Enable = void>
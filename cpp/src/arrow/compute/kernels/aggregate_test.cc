@@ -1516,6 +1516,67 @@ TEST(TestNullMeanKernel, Basics) {
               ResultWith(null_result));
 }
 
+//
+// Run-end encoded input
+//
+
+TEST(TestRunEndEncodedAggregation, Basics) {
+  const ScalarAggregateOptions skip_nulls(/*skip_nulls=*/true, /*min_count=*/0);
+  const ScalarAggregateOptions keep_nulls(/*skip_nulls=*/false, /*min_count=*/0);
+  const ScalarAggregateOptions min_count(/*skip_nulls=*/true, /*min_count=*/5);
+  const CountOptions count_all(CountOptions::ALL);
+  const CountOptions count_nulls(CountOptions::ONLY_NULL);
+
+  auto check = [](const std::string& func_name, const std::shared_ptr<Array>& values,
+                  const FunctionOptions* options = nullptr) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, {values}, options));
+    for (const auto& run_end_type : {int16(), int32(), int64()}) {
+      ARROW_SCOPED_TRACE("func_name = ", func_name, ", values = ", values->ToString(),
+                         ", run_end_type = ", *run_end_type);
+      ASSERT_OK_AND_ASSIGN(Datum encoded,
+                           RunEndEncode(values, RunEndEncodeOptions(run_end_type)));
+      ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, {encoded}, options));
+      AssertDatumsApproxEqual(expected, actual, /*verbose=*/true);
+    }
+  };
+
+  auto ints = ArrayFromJSON(int64(), "[1, 1, 1, null, null, 5, 5, -2, 7, 7, 7, 7]");
+  auto floats = ArrayFromJSON(float64(), "[1.5, 1.5, null, 3, 3, 3, -1, -1]");
+  auto bools = ArrayFromJSON(boolean(), "[true, true, false, null, true]");
+  auto strings = ArrayFromJSON(utf8(), R"(["b", "b", "a", null, "c", "c"])");
+  for (const auto& values : {ints, ints->Slice(2), ints->Slice(1, 8), ints->Slice(3, 2),
+                             ints->Slice(0, 0), floats}) {
+    for (const auto* options : {&skip_nulls, &keep_nulls, &min_count}) {
+      check("sum", values, options);
+      check("mean", values, options);
+      check("min_max", values, options);
+    }
+    check("min", values);
+    check("max", values);
+    check("count", values);
+    check("count", values, &count_all);
+    check("count", values, &count_nulls);
+  }
+  check("sum", bools);
+  check("mean", bools);
+  check("min_max", strings);
+}
+
+TEST(TestRunEndEncodedAggregation, SumOverflow) {
+  // A run long enough for value * run_length to overflow int64; the sum wraps
+  // around as when adding the values one by one
+  const int64_t long_run = int64_t{1} << 62;
+  ASSERT_OK_AND_ASSIGN(
+      auto encoded,
+      RunEndEncodedArray::Make(long_run + 1,
+                               ArrayFromJSON(int64(), "[4611686018427387904, "
+                                                      "4611686018427387905]"),
+                               ArrayFromJSON(int8(), "[4, 1]")));
+  EXPECT_THAT(Sum(encoded), ResultWith(Datum(std::make_shared<Int64Scalar>(1))));
+  EXPECT_THAT(Count(encoded),
+              ResultWith(Datum(std::make_shared<Int64Scalar>(long_run + 1))));
+}
+
 //
 // First / Last
 //
@@ -37,6 +37,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_generate.h"
@@ -322,6 +323,26 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
   }
 };
 
+template <typename Type>
+struct ArrayIterator<Type, enable_if_binary_view_like<Type>> {
+  const ArraySpan& arr;
+  const BinaryViewType::c_type* views;
+  const std::shared_ptr<Buffer>* data_buffers;
+  int64_t position = 0;
+
+  explicit ArrayIterator(const ArraySpan& arr)
+      : arr(arr),
+        views(arr.GetValues<BinaryViewType::c_type>(1)),
+        data_buffers(arr.GetVariadicBuffers().data()) {}
+
+  std::string_view operator()() {
+    // Unlike offsets, the views of null slots may be arbitrary
+    const int64_t i = position++;
+    if (arr.IsNull(i)) return {};
+    return ::arrow::util::FromBinaryView(views[i], data_buffers);
+  }
+};
+
 template <>
 struct ArrayIterator<FixedSizeBinaryType> {
   const ArraySpan& arr;
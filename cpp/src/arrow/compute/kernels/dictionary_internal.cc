@@ -0,0 +1,354 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/dictionary_internal.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/compute/kernels/wrapped_kernel_internal.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Whether the span views the same memory as the data.  The data is expected to
+// hold the buffers alive, so that their addresses can't have been reused.
+bool IsSameArray(const ArraySpan& span, const ArrayData& data) {
+  if (span.type != data.type.get() || span.offset != data.offset ||
+      span.length != data.length) {
+    return false;
+  }
+  const int num_buffers = span.HasVariadicBuffers() ? 2 : span.num_buffers();
+  const size_t num_variadic_buffers =
+      span.HasVariadicBuffers() ? span.GetVariadicBuffers().size() : 0;
+  if (data.buffers.size() != num_buffers + num_variadic_buffers) {
+    return false;
+  }
+  for (int i = 0; i < num_buffers; ++i) {
+    const uint8_t* buffer_data = data.buffers[i] ? data.buffers[i]->data() : NULLPTR;
+    if (span.buffers[i].data != buffer_data) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < num_variadic_buffers; ++i) {
+    if (span.GetVariadicBuffers()[i] != data.buffers[num_buffers + i]) {
+      return false;
+    }
+  }
+  if (span.type->id() == Type::DICTIONARY) {
+    return data.dictionary != NULLPTR && IsSameArray(span.dictionary(), *data.dictionary);
+  }
+  if (span.child_data.size() != data.child_data.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < span.child_data.size(); ++i) {
+    if (!IsSameArray(span.child_data[i], *data.child_data[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether all buffers of the span are owned, so that a copy of it keeps them alive
+bool HasOwnedBuffers(const ArraySpan& span) {
+  const int num_buffers = span.HasVariadicBuffers() ? 2 : span.num_buffers();
+  for (int i = 0; i < num_buffers; ++i) {
+    if (span.buffers[i].data != NULLPTR && span.buffers[i].owner == NULLPTR) {
+      return false;
+    }
+  }
+  for (const ArraySpan& child : span.child_data) {
+    if (!HasOwnedBuffers(child)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The arguments of the wrapped kernel: the values of the dictionary argument
+// alongside the scalar arguments
+std::vector<Datum> GetDictionaryArgs(const ExecSpan& batch, int dict_index) {
+  std::vector<Datum> args(batch.num_values());
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (i == dict_index) {
+      args[i] = batch[i].array.dictionary().ToArrayData();
+    } else {
+      args[i] = batch[i].scalar->GetSharedPtr();
+    }
+  }
+  return args;
+}
+
+// The wrapped kernel selected for the dictionary value types, along with the
+// last result of it on a dictionary, which is guarded by a mutex
+struct DictionaryKernelState : public WrappedKernelState {
+  // The arguments of the last execution on a dictionary and its result
+  mutable std::vector<Datum> cached_args;
+  mutable Datum cached_result;
+  mutable std::mutex cache_mutex;
+
+  static const DictionaryKernelState& Get(KernelContext* ctx) {
+    return checked_cast<const DictionaryKernelState&>(*ctx->state());
+  }
+
+  // Execute the wrapped kernel on the values of the dictionary argument
+  // alongside the scalar arguments.  Consecutive batches usually share their
+  // dictionary, so the result is reused while the arguments are the same.
+  Result<Datum> ExecuteOnDictionary(KernelContext* ctx, const ExecSpan& batch,
+                                    int dict_index) const {
+    const ArraySpan& dictionary = batch[dict_index].array.dictionary();
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+      if (IsCached(batch, dict_index)) {
+        return cached_result;
+      }
+    }
+    std::vector<Datum> args = GetDictionaryArgs(batch, dict_index);
+    ARROW_ASSIGN_OR_RAISE(Datum result, Execute(ctx, args, dictionary.length));
+    if (HasOwnedBuffers(dictionary)) {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+      cached_args = std::move(args);
+      cached_result = result;
+    }
+    return result;
+  }
+
+ private:
+  // The cached arguments hold the scalars and the dictionary buffers alive, so
+  // comparing addresses is enough
+  bool IsCached(const ExecSpan& batch, int dict_index) const {
+    if (cached_args.size() != static_cast<size_t>(batch.num_values())) {
+      return false;
+    }
+    for (int i = 0; i < batch.num_values(); ++i) {
+      if (i == dict_index) {
+        if (!IsSameArray(batch[i].array.dictionary(), *cached_args[i].array())) {
+          return false;
+        }
+      } else if (batch[i].scalar != cached_args[i].scalar().get()) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+Result<TypeHolder> ResolveDictionaryTransformOutput(
+    KernelContext* ctx, const std::vector<TypeHolder>& types) {
+  ARROW_ASSIGN_OR_RAISE(TypeHolder out_type, WrappedKernelState::GetOutputType(ctx));
+  const auto& dict_type = checked_cast<const DictionaryType&>(*types[0]);
+  return dictionary(dict_type.index_type(), out_type.GetSharedPtr());
+}
+
+Result<TypeHolder> ResolveDictionaryLookupOutput(KernelContext* ctx,
+                                                 const std::vector<TypeHolder>&) {
+  return WrappedKernelState::GetOutputType(ctx);
+}
+
+std::shared_ptr<ArrayData> GetIndices(const ArraySpan& span) {
+  auto indices = span.ToArrayData();
+  indices->type = checked_cast<const DictionaryType&>(*span.type).index_type();
+  indices->dictionary = NULLPTR;
+  return indices;
+}
+
+// Decode all dictionary arguments and evaluate the wrapped kernel on them
+Status ExecDecoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& state = DictionaryKernelState::Get(ctx);
+  std::vector<Datum> args(batch.num_values());
+  for (int i = 0; i < batch.num_values(); ++i) {
+    const ExecValue& value = batch[i];
+    if (value.is_array()) {
+      args[i] = value.array.ToArrayData();
+    } else {
+      args[i] = value.scalar->GetSharedPtr();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result, state.Execute(ctx, std::move(args), batch.length));
+  DCHECK(result.is_array());
+  out->value = result.array();
+  return Status::OK();
+}
+
+Status DictionaryTransformExec(KernelContext* ctx, const ExecSpan& batch,
+                               ExecResult* out) {
+  const auto& state = DictionaryKernelState::Get(ctx);
+  const ArraySpan& dict_array = batch[0].array;
+  ARROW_ASSIGN_OR_RAISE(Datum transformed,
+                        state.ExecuteOnDictionary(ctx, batch, /*dict_index=*/0));
+  DCHECK(transformed.is_array());
+
+  auto result = dict_array.ToArrayData();
+  result->type = ::arrow::dictionary(
+      checked_cast<const DictionaryType&>(*dict_array.type).index_type(),
+      transformed.type());
+  result->dictionary = transformed.array();
+  out->value = std::move(result);
+  return Status::OK();
+}
+
+Status DictionaryLookupExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& state = DictionaryKernelState::Get(ctx);
+
+  // Only a single dictionary array alongside scalars can be evaluated on the
+  // dictionary values; anything else is decoded.
+  int dict_index = -1;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    const ExecValue& value = batch[i];
+    if (value.is_scalar()) continue;
+    if (dict_index >= 0 || value.type()->id() != Type::DICTIONARY) {
+      return ExecDecoded(ctx, batch, out);
+    }
+    dict_index = i;
+  }
+  DCHECK_GE(dict_index, 0);
+
+  const ArraySpan& dict_array = batch[dict_index].array;
+  ARROW_ASSIGN_OR_RAISE(Datum mapped, state.ExecuteOnDictionary(ctx, batch, dict_index));
+
+  auto indices = GetIndices(dict_array);
+  ARROW_ASSIGN_OR_RAISE(
+      Datum result,
+      Take(mapped, indices, TakeOptions::NoBoundsCheck(), ctx->exec_context()));
+
+  if (dict_array.GetNullCount() > 0) {
+    // Null indices are gathered as nulls, but not every function maps a null
+    // input to a null output (e.g. "is_in" when matching nulls), so evaluate it
+    // once on a null value and fill in the result if needed.
+    std::vector<Datum> args = GetDictionaryArgs(batch, dict_index);
+    ARROW_ASSIGN_OR_RAISE(args[dict_index],
+                          MakeArrayOfNull(dict_array.dictionary().type->GetSharedPtr(),
+                                          1, ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(Datum null_mapped, state.Execute(ctx, std::move(args), 1));
+    auto null_result = null_mapped.make_array();
+    if (null_result->IsValid(0)) {
+      ARROW_ASSIGN_OR_RAISE(auto fill_value, null_result->GetScalar(0));
+      ARROW_ASSIGN_OR_RAISE(Datum is_valid,
+                            CallFunction("is_valid", {indices}, ctx->exec_context()));
+      ARROW_ASSIGN_OR_RAISE(result,
+                            CallFunction("if_else", {is_valid, result, fill_value},
+                                         ctx->exec_context()));
+    }
+  }
+  out->value = result.array();
+  return Status::OK();
+}
+
+// Matches the same types as the wrapped InputType, so that dictionary kernels
+// are selected for exactly the value types the function has kernels for.
+class InputTypeMatcher : public TypeMatcher {
+ public:
+  explicit InputTypeMatcher(InputType in_type) : in_type_(std::move(in_type)) {}
+
+  bool Matches(const DataType& type) const override { return in_type_.Matches(type); }
+
+  bool Equals(const TypeMatcher& other) const override {
+    if (this == &other) {
+      return true;
+    }
+    const auto* casted = dynamic_cast<const InputTypeMatcher*>(&other);
+    return casted != nullptr && in_type_.Equals(casted->in_type_);
+  }
+
+  std::string ToString() const override { return in_type_.ToString(); }
+
+ private:
+  InputType in_type_;
+};
+
+std::shared_ptr<TypeMatcher> GetDictionaryMatcher(const InputType& value_type) {
+  if (value_type.kind() == InputType::ANY_TYPE) {
+    return NULLPTR;
+  }
+  return match::DictionaryEncoded(std::make_shared<InputTypeMatcher>(value_type));
+}
+
+// Adding kernels invalidates pointers to the existing ones, so take a copy of
+// their signatures before iterating
+std::vector<std::shared_ptr<KernelSignature>> GetSignatures(const ScalarFunction& func) {
+  std::vector<std::shared_ptr<KernelSignature>> signatures;
+  for (const ScalarKernel* kernel : func.kernels()) {
+    signatures.push_back(kernel->signature);
+  }
+  return signatures;
+}
+
+void AddDictionaryKernel(ScalarFunction* func, std::vector<InputType> in_types,
+                         OutputType out_type, ArrayKernelExec exec) {
+  const bool is_varargs = func->arity().is_varargs;
+  auto signature =
+      KernelSignature::Make(std::move(in_types), std::move(out_type), is_varargs);
+  for (const ScalarKernel* kernel : func->kernels()) {
+    if (kernel->signature->Equals(*signature)) return;
+  }
+  ScalarKernel kernel(std::move(signature), std::move(exec),
+                      MakeWrappedKernelInit<DictionaryKernelState>(
+                          func, EnsureDictionaryDecoded));
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  kernel.can_write_into_slices = false;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+}  // namespace
+
+void AddDictionaryTransformKernels(ScalarFunction* func) {
+  DCHECK_EQ(func->arity().num_args, 1);
+  for (const auto& signature : GetSignatures(*func)) {
+    if (signature->in_types().size() != 1) continue;
+    auto matcher = GetDictionaryMatcher(signature->in_types()[0]);
+    if (matcher == NULLPTR) continue;
+    AddDictionaryKernel(func, {InputType(std::move(matcher))},
+                        OutputType(ResolveDictionaryTransformOutput),
+                        DictionaryTransformExec);
+  }
+}
+
+void AddDictionaryLookupKernels(ScalarFunction* func) {
+  for (const auto& signature : GetSignatures(*func)) {
+    const auto& in_types = signature->in_types();
+    for (size_t i = 0; i < in_types.size(); ++i) {
+      auto matcher = GetDictionaryMatcher(in_types[i]);
+      if (matcher == NULLPTR) continue;
+      std::vector<InputType> dict_in_types = in_types;
+      dict_in_types[i] = InputType(std::move(matcher));
+      AddDictionaryKernel(func, std::move(dict_in_types),
+                          OutputType(ResolveDictionaryLookupOutput),
+                          DictionaryLookupExec);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
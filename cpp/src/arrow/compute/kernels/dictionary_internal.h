@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+// Helpers to evaluate scalar functions on dictionary-encoded inputs without
+// decoding them.
+//
+// The kernels added by these helpers dispatch the function again on the
+// dictionary value type when they are initialized, run that kernel once over
+// the dictionary values of each batch and then remap the result through the
+// dictionary indices.  Since a dictionary is usually much shorter than the
+// array it encodes, this reduces the cost of the function to (roughly) the cost
+// of processing the indices.
+
+#include "arrow/compute/function.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+/// \brief Add dictionary-preserving kernels to a unary function
+///
+/// For every kernel already registered in `func`, add a kernel accepting a
+/// dictionary of the same value type.  The function is applied to the
+/// dictionary values only and the output is a dictionary array sharing the
+/// input's indices.  This must only be used for functions whose output for
+/// a given input value does not depend on the value's position, e.g. string
+/// transforms such as "utf8_lower".
+void AddDictionaryTransformKernels(ScalarFunction* func);
+
+/// \brief Add dictionary-aware kernels to a unary or binary function
+///
+/// For every kernel already registered in `func`, and for every argument of
+/// that kernel, add a kernel accepting a dictionary of the same value type in
+/// that argument position.  When the other arguments are scalars, the function
+/// is evaluated on the dictionary values and its result is gathered through
+/// the dictionary indices, e.g. a boolean mask for predicates such as
+/// "match_substring" or "equal".  Otherwise the dictionary is decoded first.
+void AddDictionaryLookupKernels(ScalarFunction* func);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
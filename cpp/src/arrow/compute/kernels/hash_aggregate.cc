@@ -639,8 +639,8 @@ HashAggregateKernel MakeMinOrMaxKernel(HashAggregateFunction* min_max_func) {
     KernelInitArgs new_args{kernel, inputs, args.options};
     return kernel->init(ctx, new_args);
   };
-  kernel.signature =
-      KernelSignature::Make({InputType::Any(), Type::UINT32}, OutputType(FirstType));
+  kernel.signature = KernelSignature::Make({InputType::Any(), Type::UINT32},
+                                           OutputType(FirstAggregatedType));
   kernel.resize = HashAggregateResize;
   kernel.consume = HashAggregateConsume;
   kernel.merge = HashAggregateMerge;
@@ -2398,6 +2398,7 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(AddHashAggKernels({null(), boolean(), decimal128(1, 1), decimal256(1, 1),
                                  month_interval(), fixed_size_binary(1)},
                                 GroupedMinMaxFactory::Make, func.get()));
+    DCHECK_OK(func->AddKernel(MakeRunEndEncodedKernel(func.get())));
     min_max_func = func.get();
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
@@ -23,6 +23,7 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
@@ -30,6 +31,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow::compute::internal {
 
@@ -98,6 +100,23 @@ inline HashAggregateKernel MakeKernel(InputType argument_type, KernelInit init,
       std::move(init), ordered);
 }
 
+/// \brief Make a kernel accepting run-end encoded arguments of `func`
+///
+/// The kernel is initialized like the kernel of `func` for the value type of
+/// the argument, whose aggregator must visit its input through
+/// VisitGroupedValues.
+inline HashAggregateKernel MakeRunEndEncodedKernel(const HashAggregateFunction* func) {
+  auto init = [func](KernelContext* ctx,
+                     const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
+    std::vector<TypeHolder> inputs = args.inputs;
+    inputs[0] = GetAggregatedType(inputs[0]);
+    ARROW_ASSIGN_OR_RAISE(auto kernel, func->DispatchExact(inputs));
+    KernelInitArgs new_args{kernel, std::move(inputs), args.options};
+    return kernel->init(ctx, new_args);
+  };
+  return MakeKernel(InputType(Type::RUN_END_ENCODED), std::move(init));
+}
+
 inline HashAggregateKernel MakeUnaryKernel(KernelInit init) {
   return MakeKernel(KernelSignature::Make({InputType(Type::UINT32)},
                                           OutputType(ResolveGroupOutputType)),
@@ -149,11 +168,72 @@ struct GroupedValueTraits<BooleanType> {
   }
 };
 
+// Visit a run-end encoded array, reading the value of each run only once and
+// passing it along with the group id of every row in the run
+template <typename Type, typename RunEndCType, typename ConsumeValue,
+          typename ConsumeNull>
+Status VisitGroupedRuns(const ExecSpan& batch, ConsumeValue&& valid_func,
+                        ConsumeNull&& null_func) {
+  const ArraySpan& input = batch[0].array;
+  if (input.length == 0) {
+    return Status::OK();
+  }
+  auto g = batch[1].array.GetValues<uint32_t>(1);
+  const ::arrow::ree_util::RunEndEncodedArraySpan<RunEndCType> runs(input);
+  auto it = runs.begin();
+  ArraySpan values = ::arrow::ree_util::ValuesArray(input);
+  values.SetSlice(values.offset + it.index_into_array(),
+                  ::arrow::ree_util::FindPhysicalLength(input));
+  return VisitArrayValuesInline<Type>(
+      values,
+      [&](typename GetViewType<Type>::T val) {
+        for (int64_t i = it.run_length(); i > 0; --i) {
+          RETURN_NOT_OK(valid_func(*g++, val));
+        }
+        ++it;
+        return Status::OK();
+      },
+      [&]() {
+        for (int64_t i = it.run_length(); i > 0; --i) {
+          RETURN_NOT_OK(null_func(*g++));
+        }
+        ++it;
+        return Status::OK();
+      });
+}
+
+template <typename Type, typename ConsumeValue, typename ConsumeNull>
+Status VisitGroupedRuns(const ExecSpan& batch, ConsumeValue&& valid_func,
+                        ConsumeNull&& null_func) {
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*batch[0].type());
+  switch (ree_type.run_end_type()->id()) {
+    case ::arrow::Type::INT16:
+      return VisitGroupedRuns<Type, int16_t>(batch, valid_func, null_func);
+    case ::arrow::Type::INT32:
+      return VisitGroupedRuns<Type, int32_t>(batch, valid_func, null_func);
+    default:
+      return VisitGroupedRuns<Type, int64_t>(batch, valid_func, null_func);
+  }
+}
+
 template <typename Type, typename ConsumeValue, typename ConsumeNull>
 typename arrow::internal::call_traits::enable_if_return<ConsumeValue, void>::type
 VisitGroupedValues(const ExecSpan& batch, ConsumeValue&& valid_func,
                    ConsumeNull&& null_func) {
   auto g = batch[1].array.GetValues<uint32_t>(1);
+  if (batch[0].is_array() && batch[0].type()->id() == ::arrow::Type::RUN_END_ENCODED) {
+    DCHECK_OK(VisitGroupedRuns<Type>(
+        batch,
+        [&](uint32_t group, typename TypeTraits<Type>::CType val) {
+          valid_func(group, val);
+          return Status::OK();
+        },
+        [&](uint32_t group) {
+          null_func(group);
+          return Status::OK();
+        }));
+    return;
+  }
   if (batch[0].is_array()) {
     VisitArrayValuesInline<Type>(
         batch[0].array,
@@ -161,7 +241,7 @@ VisitGroupedValues(const ExecSpan& batch, ConsumeValue&& valid_func,
         [&]() { null_func(*g++); });
     return;
   }
-  const Scalar& input = *batch[0].scalar;
+  const Scalar& input = GetAggregatedScalar(*batch[0].scalar);
   if (input.is_valid) {
     const auto val = UnboxScalar<Type>::Unbox(input);
     for (int64_t i = 0; i < batch.length; i++) {
@@ -179,13 +259,16 @@ typename arrow::internal::call_traits::enable_if_return<ConsumeValue, Status>::t
 VisitGroupedValues(const ExecSpan& batch, ConsumeValue&& valid_func,
                    ConsumeNull&& null_func) {
   auto g = batch[1].array.GetValues<uint32_t>(1);
+  if (batch[0].is_array() && batch[0].type()->id() == ::arrow::Type::RUN_END_ENCODED) {
+    return VisitGroupedRuns<Type>(batch, valid_func, null_func);
+  }
   if (batch[0].is_array()) {
     return VisitArrayValuesInline<Type>(
         batch[0].array,
         [&](typename GetViewType<Type>::T val) { return valid_func(*g++, val); },
         [&]() { return null_func(*g++); });
   }
-  const Scalar& input = *batch[0].scalar;
+  const Scalar& input = GetAggregatedScalar(*batch[0].scalar);
   if (input.is_valid) {
     const auto val = UnboxScalar<Type>::Unbox(input);
     for (int64_t i = 0; i < batch.length; i++) {
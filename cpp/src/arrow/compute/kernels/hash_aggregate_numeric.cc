@@ -1162,6 +1162,7 @@ void RegisterHashAggregateNumeric(FunctionRegistry* registry) {
     DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
                                 GroupedSumFactory::Make, func.get()));
     DCHECK_OK(AddHashAggKernels({null()}, GroupedSumFactory::Make, func.get()));
+    DCHECK_OK(func->AddKernel(MakeRunEndEncodedKernel(func.get())));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1179,6 +1180,7 @@ void RegisterHashAggregateNumeric(FunctionRegistry* registry) {
     DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
                                 GroupedProductFactory::Make, func.get()));
     DCHECK_OK(AddHashAggKernels({null()}, GroupedProductFactory::Make, func.get()));
+    DCHECK_OK(func->AddKernel(MakeRunEndEncodedKernel(func.get())));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1194,6 +1196,7 @@ void RegisterHashAggregateNumeric(FunctionRegistry* registry) {
     DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
                                 GroupedMeanFactory::Make, func.get()));
     DCHECK_OK(AddHashAggKernels({null()}, GroupedMeanFactory::Make, func.get()));
+    DCHECK_OK(func->AddKernel(MakeRunEndEncodedKernel(func.get())));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
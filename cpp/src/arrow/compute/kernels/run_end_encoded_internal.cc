@@ -0,0 +1,309 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/run_end_encoded_internal.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/compute/kernels/wrapped_kernel_internal.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+namespace internal {
+
+namespace {
+
+void DecodeRunEndEncodedTypes(std::vector<TypeHolder>* types) {
+  for (TypeHolder& type : *types) {
+    if (type.id() == Type::RUN_END_ENCODED) {
+      type = checked_cast<const RunEndEncodedType&>(*type).value_type();
+    }
+  }
+}
+
+// The output uses the run end type of the first run-end encoded argument
+std::shared_ptr<DataType> GetRunEndType(const std::vector<TypeHolder>& types) {
+  for (const TypeHolder& type : types) {
+    if (type.id() == Type::RUN_END_ENCODED) {
+      return checked_cast<const RunEndEncodedType&>(*type).run_end_type();
+    }
+  }
+  DCHECK(false) << "No run-end encoded argument";
+  return NULLPTR;
+}
+
+Result<TypeHolder> ResolveRunEndEncodedOutput(KernelContext* ctx,
+                                              const std::vector<TypeHolder>& types) {
+  ARROW_ASSIGN_OR_RAISE(TypeHolder out_type, WrappedKernelState::GetOutputType(ctx));
+  return run_end_encoded(GetRunEndType(types), out_type.GetSharedPtr());
+}
+
+std::vector<TypeHolder> GetTypes(const ExecSpan& batch) {
+  std::vector<TypeHolder> types;
+  types.reserve(batch.num_values());
+  for (const ExecValue& value : batch.values) {
+    types.emplace_back(value.type());
+  }
+  return types;
+}
+
+Datum GetScalarArgument(const Scalar& scalar) {
+  if (scalar.type->id() == Type::RUN_END_ENCODED) {
+    return checked_cast<const RunEndEncodedScalar&>(scalar).value;
+  }
+  return scalar.GetSharedPtr();
+}
+
+// Decode all run-end encoded arguments, evaluate the wrapped kernel on them and
+// encode the result again
+Status ExecDecoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& state = WrappedKernelState::Get(ctx);
+  std::vector<Datum> args(batch.num_values());
+  for (int i = 0; i < batch.num_values(); ++i) {
+    const ExecValue& value = batch[i];
+    if (value.is_scalar()) {
+      args[i] = GetScalarArgument(*value.scalar);
+    } else if (value.type()->id() == Type::RUN_END_ENCODED) {
+      ARROW_ASSIGN_OR_RAISE(args[i],
+                            RunEndDecode(value.array.ToArrayData(), ctx->exec_context()));
+    } else {
+      args[i] = value.array.ToArrayData();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result, state.Execute(ctx, std::move(args), batch.length));
+  ARROW_ASSIGN_OR_RAISE(
+      result, RunEndEncode(result, RunEndEncodeOptions(GetRunEndType(GetTypes(batch))),
+                           ctx->exec_context()));
+  DCHECK(result.is_array());
+  out->value = result.array();
+  return Status::OK();
+}
+
+// A single run-end encoded array alongside scalars: evaluate the wrapped kernel
+// on the values of the runs and reuse the run ends
+Status ExecRuns(KernelContext* ctx, const ExecSpan& batch, int ree_index,
+                ExecResult* out) {
+  const auto& state = WrappedKernelState::Get(ctx);
+  const ArraySpan& ree_array = batch[ree_index].array;
+  const auto& ree_type = checked_cast<const RunEndEncodedType&>(*ree_array.type);
+  const auto run_end_type = GetRunEndType(GetTypes(batch));
+  if (!ree_type.run_end_type()->Equals(*run_end_type)) {
+    return ExecDecoded(ctx, batch, out);
+  }
+
+  const auto [physical_offset, physical_length] = ::arrow::ree_util::FindPhysicalRange(
+      ree_array, ree_array.offset, ree_array.length);
+  std::vector<Datum> args(batch.num_values());
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (i != ree_index) {
+      args[i] = GetScalarArgument(*batch[i].scalar);
+    }
+  }
+  args[ree_index] = ::arrow::ree_util::ValuesArray(ree_array).ToArrayData()->Slice(
+      physical_offset, physical_length);
+  ARROW_ASSIGN_OR_RAISE(Datum values,
+                        state.Execute(ctx, std::move(args), physical_length));
+  DCHECK(values.is_array());
+
+  // The run ends are kept as they are, so the output has the same logical
+  // offset as the input
+  auto run_ends = ::arrow::ree_util::RunEndsArray(ree_array).ToArrayData()->Slice(
+      physical_offset, physical_length);
+  out->value = ArrayData::Make(run_end_encoded(run_end_type, values.type()),
+                               ree_array.length, {NULLPTR},
+                               {std::move(run_ends), values.array()},
+                               /*null_count=*/0, ree_array.offset);
+  return Status::OK();
+}
+
+// The runs of two run-end encoded arrays, split wherever either of them ends a
+// run, along with the physical index of each merged run in both inputs
+template <typename OutRunEndCType>
+struct MergedRuns {
+  explicit MergedRuns(MemoryPool* pool)
+      : run_ends(pool), left_indices(pool), right_indices(pool) {}
+
+  template <typename LeftRunEndCType, typename RightRunEndCType>
+  Status MergeTyped(const ArraySpan& left, const ArraySpan& right) {
+    using LeftSpan = ::arrow::ree_util::RunEndEncodedArraySpan<LeftRunEndCType>;
+    using RightSpan = ::arrow::ree_util::RunEndEncodedArraySpan<RightRunEndCType>;
+    const LeftSpan left_span(left);
+    const RightSpan right_span(right);
+    ARROW_ASSIGN_OR_RAISE(
+        auto it, (::arrow::ree_util::MergedRunsIterator<LeftSpan, RightSpan>::MakeBegin(
+                     left_span, right_span)));
+    for (; !it.is_end(); ++it) {
+      RETURN_NOT_OK(run_ends.Append(static_cast<OutRunEndCType>(it.run_end())));
+      RETURN_NOT_OK(left_indices.Append(it.index_into_left_array()));
+      RETURN_NOT_OK(right_indices.Append(it.index_into_right_array()));
+    }
+    return Status::OK();
+  }
+
+  template <typename LeftRunEndCType>
+  Status Merge(const ArraySpan& left, const ArraySpan& right) {
+    const auto& right_type = checked_cast<const RunEndEncodedType&>(*right.type);
+    switch (right_type.run_end_type()->id()) {
+      case Type::INT16:
+        return MergeTyped<LeftRunEndCType, int16_t>(left, right);
+      case Type::INT32:
+        return MergeTyped<LeftRunEndCType, int32_t>(left, right);
+      default:
+        DCHECK_EQ(right_type.run_end_type()->id(), Type::INT64);
+        return MergeTyped<LeftRunEndCType, int64_t>(left, right);
+    }
+  }
+
+  TypedBufferBuilder<OutRunEndCType> run_ends;
+  TypedBufferBuilder<int64_t> left_indices;
+  TypedBufferBuilder<int64_t> right_indices;
+};
+
+// Gather the values of the merged runs from one of the inputs
+Result<Datum> GatherRunValues(KernelContext* ctx, const ArraySpan& ree_array,
+                              TypedBufferBuilder<int64_t>* indices) {
+  const int64_t num_runs = indices->length();
+  auto values = ::arrow::ree_util::ValuesArray(ree_array).ToArrayData();
+  if (num_runs > 0) {
+    // If no run of this input was split, the merged runs map to consecutive
+    // physical values and no gathering is necessary
+    const int64_t first = indices->data()[0];
+    if (indices->data()[num_runs - 1] - first == num_runs - 1) {
+      return values->Slice(first, num_runs);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer, indices->Finish());
+  auto indices_data =
+      ArrayData::Make(int64(), num_runs, {NULLPTR, std::move(indices_buffer)},
+                      /*null_count=*/0);
+  return Take(values, indices_data, TakeOptions::NoBoundsCheck(), ctx->exec_context());
+}
+
+template <typename OutRunEndCType>
+Status ExecMergedRuns(KernelContext* ctx, const ExecSpan& batch, int left_index,
+                      int right_index, ExecResult* out) {
+  const auto& state = WrappedKernelState::Get(ctx);
+  const ArraySpan& left = batch[left_index].array;
+  const ArraySpan& right = batch[right_index].array;
+
+  MergedRuns<OutRunEndCType> merged(ctx->memory_pool());
+  RETURN_NOT_OK(merged.template Merge<OutRunEndCType>(left, right));
+  const int64_t num_runs = merged.run_ends.length();
+
+  std::vector<Datum> args(batch.num_values());
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (i != left_index && i != right_index) {
+      args[i] = GetScalarArgument(*batch[i].scalar);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(args[left_index],
+                        GatherRunValues(ctx, left, &merged.left_indices));
+  ARROW_ASSIGN_OR_RAISE(args[right_index],
+                        GatherRunValues(ctx, right, &merged.right_indices));
+  ARROW_ASSIGN_OR_RAISE(Datum values, state.Execute(ctx, std::move(args), num_runs));
+  DCHECK(values.is_array());
+
+  const auto& run_end_type =
+      checked_cast<const RunEndEncodedType&>(*left.type).run_end_type();
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_buffer, merged.run_ends.Finish());
+  auto run_ends = ArrayData::Make(run_end_type, num_runs,
+                                  {NULLPTR, std::move(run_ends_buffer)},
+                                  /*null_count=*/0);
+  out->value = ArrayData::Make(run_end_encoded(run_end_type, values.type()),
+                               batch.length, {NULLPTR},
+                               {std::move(run_ends), values.array()},
+                               /*null_count=*/0);
+  return Status::OK();
+}
+
+Status RunEndEncodedExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  // Up to two run-end encoded arrays alongside scalars are evaluated run by
+  // run; anything else is decoded.
+  std::vector<int> ree_indices;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    const ExecValue& value = batch[i];
+    if (value.is_scalar()) continue;
+    if (value.type()->id() != Type::RUN_END_ENCODED) {
+      return ExecDecoded(ctx, batch, out);
+    }
+    ree_indices.push_back(i);
+  }
+  if (ree_indices.size() == 1) {
+    return ExecRuns(ctx, batch, ree_indices[0], out);
+  }
+  if (ree_indices.size() != 2) {
+    return ExecDecoded(ctx, batch, out);
+  }
+
+  // The output uses the run end type of the left input, which is large enough
+  // to represent the common logical length
+  const ArraySpan& left = batch[ree_indices[0]].array;
+  switch (checked_cast<const RunEndEncodedType&>(*left.type).run_end_type()->id()) {
+    case Type::INT16:
+      return ExecMergedRuns<int16_t>(ctx, batch, ree_indices[0], ree_indices[1], out);
+    case Type::INT32:
+      return ExecMergedRuns<int32_t>(ctx, batch, ree_indices[0], ree_indices[1], out);
+    default:
+      return ExecMergedRuns<int64_t>(ctx, batch, ree_indices[0], ree_indices[1], out);
+  }
+}
+
+}  // namespace
+
+void AddRunEndEncodedKernels(ScalarFunction* func) {
+  const Arity& arity = func->arity();
+  DCHECK(!arity.is_varargs);
+  DCHECK_LE(arity.num_args, 2);
+
+  // Add kernels accepting run-end encoded arrays in every combination of
+  // argument positions, starting with the most specific one
+  const int num_args = arity.num_args;
+  for (int mask = (1 << num_args) - 1; mask > 0; --mask) {
+    std::vector<InputType> in_types;
+    for (int i = 0; i < num_args; ++i) {
+      if (mask & (1 << i)) {
+        in_types.emplace_back(Type::RUN_END_ENCODED);
+      } else {
+        in_types.push_back(InputType::Any());
+      }
+    }
+    ScalarKernel kernel(std::move(in_types), OutputType(ResolveRunEndEncodedOutput),
+                        RunEndEncodedExec,
+                        MakeWrappedKernelInit(func, DecodeRunEndEncodedTypes));
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    kernel.can_write_into_slices = false;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
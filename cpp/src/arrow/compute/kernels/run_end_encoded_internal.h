@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+// Helpers to evaluate scalar functions on run-end encoded inputs without
+// decoding them.
+//
+// The kernels added by these helpers dispatch the function again on the
+// value types of the run-end encoded arguments when they are initialized and
+// then evaluate that kernel once per run instead of once per logical value.
+
+#include "arrow/compute/function.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+/// \brief Add run-end encoded kernels to a unary or binary function
+///
+/// The added kernels accept a run-end encoded array in any argument position
+/// and output a run-end encoded array.  When the other arguments are scalars,
+/// the function is evaluated on the values of the runs and the output shares
+/// the input's run ends.  Two run-end encoded arrays are aligned by splitting
+/// their runs wherever either of them ends a run.  Anything else is decoded
+/// first.
+///
+/// This must only be used for functions whose output for a given row only
+/// depends on the input values of that row, e.g. "add" or "equal".
+void AddRunEndEncodedKernels(ScalarFunction* func);
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
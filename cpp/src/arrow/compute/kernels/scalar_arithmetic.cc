@@ -28,6 +28,7 @@
 #include "arrow/compute/kernels/base_arithmetic_internal.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/run_end_encoded_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
@@ -877,6 +878,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -891,6 +893,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionNotNull(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -903,6 +906,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunction(std::string name,
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -925,6 +929,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionWithFixedIntOutType(
     DCHECK_OK(func->AddKernel({InputType(Type::DECIMAL256)}, int64(), exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -939,6 +944,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionNotNull(std::string n
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -955,6 +961,7 @@ std::shared_ptr<ScalarFunction> MakeUnarySignedArithmeticFunctionNotNull(
     }
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -967,6 +974,7 @@ std::shared_ptr<ScalarFunction> MakeBitWiseFunctionNotNull(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -979,6 +987,7 @@ std::shared_ptr<ScalarFunction> MakeShiftFunctionNotNull(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -991,6 +1000,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionFloatingPoint(
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -1004,6 +1014,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionFloatingPointNotNull(
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -1017,6 +1028,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionFloatingPoint(std::string
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -1031,6 +1043,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionFloatingPointNotNull(
     DCHECK_OK(func->AddKernel({ty, ty}, output, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -1158,6 +1158,26 @@ TEST(TestBinaryArithmetic, AddWithImplicitCastsUint64EdgeCase) {
                                      ArrayFromJSON(uint64(), "[18446744073709551615]")}));
 }
 
+TEST(TestBinaryArithmetic, RunEndEncodedInput) {
+  auto left = ArrayFromJSON(int32(), "[1, 1, 1, null, null, 5, 5, -2, 7, 7, 7]");
+  auto right = ArrayFromJSON(int32(), "[2, 2, 3, 3, 3, 3, 4, 4, null, 4, 9]");
+  for (std::string name : {"add", "subtract", "multiply"}) {
+    for (std::string suffix : {"", "_checked"}) {
+      name += suffix;
+      ARROW_SCOPED_TRACE("name = ", name);
+      CheckRunEndEncoded(name, {left, ScalarFromJSON(int32(), "3")});
+      CheckRunEndEncoded(name, {ScalarFromJSON(int32(), "3"), left});
+      CheckRunEndEncoded(name, {left, ScalarFromJSON(int32(), "null")});
+      CheckRunEndEncoded(name, {left, ScalarFromJSON(float64(), "0.5")});
+      CheckRunEndEncoded(name, {left, right});
+    }
+  }
+  // Errors raised on the values of the runs are propagated
+  ASSERT_OK_AND_ASSIGN(auto encoded, RunEndEncode(left, RunEndEncodeOptions()));
+  ASSERT_RAISES(Invalid,
+                CallFunction("divide", {encoded, ScalarFromJSON(int32(), "0")}));
+}
+
 TEST(TestUnaryArithmetic, DispatchBest) {
   // All types (with _checked variant)
   for (std::string name : {"abs"}) {
@@ -1246,6 +1266,14 @@ TEST(TestUnaryArithmetic, Null) {
   }
 }
 
+TEST(TestUnaryArithmetic, RunEndEncodedInput) {
+  auto values = ArrayFromJSON(float64(), "[1, 1, 1, null, null, 4, 4, -2, 9, 9]");
+  for (std::string name : {"abs", "negate", "sign", "sqrt", "exp"}) {
+    ARROW_SCOPED_TRACE("name = ", name);
+    CheckRunEndEncoded(name, {values});
+  }
+}
+
 TYPED_TEST(TestUnaryArithmeticSigned, Negate) {
   using CType = typename TestFixture::CType;
 
@@ -312,13 +312,41 @@ struct ParseString {
   }
 };
 
+// Parse offset-based strings in a single pass over the offsets and data buffers,
+// only going through ParseString to build the error for the first invalid value.
+template <typename O, typename I>
+Status ParseStrings(KernelContext* ctx, const ArraySpan& input, ExecResult* out) {
+  using offset_type = typename I::offset_type;
+  using OutValue = typename O::c_type;
+
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  const uint8_t* data = input.buffers[2].data;
+  const int64_t failed_index = ::arrow::internal::ParseValues(
+      checked_cast<const O&>(*out->type()), offsets, data, input.buffers[0].data,
+      input.offset, input.length, out->array_span_mutable()->GetValues<OutValue>(1));
+  if (ARROW_PREDICT_TRUE(failed_index == input.length)) {
+    return Status::OK();
+  }
+  Status st;
+  const auto failed_value = std::string_view(
+      reinterpret_cast<const char*>(data) + offsets[failed_index],
+      static_cast<size_t>(offsets[failed_index + 1] - offsets[failed_index]));
+  ParseString<O>{}.template Call<OutValue>(ctx, failed_value, &st);
+  DCHECK(!st.ok());
+  return st;
+}
+
 template <typename O, typename I>
 struct CastFunctor<
     O, I,
     enable_if_t<(is_number_type<O>::value && (is_base_binary_type<I>::value ||
                                               is_binary_view_like_type<I>::value))>> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    return applicator::ScalarUnaryNotNull<O, I, ParseString<O>>::Exec(ctx, batch, out);
+    if constexpr (is_base_binary_type<I>::value) {
+      return ParseStrings<O, I>(ctx, batch[0].array, out);
+    } else {
+      return applicator::ScalarUnaryNotNull<O, I, ParseString<O>>::Exec(ctx, batch, out);
+    }
   }
 };
 
@@ -445,11 +445,37 @@ struct ParseTimestamp {
 
 template <typename I>
 struct CastFunctor<TimestampType, I, enable_if_t<is_base_binary_type<I>::value>> {
+  using offset_type = typename I::offset_type;
+
+  // Parse all strings in a single pass over the offsets and data buffers, only
+  // going through ParseTimestamp to build the error for the first invalid value.
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     const auto& out_type = checked_cast<const TimestampType&>(*out->type());
-    applicator::ScalarUnaryNotNullStateful<TimestampType, I, ParseTimestamp> kernel(
-        ParseTimestamp{out_type});
-    return kernel.Exec(ctx, batch, out);
+    const ArraySpan& input = batch[0].array;
+    const offset_type* offsets = input.GetValues<offset_type>(1);
+    const uint8_t* data = input.buffers[2].data;
+
+    const TimeUnit::type unit = out_type.unit();
+    const bool expect_timezone = !out_type.timezone().empty();
+    const int64_t failed_index = ::arrow::internal::ParseBinaryValues(
+        offsets, data, input.buffers[0].data, input.offset, input.length,
+        out->array_span_mutable()->GetValues<int64_t>(1),
+        [&](const char* s, size_t length, int64_t* value_out) {
+          bool zone_offset_present = false;
+          return ParseTimestampISO8601(s, length, unit, value_out,
+                                       &zone_offset_present) &&
+                 zone_offset_present == expect_timezone;
+        });
+    if (ARROW_PREDICT_TRUE(failed_index == input.length)) {
+      return Status::OK();
+    }
+    Status st;
+    const auto failed_value = std::string_view(
+        reinterpret_cast<const char*>(data) + offsets[failed_index],
+        static_cast<size_t>(offsets[failed_index + 1] - offsets[failed_index]));
+    ParseTimestamp{out_type}.Call<int64_t>(ctx, failed_value, &st);
+    DCHECK(!st.ok());
+    return st;
   }
 };
 
@@ -3105,6 +3105,14 @@ TEST(Cast, StringToInt) {
       auto options = CastOptions::Safe(uint8());
       CheckCastFails(ArrayFromJSON(string_type, "[\"" + not_uint8 + "\"]"), options);
     }
+
+    // The first invalid value is reported, null slots are not parsed
+    auto strings = ArrayFromJSON(
+        string_type, R"(["1", "x", "123456789", null, "12345678901234567z", "y"])");
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr("Failed to parse string: '12345678901234567z'"),
+        Cast(strings->Slice(2), CastOptions::Safe(int64())));
+    CheckCast(strings->Slice(2, 2), ArrayFromJSON(int64(), "[123456789, null]"));
   }
 }
 
@@ -22,7 +22,10 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/dictionary_internal.h"
+#include "arrow/compute/kernels/run_end_encoded_internal.h"
 #include "arrow/type.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging_internal.h"
@@ -310,6 +313,72 @@ struct CompareTimestamps {
   }
 };
 
+// Binary views are compared on their size and inline prefix first, so that
+// most comparisons are decided without dereferencing the data buffers
+template <typename Op>
+struct CompareBinaryViews {
+  using c_type = BinaryViewType::c_type;
+
+  static bool Compare(const c_type& left, const c_type& right,
+                      const std::shared_ptr<Buffer>* left_buffers,
+                      const std::shared_ptr<Buffer>* right_buffers) {
+    if constexpr (std::is_same<Op, Equal>::value) {
+      return ::arrow::util::EqualBinaryView(left, right, left_buffers, right_buffers);
+    } else if constexpr (std::is_same<Op, NotEqual>::value) {
+      return !::arrow::util::EqualBinaryView(left, right, left_buffers, right_buffers);
+    } else {
+      const int cmp =
+          ::arrow::util::CompareBinaryView(left, right, left_buffers, right_buffers);
+      return Op::template Call<bool, int, int>(nullptr, cmp, 0, nullptr);
+    }
+  }
+
+  // A scalar is compared as a single view into its own value buffer
+  struct Operand {
+    const ArraySpan* array = nullptr;
+    const c_type* views;
+    const std::shared_ptr<Buffer>* buffers;
+    c_type scalar_view;
+
+    explicit Operand(const ExecValue& value) {
+      if (value.is_array()) {
+        array = &value.array;
+        views = value.array.GetValues<c_type>(1);
+        buffers = value.array.GetVariadicBuffers().data();
+      } else {
+        const auto& scalar = checked_cast<const BaseBinaryScalar&>(*value.scalar);
+        scalar_view = scalar.is_valid ? ::arrow::util::ToBinaryView(
+                                            scalar.value->data(),
+                                            static_cast<int32_t>(scalar.value->size()),
+                                            /*buffer_index=*/0, /*offset=*/0)
+                                      : c_type{};
+        views = &scalar_view;
+        buffers = &scalar.value;
+      }
+    }
+
+    // The views of null slots may be arbitrary and must not be dereferenced
+    bool IsValid(int64_t i) const { return array == nullptr || array->IsValid(i); }
+
+    const c_type& View(int64_t i) const { return array ? views[i] : scalar_view; }
+  };
+
+  static Status Exec(KernelContext*, const ExecSpan& batch, ExecResult* out) {
+    const Operand left(batch[0]), right(batch[1]);
+    ArraySpan* out_arr = out->array_span_mutable();
+    int64_t i = 0;
+    ::arrow::internal::GenerateBitsUnrolled(
+        out_arr->buffers[1].data, out_arr->offset, batch.length, [&]() {
+          const bool result =
+              left.IsValid(i) && right.IsValid(i) &&
+              Compare(left.View(i), right.View(i), left.buffers, right.buffers);
+          ++i;
+          return result;
+        });
+    return Status::OK();
+  }
+};
+
 template <typename Op>
 ScalarKernel GetCompareKernel(InputType ty, Type::type compare_type,
                               ArrayKernelExec exec) {
@@ -433,6 +502,10 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), CompareBinaryViews<Op>::Exec));
+  }
+
   for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
     auto exec = GenerateDecimal<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(id);
     DCHECK_OK(
@@ -893,9 +966,8 @@ const FunctionDoc max_element_wise_doc{
 }  // namespace
 
 void RegisterScalarComparison(FunctionRegistry* registry) {
-  DCHECK_OK(registry->AddFunction(MakeCompareFunction<Equal>("equal", equal_doc)));
-  DCHECK_OK(
-      registry->AddFunction(MakeCompareFunction<NotEqual>("not_equal", not_equal_doc)));
+  auto equal = MakeCompareFunction<Equal>("equal", equal_doc);
+  auto not_equal = MakeCompareFunction<NotEqual>("not_equal", not_equal_doc);
 
   auto greater = MakeCompareFunction<Greater>("greater", greater_doc);
   auto greater_equal =
@@ -903,6 +975,18 @@ void RegisterScalarComparison(FunctionRegistry* registry) {
 
   auto less = MakeFlippedCompare("less", *greater, less_doc);
   auto less_equal = MakeFlippedCompare("less_equal", *greater_equal, less_equal_doc);
+
+  // Comparing a dictionary against a scalar only needs to compare the
+  // dictionary values
+  for (auto* func :
+       {equal.get(), not_equal.get(), greater.get(), greater_equal.get(), less.get(),
+        less_equal.get()}) {
+    AddDictionaryLookupKernels(func);
+    AddRunEndEncodedKernels(func);
+  }
+
+  DCHECK_OK(registry->AddFunction(std::move(equal)));
+  DCHECK_OK(registry->AddFunction(std::move(not_equal)));
   DCHECK_OK(registry->AddFunction(std::move(less)));
   DCHECK_OK(registry->AddFunction(std::move(less_equal)));
   DCHECK_OK(registry->AddFunction(std::move(greater)));
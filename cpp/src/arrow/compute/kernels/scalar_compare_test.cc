@@ -983,8 +983,9 @@ TEST(TestCompareKernel, DispatchBest) {
     CheckDispatchBest(name, {float32(), int64()}, {float32(), float32()});
     CheckDispatchBest(name, {float64(), int32()}, {float64(), float64()});
 
+    // Dictionaries compared against their value type are not decoded
     CheckDispatchBest(name, {dictionary(int8(), float64()), float64()},
-                      {float64(), float64()});
+                      {dictionary(int8(), float64()), float64()});
     CheckDispatchBest(name, {dictionary(int8(), float64()), int16()},
                       {float64(), float64()});
 
@@ -1049,6 +1050,69 @@ TEST(TestCompareKernel, GreaterWithImplicitCasts) {
                     ArrayFromJSON(boolean(), "[false, false, false, null]"));
 }
 
+TEST(TestCompareKernel, DictionaryEncodedInput) {
+  for (const auto& index_type : {int8(), uint32()}) {
+    auto strings = DictArrayFromJSON(dictionary(index_type, utf8()),
+                                     "[0, 1, null, 2, 1, 0]", R"(["b", "a", null])");
+    auto numbers = DictArrayFromJSON(dictionary(index_type, int64()),
+                                     "[2, null, 0, 1, 1]", "[10, 20, 30]");
+    for (std::string name :
+         {"equal", "not_equal", "less", "less_equal", "greater", "greater_equal"}) {
+      ARROW_SCOPED_TRACE("name = ", name, ", index_type = ", *index_type);
+      CheckDictionary(name, {strings, ScalarFromJSON(utf8(), R"("a")")},
+                      /*result_is_encoded=*/false);
+      CheckDictionary(name, {ScalarFromJSON(utf8(), R"("a")"), strings},
+                      /*result_is_encoded=*/false);
+      CheckDictionary(name, {strings, ScalarFromJSON(utf8(), "null")},
+                      /*result_is_encoded=*/false);
+      CheckDictionary(name, {numbers, ScalarFromJSON(int64(), "20")},
+                      /*result_is_encoded=*/false);
+      // Not evaluated on the dictionary, but still supported
+      auto other = ArrayFromJSON(utf8(), R"(["a", "b", "c", "a", "a", null])");
+      CheckDictionary(name, {strings, other}, /*result_is_encoded=*/false);
+    }
+  }
+}
+
+TEST(TestCompareKernel, RunEndEncodedInput) {
+  auto numbers = ArrayFromJSON(int64(), "[1, 1, 1, null, null, 5, 5, 2, 7, 7, 7]");
+  auto others = ArrayFromJSON(int64(), "[1, 1, 3, 3, 3, 3, 5, 5, null, 7, 8]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "a", "b", "b", null, "c", "c"])");
+  for (std::string name :
+       {"equal", "not_equal", "less", "less_equal", "greater", "greater_equal"}) {
+    ARROW_SCOPED_TRACE("name = ", name);
+    CheckRunEndEncoded(name, {numbers, ScalarFromJSON(int64(), "5")});
+    CheckRunEndEncoded(name, {ScalarFromJSON(int64(), "5"), numbers});
+    CheckRunEndEncoded(name, {numbers, ScalarFromJSON(int64(), "null")});
+    // Implicit casts apply to the values of the runs
+    CheckRunEndEncoded(name, {numbers, ScalarFromJSON(float64(), "1.5")});
+    CheckRunEndEncoded(name, {strings, ScalarFromJSON(utf8(), R"("b")")});
+    CheckRunEndEncoded(name, {numbers, others});
+  }
+}
+
+TEST(TestCompareKernel, BinaryViewInput) {
+  // Values sharing their prefix or exceeding the inline size of views
+  auto lhs = ArrayFromJSON(utf8(), R"(["a", "abcd", "abcde", "a long string value",
+                                       null, "", "abcdefghijklmn"])");
+  auto rhs = ArrayFromJSON(utf8(), R"(["b", "abcd", "abcdf", "a long string valuf",
+                                       "a", null, "abcdefghijklmn"])");
+  auto long_scalar = ScalarFromJSON(utf8(), R"("a long string value")");
+  for (const auto& view_type : {utf8_view(), binary_view()}) {
+    ASSERT_OK_AND_ASSIGN(Datum lhs_view, Cast(lhs, view_type));
+    ASSERT_OK_AND_ASSIGN(Datum rhs_view, Cast(rhs, view_type));
+    ASSERT_OK_AND_ASSIGN(auto scalar_view, Cast(long_scalar, view_type));
+    for (std::string name :
+         {"equal", "not_equal", "less", "less_equal", "greater", "greater_equal"}) {
+      ARROW_SCOPED_TRACE("name = ", name, ", type = ", view_type->ToString());
+      ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(name, {lhs, rhs}));
+      CheckScalar(name, {lhs_view, rhs_view}, expected);
+      ASSERT_OK_AND_ASSIGN(expected, CallFunction(name, {lhs, long_scalar}));
+      CheckScalar(name, {lhs_view, scalar_view}, expected);
+    }
+  }
+}
+
 TEST(TestCompareKernel, GreaterWithImplicitCastsUint64EdgeCase) {
   // int64 is as wide as we can promote
   CheckDispatchBest("greater", {int8(), uint64()}, {int64(), int64()});
@@ -15,14 +15,22 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "arrow/array/array_base.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/dictionary_internal.h"
+#include "arrow/compute/kernels/scalar_set_lookup_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/visit_data_inline.h"
@@ -36,10 +44,27 @@ namespace compute::internal {
 namespace {
 
 // This base class enables non-templated access to the value set type
-struct SetLookupStateBase : public KernelState {
+struct SetLookupStateBase {
+  virtual ~SetLookupStateBase() = default;
+
   std::shared_ptr<DataType> value_set_type;
 };
 
+// Kernel state pointing to a lookup state, which may be shared with other
+// kernel invocations (see GetSetLookupState)
+struct SetLookupKernelState : public KernelState {
+  explicit SetLookupKernelState(std::shared_ptr<const SetLookupStateBase> state)
+      : lookup_state(std::move(state)) {}
+
+  std::shared_ptr<const SetLookupStateBase> lookup_state;
+};
+
+template <typename StateType = SetLookupStateBase>
+const StateType& GetLookupState(KernelContext* ctx) {
+  return checked_cast<const StateType&>(
+      *checked_cast<const SetLookupKernelState&>(*ctx->state()).lookup_state);
+}
+
 template <typename Type>
 struct SetLookupState : public SetLookupStateBase {
   explicit SetLookupState(MemoryPool* pool) : memory_pool(pool) {}
@@ -72,10 +97,24 @@ struct SetLookupState : public SetLookupStateBase {
         lookup_table->GetNull() >= 0) {
       null_index = memo_index_to_value_index[lookup_table->GetNull()];
     }
+    if constexpr (kIsUnsignedInteger) {
+      use_small_integer_index = small_integer_index.Init(distinct_values);
+      distinct_values = {};
+    }
     value_set_type = options.value_set.type();
     return Status::OK();
   }
 
+  // Return the memo index of the value, or -1 if not found
+  int32_t Lookup(typename GetViewType<Type>::T v) const {
+    if constexpr (kIsUnsignedInteger) {
+      if (use_small_integer_index) {
+        return small_integer_index.Get(v);
+      }
+    }
+    return lookup_table->Get(v);
+  }
+
   Status AddArrayValueSet(const SetLookupOptions& options, const ArrayData& data,
                           int64_t start_index = 0) {
     using T = typename GetViewType<Type>::T;
@@ -90,6 +129,9 @@ struct SetLookupState : public SetLookupStateBase {
       auto on_not_found = [&, memo_size](int32_t memo_index) {
         DCHECK_EQ(memo_index, memo_size);
         memo_index_to_value_index.push_back(index);
+        if constexpr (kIsUnsignedInteger) {
+          distinct_values.emplace_back(v, memo_index);
+        }
       };
       RETURN_NOT_OK(lookup_table->GetOrInsert(
           v, std::move(on_found), std::move(on_not_found), &unused_memo_index));
@@ -113,8 +155,16 @@ struct SetLookupState : public SetLookupStateBase {
     return VisitArraySpanInline<Type>(data, visit_valid, visit_null);
   }
 
+  // Integer types are mapped to unsigned ones by InitStateVisitor
+  static constexpr bool kIsUnsignedInteger = is_integer_type<Type>::value;
+
   using MemoTable = typename HashTraits<Type>::MemoTableType;
   std::optional<MemoTable> lookup_table;  // use optional for delayed initialization
+  // For integer value sets, used instead of lookup_table when applicable
+  SmallIntegerSetIndex<typename GetViewType<Type>::T> small_integer_index;
+  bool use_small_integer_index = false;
+  // Distinct values and their memo indices, only kept while building
+  std::vector<std::pair<typename GetViewType<Type>::T, int32_t>> distinct_values;
   MemoryPool* memory_pool;
   // When there are duplicates in value_set, the MemoTable indices must
   // be mapped back to indices in the value_set.
@@ -168,7 +218,7 @@ struct InitStateVisitor {
   KernelContext* ctx;
   SetLookupOptions options;
   TypeHolder arg_type;
-  std::unique_ptr<KernelState> result;
+  std::shared_ptr<SetLookupStateBase> result;
 
   InitStateVisitor(KernelContext* ctx, const KernelInitArgs& args)
       : ctx(ctx),
@@ -177,9 +227,11 @@ struct InitStateVisitor {
 
   template <typename Type>
   Status Init() {
-    using StateType = SetLookupState<Type>;
-    result.reset(new StateType(ctx->exec_context()->memory_pool()));
-    return static_cast<StateType*>(result.get())->Init(options);
+    auto state =
+        std::make_shared<SetLookupState<Type>>(ctx->exec_context()->memory_pool());
+    RETURN_NOT_OK(state->Init(options));
+    result = std::move(state);
+    return Status::OK();
   }
 
   Status Visit(const DataType&) { return Init<NullType>(); }
@@ -202,6 +254,11 @@ struct InitStateVisitor {
     return Init<typename Type::PhysicalType>();
   }
 
+  template <typename Type>
+  enable_if_binary_view_like<Type, Status> Visit(const Type&) {
+    return Init<BinaryViewType>();
+  }
+
   // Handle Decimal128Type, FixedSizeBinaryType
   Status Visit(const FixedSizeBinaryType& type) { return Init<FixedSizeBinaryType>(); }
 
@@ -209,7 +266,7 @@ struct InitStateVisitor {
     return Init<MonthDayNanoIntervalType>();
   }
 
-  Result<std::unique_ptr<KernelState>> GetResult() {
+  Result<std::shared_ptr<const SetLookupStateBase>> GetResult() {
     if (arg_type.id() == Type::TIMESTAMP &&
         options.value_set.type()->id() == Type::TIMESTAMP) {
       // Other types will fail when casting, so no separate check is needed
@@ -257,6 +314,65 @@ struct InitStateVisitor {
   }
 };
 
+constexpr int32_t kSetLookupCacheCapacity = 16;
+
+// Building the lookup table from a large value set can cost more than looking
+// up a batch of values, and the same value set is typically used for many
+// batches (for example a filter applied to every fragment of a dataset).
+// Lookup states are immutable once built, so they are shared between kernel
+// invocations and threads.
+//
+// The value set is identified by the address of its data, and a cache entry is
+// only reused while the value set it was built from is alive.  Entries of value
+// sets that are gone are dropped on every access, rather than keeping their
+// states alive until evicted.  States are only cached when allocated from the
+// default memory pool, as they can outlive the calling context.
+Result<std::shared_ptr<const SetLookupStateBase>> GetSetLookupState(
+    KernelContext* ctx, const KernelInitArgs& args) {
+  const auto& options = checked_cast<const SetLookupOptions&>(*args.options);
+  std::shared_ptr<void> value_set;
+  if (options.value_set.is_array()) {
+    value_set = options.value_set.array();
+  } else if (options.value_set.kind() == Datum::CHUNKED_ARRAY) {
+    value_set = options.value_set.chunked_array();
+  }
+  const std::string& arg_fingerprint = args.inputs[0].type->fingerprint();
+  if (value_set == nullptr || arg_fingerprint.empty() ||
+      ctx->exec_context()->memory_pool() != default_memory_pool()) {
+    return InitStateVisitor{ctx, args}.GetResult();
+  }
+
+  struct CacheEntry {
+    std::weak_ptr<void> value_set;
+    std::shared_ptr<const SetLookupStateBase> state;
+  };
+  static std::mutex mutex;
+  static ::arrow::internal::LruCache<std::string, CacheEntry> cache(
+      kSetLookupCacheCapacity);
+
+  std::string key = std::to_string(reinterpret_cast<uintptr_t>(value_set.get()));
+  key += ':';
+  key += std::to_string(static_cast<int>(options.GetNullMatchingBehavior()));
+  key += ':';
+  key += arg_fingerprint;
+  auto is_expired = [](const CacheEntry& entry) { return entry.value_set.expired(); };
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    cache.EraseIf(is_expired);
+    const CacheEntry* entry = cache.Find(key);
+    if (entry != nullptr) {
+      return entry->state;
+    }
+  }
+  // Build without holding the lock.  Concurrent callers may build the same
+  // state, in which case the last one wins.
+  ARROW_ASSIGN_OR_RAISE(auto state, (InitStateVisitor{ctx, args}.GetResult()));
+  std::lock_guard<std::mutex> lock(mutex);
+  cache.EraseIf(is_expired);
+  cache.Replace(std::move(key), CacheEntry{std::move(value_set), state});
+  return state;
+}
+
 Result<std::unique_ptr<KernelState>> InitSetLookup(KernelContext* ctx,
                                                    const KernelInitArgs& args) {
   if (args.options == nullptr) {
@@ -264,7 +380,8 @@ Result<std::unique_ptr<KernelState>> InitSetLookup(KernelContext* ctx,
         "Attempted to call a set lookup function without SetLookupOptions");
   }
 
-  return InitStateVisitor{ctx, args}.GetResult();
+  ARROW_ASSIGN_OR_RAISE(auto state, GetSetLookupState(ctx, args));
+  return std::make_unique<SetLookupKernelState>(std::move(state));
 }
 
 struct IndexInVisitor {
@@ -282,7 +399,7 @@ struct IndexInVisitor {
   }
 
   Status Visit(const NullType&) {
-    const auto& state = checked_cast<const SetLookupState<NullType>&>(*ctx->state());
+    const auto& state = GetLookupState<SetLookupState<NullType>>(ctx);
 
     if (data.length != 0) {
       bit_util::SetBitsTo(out_bitmap, out->offset, out->length,
@@ -304,7 +421,7 @@ struct IndexInVisitor {
     VisitArraySpanInline<Type>(
         input,
         [&](T v) {
-          int32_t index = state.lookup_table->Get(v);
+          int32_t index = state.Lookup(v);
           if (index != -1) {
             bitmap_writer.Set();
 
@@ -337,7 +454,7 @@ struct IndexInVisitor {
 
   template <typename Type>
   Status ProcessIndexIn() {
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    const auto& state = GetLookupState<SetLookupState<Type>>(ctx);
     if (!data.type->Equals(state.value_set_type)) {
       auto materialized_input = data.ToArrayData();
       auto cast_result = Cast(*materialized_input, state.value_set_type,
@@ -374,6 +491,11 @@ struct IndexInVisitor {
     return ProcessIndexIn<typename Type::PhysicalType>();
   }
 
+  template <typename Type>
+  enable_if_binary_view_like<Type, Status> Visit(const Type&) {
+    return ProcessIndexIn<BinaryViewType>();
+  }
+
   // Handle Decimal128Type, FixedSizeBinaryType
   Status Visit(const FixedSizeBinaryType& type) {
     return ProcessIndexIn<FixedSizeBinaryType>();
@@ -384,7 +506,7 @@ struct IndexInVisitor {
   }
 
   Status Execute() {
-    const auto& state = checked_cast<const SetLookupStateBase&>(*ctx->state());
+    const auto& state = GetLookupState(ctx);
     return VisitTypeInline(*state.value_set_type, this);
   }
 };
@@ -414,7 +536,7 @@ struct IsInVisitor {
   }
 
   Status Visit(const NullType&) {
-    const auto& state = checked_cast<const SetLookupState<NullType>&>(*ctx->state());
+    const auto& state = GetLookupState<SetLookupState<NullType>>(ctx);
 
     if (state.null_matching_behavior == SetLookupOptions::MATCH &&
         state.value_set_has_null) {
@@ -440,7 +562,7 @@ struct IsInVisitor {
     VisitArraySpanInline<Type>(
         input,
         [&](T v) {
-          if (state.lookup_table->Get(v) != -1) {  // true
+          if (state.Lookup(v) != -1) {  // true
             writer_boolean.Set();
             writer_null.Set();
           } else if (state.null_matching_behavior == SetLookupOptions::INCONCLUSIVE &&
@@ -478,7 +600,7 @@ struct IsInVisitor {
 
   template <typename Type>
   Status ProcessIsIn() {
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    const auto& state = GetLookupState<SetLookupState<Type>>(ctx);
 
     if (!data.type->Equals(state.value_set_type)) {
       auto materialized_input = data.ToArrayData();
@@ -515,6 +637,11 @@ struct IsInVisitor {
     return ProcessIsIn<typename Type::PhysicalType>();
   }
 
+  template <typename Type>
+  enable_if_binary_view_like<Type, Status> Visit(const Type&) {
+    return ProcessIsIn<BinaryViewType>();
+  }
+
   // Handle Decimal128Type, FixedSizeBinaryType
   Status Visit(const FixedSizeBinaryType& type) {
     return ProcessIsIn<FixedSizeBinaryType>();
@@ -525,7 +652,7 @@ struct IsInVisitor {
   }
 
   Status Execute() {
-    const auto& state = checked_cast<const SetLookupStateBase&>(*ctx->state());
+    const auto& state = GetLookupState(ctx);
     return VisitTypeInline(*state.value_set_type, this);
   }
 };
@@ -540,7 +667,7 @@ Status ExecIsIn(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
 // * Boolean
 // * Numeric
 // * Simple temporal types (date, time, timestamp)
-// * Base binary types
+// * Base binary and binary view types
 // * Decimal
 
 void AddBasicSetLookupKernels(ScalarKernel kernel,
@@ -554,6 +681,7 @@ void AddBasicSetLookupKernels(ScalarKernel kernel,
   };
 
   AddKernels(BaseBinaryTypes());
+  AddKernels(BinaryViewTypes());
   AddKernels(NumericTypes());
   AddKernels(TemporalTypes());
   AddKernels(DurationTypes());
@@ -636,6 +764,11 @@ struct SetLookupFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
   Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values) const override {
+    RETURN_NOT_OK(CheckArity(values->size()));
+
+    using arrow::compute::detail::DispatchExactImpl;
+    if (auto kernel = DispatchExactImpl(this, *values)) return kernel;
+
     EnsureDictionaryDecoded(values);
     return DispatchExact(*values);
   }
@@ -656,6 +789,7 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     isin_base.signature = KernelSignature::Make({null()}, boolean());
     DCHECK_OK(is_in->AddKernel(isin_base));
+    AddDictionaryLookupKernels(is_in.get());
     DCHECK_OK(registry->AddFunction(is_in));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IsInMetaBinary>()));
@@ -674,6 +808,7 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     index_in_base.signature = KernelSignature::Make({null()}, int32());
     DCHECK_OK(index_in->AddKernel(index_in_base));
+    AddDictionaryLookupKernels(index_in.get());
     DCHECK_OK(registry->AddFunction(index_in));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IndexInMetaBinary>()));
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace arrow::compute::internal {
+
+// Lookup structure for unsigned integer value sets that avoids hashing:
+// tiny sets are scanned without branches, and sets covering a dense range
+// index a direct table by the value offset, which is a perfect hash.
+//
+// Signed integers are looked up by their unsigned bit patterns, so the range
+// is also measured with the sign bit flipped, which orders them numerically.
+template <typename T>
+class SmallIntegerSetIndex {
+ public:
+  static constexpr int64_t kMaxScanSize = 8;
+  static constexpr uint64_t kMinDenseTableSize = 1024;
+
+  // Build from the distinct values of the set and their memo indices.
+  // Return false if the set is neither tiny nor dense.
+  bool Init(const std::vector<std::pair<T, int32_t>>& entries) {
+    static_assert(std::is_unsigned_v<T>);
+    const auto num_entries = static_cast<int64_t>(entries.size());
+    if (num_entries == 0) {
+      return false;
+    }
+    if (num_entries <= kMaxScanSize) {
+      // Pad with copies of the first entry so that all slots can be compared
+      for (int64_t i = 0; i < kMaxScanSize; ++i) {
+        const auto& entry = entries[i < num_entries ? i : 0];
+        scan_values_[i] = entry.first;
+        scan_memo_indices_[i] = entry.second;
+      }
+      use_scan_ = true;
+      return true;
+    }
+    auto [min, range] = GetRange(entries, /*bias=*/0);
+    const auto [biased_min, biased_range] = GetRange(entries, SignBit());
+    if (biased_range < range) {
+      bias_ = SignBit();
+      min = biased_min;
+      range = biased_range;
+    }
+    if (range >= std::max(4 * static_cast<uint64_t>(num_entries), kMinDenseTableSize)) {
+      return false;
+    }
+    min_ = min;
+    dense_memo_indices_.assign(range + 1, -1);
+    for (const auto& [value, memo_index] : entries) {
+      dense_memo_indices_[Offset(value)] = memo_index;
+    }
+    return true;
+  }
+
+  // Return the memo index of the value, or -1 if not found
+  int32_t Get(T value) const {
+    if (use_scan_) {
+      int32_t memo_index = -1;
+      for (int64_t i = 0; i < kMaxScanSize; ++i) {
+        memo_index = scan_values_[i] == value ? scan_memo_indices_[i] : memo_index;
+      }
+      return memo_index;
+    }
+    // Values below the minimum wrap around to large offsets
+    const uint64_t offset = Offset(value);
+    return offset < dense_memo_indices_.size() ? dense_memo_indices_[offset] : -1;
+  }
+
+  // Whether the set is scanned, or else looked up in the dense table
+  bool uses_scan() const { return use_scan_; }
+
+ private:
+  static constexpr T SignBit() { return T{1} << (std::numeric_limits<T>::digits - 1); }
+
+  // Return the minimum and the span of the values after flipping the bits in `bias`
+  static std::pair<uint64_t, uint64_t> GetRange(
+      const std::vector<std::pair<T, int32_t>>& entries, T bias) {
+    uint64_t min = std::numeric_limits<uint64_t>::max();
+    uint64_t max = 0;
+    for (const auto& entry : entries) {
+      const auto value = static_cast<uint64_t>(static_cast<T>(entry.first ^ bias));
+      min = std::min(min, value);
+      max = std::max(max, value);
+    }
+    return {min, max - min};
+  }
+
+  uint64_t Offset(T value) const {
+    return static_cast<uint64_t>(static_cast<T>(value ^ bias_)) - min_;
+  }
+
+  bool use_scan_ = false;
+  std::array<T, kMaxScanSize> scan_values_{};
+  std::array<int32_t, kMaxScanSize> scan_memo_indices_{};
+  T bias_{};
+  uint64_t min_ = 0;
+  std::vector<int32_t> dense_memo_indices_;
+};
+
+}  // namespace arrow::compute::internal
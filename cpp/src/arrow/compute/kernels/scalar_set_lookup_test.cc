@@ -24,6 +24,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -33,6 +34,7 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
+#include "arrow/compute/kernels/scalar_set_lookup_internal.h"
 #include "arrow/compute/kernels/test_util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -1559,6 +1561,78 @@ TEST_F(TestIndexInKernel, BinaryResizeTable) {
   ASSERT_ARRAYS_EQUAL(*expected, *actual);
 }
 
+enum class IntegerSetLayout { kScan, kDense, kHashed };
+
+// Which lookup structure an integer value set gets, given the unsigned type
+// its values are looked up as
+template <typename T>
+IntegerSetLayout GetIntegerSetLayout(const std::vector<int64_t>& set_values) {
+  std::vector<std::pair<T, int32_t>> entries;
+  for (const int64_t v : set_values) {
+    const auto value = static_cast<T>(v);
+    if (std::none_of(entries.begin(), entries.end(),
+                     [&](const auto& entry) { return entry.first == value; })) {
+      entries.emplace_back(value, static_cast<int32_t>(entries.size()));
+    }
+  }
+  internal::SmallIntegerSetIndex<T> index;
+  if (!index.Init(entries)) {
+    return IntegerSetLayout::kHashed;
+  }
+  return index.uses_scan() ? IntegerSetLayout::kScan : IntegerSetLayout::kDense;
+}
+
+TEST_F(TestIndexInKernel, IntegerValueSetLayouts) {
+  // Tiny, densely packed and sparse integer value sets use different lookup
+  // structures
+  std::vector<std::vector<int64_t>> value_sets(3);
+  const std::vector<IntegerSetLayout> layouts = {
+      IntegerSetLayout::kScan, IntegerSetLayout::kDense, IntegerSetLayout::kHashed};
+  value_sets[0] = {7, -3, 7, 0};
+  for (int64_t i = 0; i < 300; ++i) {
+    value_sets[1].push_back((i * 7) % 300 - 20);
+  }
+  for (int64_t i = 0; i < 100; ++i) {
+    value_sets[2].push_back(i * 1001 - 50000);
+  }
+
+  for (size_t i = 0; i < value_sets.size(); ++i) {
+    ARROW_SCOPED_TRACE("value set #", i);
+    // Sets spanning zero are dense once ordered as signed integers
+    ASSERT_EQ(GetIntegerSetLayout<uint32_t>(value_sets[i]), layouts[i]);
+    ASSERT_EQ(GetIntegerSetLayout<uint64_t>(value_sets[i]), layouts[i]);
+  }
+
+  for (const auto& type : {int32(), int64()}) {
+    for (const auto& set_values : value_sets) {
+      Int64Builder set_builder, input_builder, expected_builder;
+      ASSERT_OK(set_builder.AppendValues(set_values));
+      for (int64_t i = 0; i < 20000; ++i) {
+        const int64_t v = i * 7 - 60000;
+        // Every third value is known to be in the set
+        const int64_t v_or_in_set = (i % 3 == 0) ? set_values[i % set_values.size()] : v;
+        ASSERT_OK(input_builder.Append(v_or_in_set));
+        auto it = std::find(set_values.begin(), set_values.end(), v_or_in_set);
+        if (it == set_values.end()) {
+          ASSERT_OK(expected_builder.AppendNull());
+        } else {
+          ASSERT_OK(expected_builder.Append(it - set_values.begin()));
+        }
+      }
+      ASSERT_OK_AND_ASSIGN(auto value_set, set_builder.Finish());
+      ASSERT_OK_AND_ASSIGN(auto input, input_builder.Finish());
+      ASSERT_OK_AND_ASSIGN(auto expected, expected_builder.Finish());
+      ASSERT_OK_AND_ASSIGN(value_set, Cast(*value_set, type));
+      ASSERT_OK_AND_ASSIGN(input, Cast(*input, type));
+      ASSERT_OK_AND_ASSIGN(expected, Cast(*expected, int32()));
+
+      ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(input, value_set));
+      ValidateOutput(actual);
+      AssertArraysEqual(*expected, *actual.make_array(), /*verbose=*/true);
+    }
+  }
+}
+
 TEST_F(TestIndexInKernel, FixedSizeBinary) {
   CheckIndexIn(fixed_size_binary(3),
                /*input=*/R"(["bbb", null, "ddd", "aaa", "ccc", "aaa"])",
@@ -1941,7 +2015,38 @@ TEST_F(TestIndexInKernel, ChunkedArrayInvoke) {
 TEST(TestSetLookup, DispatchBest) {
   for (std::string name : {"is_in", "index_in"}) {
     CheckDispatchBest(name, {int32()}, {int32()});
-    CheckDispatchBest(name, {dictionary(int32(), utf8())}, {utf8()});
+    CheckDispatchBest(name, {dictionary(int32(), utf8())},
+                      {dictionary(int32(), utf8())});
+  }
+}
+
+TEST(TestSetLookup, ReuseValueSet) {
+  // Lookup states are shared between calls using the same value set, but
+  // must still honor the options and input type of each call
+  auto value_set = ArrayFromJSON(int32(), "[4, null, 2]");
+  for (int i = 0; i < 2; ++i) {
+    SetLookupOptions match(value_set, SetLookupOptions::MATCH);
+    SetLookupOptions skip(value_set, SetLookupOptions::SKIP);
+    CheckScalarUnary("index_in", ArrayFromJSON(int32(), "[2, null, 3, 4]"),
+                     ArrayFromJSON(int32(), "[2, 1, null, 0]"), &match);
+    CheckScalarUnary("index_in", ArrayFromJSON(int32(), "[2, null, 3, 4]"),
+                     ArrayFromJSON(int32(), "[2, null, null, 0]"), &skip);
+    CheckScalarUnary("is_in", ArrayFromJSON(int64(), "[2, null, 3, 4]"),
+                     ArrayFromJSON(boolean(), "[true, true, false, true]"), &match);
+    CheckScalarUnary("is_in", ArrayFromJSON(int8(), "[2, null, 3, 4]"),
+                     ArrayFromJSON(boolean(), "[true, false, false, true]"), &skip);
+  }
+
+  // A new value set, even if allocated at the same address, is not confused
+  // with the previous one
+  std::vector<std::pair<std::string, std::string>> sets_and_expected = {
+      {"[1, 2]", "[true, false, false]"},
+      {"[3, 4]", "[false, true, false]"},
+      {"[5, 6]", "[false, false, true]"}};
+  for (const auto& [value_set_json, expected_json] : sets_and_expected) {
+    SetLookupOptions options(ArrayFromJSON(int32(), value_set_json));
+    CheckScalarUnary("is_in", ArrayFromJSON(int32(), "[1, 3, 5]"),
+                     ArrayFromJSON(boolean(), expected_json), &options);
   }
 }
 
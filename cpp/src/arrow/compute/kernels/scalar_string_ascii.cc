@@ -16,23 +16,29 @@
 // under the License.
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
+#include "arrow/util/string_search_internal.h"
 #include "arrow/util/value_parsing.h"
 
 #ifdef ARROW_WITH_RE2
 #  include <re2/re2.h>
+#  include <re2/set.h>
 #endif
 
 namespace arrow {
@@ -79,6 +85,79 @@ template <typename T>
 RE2::Options MakeRE2Options(bool ignore_case = false, bool literal = false) {
   return MakeRE2Options(T::is_utf8, ignore_case, literal);
 }
+
+constexpr int32_t kRegexCacheCapacity = 64;
+
+// Compiling a regex usually costs more than matching it against a small batch,
+// so compiled regexes are shared between kernel invocations.  RE2 objects can
+// be used from several threads at once.
+//
+// The returned regex may be invalid, which callers check with RegexStatus().
+std::shared_ptr<const RE2> GetCachedRegex(const std::string& pattern, bool is_utf8,
+                                          bool ignore_case = false,
+                                          bool literal = false) {
+  // The key is the pattern prefixed with the MakeRE2Options() arguments
+  static auto cache = ::arrow::internal::MemoizeLru(
+      [](const std::string& key) -> std::shared_ptr<const RE2> {
+        const auto flags = static_cast<uint8_t>(key[0]);
+        return std::make_shared<RE2>(
+            re2::StringPiece(key.data() + 1, key.size() - 1),
+            MakeRE2Options(flags & 1, flags & 2, flags & 4));
+      },
+      kRegexCacheCapacity);
+  std::string key;
+  key.reserve(pattern.size() + 1);
+  key += static_cast<char>(is_utf8 | ignore_case << 1 | literal << 2);
+  key += pattern;
+  return cache(key);
+}
+
+template <typename T>
+std::shared_ptr<const RE2> GetCachedRegex(const std::string& pattern) {
+  return GetCachedRegex(pattern, T::is_utf8);
+}
+
+// Like GetCachedRegex, for a set of regexes matched together.  Returns null if
+// there are no patterns.
+Result<std::shared_ptr<const RE2::Set>> GetCachedRegexSet(
+    const std::vector<std::string>& patterns, bool is_utf8, bool ignore_case) {
+  // The key is the patterns, each prefixed with its length, prefixed with the
+  // MakeRE2Options() arguments
+  static auto cache = ::arrow::internal::MemoizeLru(
+      [](const std::string& key) -> Result<std::shared_ptr<const RE2::Set>> {
+        const auto flags = static_cast<uint8_t>(key[0]);
+        auto set = std::make_shared<RE2::Set>(MakeRE2Options(flags & 1, flags & 2),
+                                              RE2::UNANCHORED);
+        std::string_view remaining = std::string_view(key).substr(1);
+        while (!remaining.empty()) {
+          const auto separator = remaining.find(':');
+          int64_t length = 0;
+          const bool parsed = ::arrow::internal::ParseValue<Int64Type>(
+              remaining.data(), separator, &length);
+          DCHECK(parsed);
+          ARROW_UNUSED(parsed);
+          const auto pattern = remaining.substr(separator + 1, length);
+          remaining.remove_prefix(separator + 1 + length);
+          std::string error;
+          if (set->Add(ToStringPiece(pattern), &error) < 0) {
+            return Status::Invalid("Invalid regular expression: ", error);
+          }
+        }
+        if (!set->Compile()) {
+          return Status::Invalid("Regular expression set too large to compile");
+        }
+        return set;
+      },
+      kRegexCacheCapacity);
+  if (patterns.empty()) return nullptr;
+  std::string key(1, static_cast<char>(is_utf8 | ignore_case << 1));
+  for (const auto& pattern : patterns) {
+    key += std::to_string(pattern.size());
+    key += ':';
+    key += pattern;
+  }
+  return cache(key);
+}
 #endif
 
 // ----------------------------------------------------------------------
@@ -446,11 +525,11 @@ struct StringBinaryTransformExecWithState
 
 using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
 
-// Apply `transform` to input character data- this function cannot change the
-// length
+// Offset-based layouts can reuse the input offsets and transform all the
+// character data at once
 template <typename Type>
-Status StringDataTransform(KernelContext* ctx, const ExecSpan& batch,
-                           TransformFunc transform, ExecResult* out) {
+Status StringDataTransformOffsets(KernelContext* ctx, const ExecSpan& batch,
+                                  TransformFunc transform, ExecResult* out) {
   using offset_type = typename Type::offset_type;
 
   const ArraySpan& input = batch[0].array;
@@ -494,6 +573,35 @@ Status StringDataTransform(KernelContext* ctx, const ExecSpan& batch,
   return Status::OK();
 }
 
+// Adapts a length-preserving TransformFunc to the StringTransformExecBase interface
+struct StringDataTransformAdapter : public StringTransformBase {
+  TransformFunc transform;
+
+  explicit StringDataTransformAdapter(TransformFunc transform)
+      : transform(std::move(transform)) {}
+
+  int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
+                    uint8_t* output) {
+    transform(input, input_string_ncodeunits, output);
+    return input_string_ncodeunits;
+  }
+};
+
+// Apply `transform` to input character data- this function cannot change the
+// length
+template <typename Type>
+Status StringDataTransform(KernelContext* ctx, const ExecSpan& batch,
+                           TransformFunc transform, ExecResult* out) {
+  if constexpr (is_binary_view_like_type<Type>::value) {
+    // Views can't reuse the input layout, so transform them value by value
+    StringDataTransformAdapter adapter(std::move(transform));
+    return StringTransformExecBase<Type, StringDataTransformAdapter>::Execute(
+        ctx, &adapter, batch, out);
+  } else {
+    return StringDataTransformOffsets<Type>(ctx, batch, std::move(transform), out);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Predicates and classification
 
@@ -891,8 +999,14 @@ void AddAsciiStringLength(FunctionRegistry* registry) {
             ty);
     DCHECK_OK(func->AddKernel({ty}, int64(), std::move(exec)));
   }
+  for (const auto& ty : BinaryViewTypes()) {
+    auto exec =
+        applicator::ScalarUnaryNotNull<Int32Type, BinaryViewType, BinaryLength>::Exec;
+    DCHECK_OK(func->AddKernel({ty}, int32(), std::move(exec)));
+  }
   DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                             BinaryLength::FixedSizeExec));
+  AddDictionaryLookupKernels(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -981,10 +1095,9 @@ struct AsciiTrimTransform : public StringTransformBase {
 
   explicit AsciiTrimTransform(const AsciiTrimState& state) : state_(state) {}
 
-  int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
-                    uint8_t* output) {
-    const uint8_t* begin = input;
-    const uint8_t* end = input + input_string_ncodeunits;
+  std::optional<std::string_view> Substring(std::string_view input) const {
+    const auto* begin = reinterpret_cast<const uint8_t*>(input.data());
+    const uint8_t* end = begin + input.size();
     const uint8_t* end_trimmed = end;
     const uint8_t* begin_trimmed = begin;
     const auto& characters = state_.characters_;
@@ -998,8 +1111,15 @@ struct AsciiTrimTransform : public StringTransformBase {
       std::reverse_iterator<const uint8_t*> rend(begin_trimmed);
       end_trimmed = std::find_if(rbegin, rend, predicate).base();
     }
-    std::copy(begin_trimmed, end_trimmed, output);
-    return end_trimmed - begin_trimmed;
+    return input.substr(begin_trimmed - begin, end_trimmed - begin_trimmed);
+  }
+
+  int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
+                    uint8_t* output) {
+    const std::string_view trimmed = *Substring(std::string_view(
+        reinterpret_cast<const char*>(input), input_string_ncodeunits));
+    std::copy(trimmed.begin(), trimmed.end(), output);
+    return static_cast<int64_t>(trimmed.size());
   }
 };
 
@@ -1014,10 +1134,9 @@ using AsciiRTrim = StringTransformExecWithState<Type, AsciiTrimTransform<false,
 
 template <bool TrimLeft, bool TrimRight>
 struct AsciiTrimWhitespaceTransform : public StringTransformBase {
-  int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
-                    uint8_t* output) {
-    const uint8_t* begin = input;
-    const uint8_t* end = input + input_string_ncodeunits;
+  std::optional<std::string_view> Substring(std::string_view input) const {
+    const auto* begin = reinterpret_cast<const uint8_t*>(input.data());
+    const uint8_t* end = begin + input.size();
     const uint8_t* end_trimmed = end;
     const uint8_t* begin_trimmed = begin;
 
@@ -1030,8 +1149,15 @@ struct AsciiTrimWhitespaceTransform : public StringTransformBase {
       std::reverse_iterator<const uint8_t*> rend(begin_trimmed);
       end_trimmed = std::find_if(rbegin, rend, predicate).base();
     }
-    std::copy(begin_trimmed, end_trimmed, output);
-    return end_trimmed - begin_trimmed;
+    return input.substr(begin_trimmed - begin, end_trimmed - begin_trimmed);
+  }
+
+  int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
+                    uint8_t* output) {
+    const std::string_view trimmed = *Substring(std::string_view(
+        reinterpret_cast<const char*>(input), input_string_ncodeunits));
+    std::copy(trimmed.begin(), trimmed.end(), output);
+    return static_cast<int64_t>(trimmed.size());
   }
 };
 
@@ -1227,7 +1353,6 @@ using MatchSubstringState = OptionsWrapper<MatchSubstringOptions>;
 // This is an implementation of the Knuth-Morris-Pratt algorithm
 struct PlainSubstringMatcher {
   const MatchSubstringOptions& options_;
-  std::vector<int64_t> prefix_table;
 
   static Result<std::unique_ptr<PlainSubstringMatcher>> Make(
       const MatchSubstringOptions& options) {
@@ -1237,40 +1362,10 @@ struct PlainSubstringMatcher {
   }
 
   explicit PlainSubstringMatcher(const MatchSubstringOptions& options)
-      : options_(options) {
-    // Phase 1: Build the prefix table
-    const auto pattern_length = options_.pattern.size();
-    prefix_table.resize(pattern_length + 1, /*value=*/0);
-    int64_t prefix_length = -1;
-    prefix_table[0] = -1;
-    for (size_t pos = 0; pos < pattern_length; ++pos) {
-      // The prefix cannot be expanded, reset.
-      while (prefix_length >= 0 &&
-             options_.pattern[pos] != options_.pattern[prefix_length]) {
-        prefix_length = prefix_table[prefix_length];
-      }
-      prefix_length++;
-      prefix_table[pos + 1] = prefix_length;
-    }
-  }
+      : options_(options) {}
 
   int64_t Find(std::string_view current) const {
-    // Phase 2: Find the prefix in the data
-    const auto pattern_length = options_.pattern.size();
-    int64_t pattern_pos = 0;
-    int64_t pos = 0;
-    if (pattern_length == 0) return 0;
-    for (const auto c : current) {
-      while ((pattern_pos >= 0) && (options_.pattern[pattern_pos] != c)) {
-        pattern_pos = prefix_table[pattern_pos];
-      }
-      pattern_pos++;
-      if (static_cast<size_t>(pattern_pos) == pattern_length) {
-        return pos + 1 - pattern_length;
-      }
-      pos++;
-    }
-    return -1;
+    return ::arrow::internal::FindSubstring(current, options_.pattern);
   }
 
   bool Match(std::string_view current) const { return Find(current) >= 0; }
@@ -1312,32 +1407,149 @@ struct PlainEndsWithMatcher {
   }
 };
 
+// Aho-Corasick automaton matching any of several literal patterns in a single
+// pass over each string.  The automaton is compiled to a DFA, so each input
+// byte costs one table lookup regardless of the number of patterns.  Bytes
+// not occurring in any pattern share a column of the transition table, which
+// keeps the table small.
+class PlainMultiSubstringMatcher {
+ public:
+  static Result<std::unique_ptr<PlainMultiSubstringMatcher>> Make(
+      const MatchAnySubstringOptions& options) {
+    // Should be handled by the MatchAnySubstring kernel
+    DCHECK(!options.ignore_case || options.patterns.empty());
+    return std::make_unique<PlainMultiSubstringMatcher>(options);
+  }
+
+  explicit PlainMultiSubstringMatcher(const MatchAnySubstringOptions& options) {
+    byte_classes_.fill(0);
+    num_classes_ = 1;
+    for (const auto& pattern : options.patterns) {
+      for (const auto c : pattern) {
+        auto& byte_class = byte_classes_[static_cast<uint8_t>(c)];
+        if (byte_class == 0) byte_class = static_cast<uint16_t>(num_classes_++);
+      }
+    }
+
+    // Build the trie of the patterns, -1 marking missing transitions
+    AddState();
+    for (const auto& pattern : options.patterns) {
+      int32_t state = 0;
+      for (const auto c : pattern) {
+        const int64_t index = state * num_classes_ + ByteClass(c);
+        if (transitions_[index] < 0) {
+          // Not a reference, as adding a state reallocates the table
+          const int32_t next = AddState();
+          transitions_[index] = next;
+        }
+        state = transitions_[index];
+      }
+      accepting_[state] = true;
+    }
+
+    // Turn the trie into a DFA by resolving missing transitions through the
+    // failure links, in breadth-first order so that the states a failure
+    // link can point to are always complete
+    std::vector<int32_t> failure(accepting_.size(), 0);
+    std::vector<int32_t> queue;
+    queue.reserve(accepting_.size());
+    for (int64_t c = 0; c < num_classes_; ++c) {
+      int32_t& next = transitions_[c];
+      if (next < 0) {
+        next = 0;
+      } else {
+        queue.push_back(next);
+      }
+    }
+    for (size_t i = 0; i < queue.size(); ++i) {
+      const int32_t state = queue[i];
+      accepting_[state] = accepting_[state] || accepting_[failure[state]];
+      const int32_t* failure_transitions = &transitions_[failure[state] * num_classes_];
+      int32_t* state_transitions = &transitions_[state * num_classes_];
+      for (int64_t c = 0; c < num_classes_; ++c) {
+        if (state_transitions[c] < 0) {
+          state_transitions[c] = failure_transitions[c];
+        } else {
+          failure[state_transitions[c]] = failure_transitions[c];
+          queue.push_back(state_transitions[c]);
+        }
+      }
+    }
+  }
+
+  bool Match(std::string_view current) const {
+    if (accepting_[0]) return true;
+    int32_t state = 0;
+    for (const auto c : current) {
+      state = transitions_[state * num_classes_ + ByteClass(c)];
+      if (accepting_[state]) return true;
+    }
+    return false;
+  }
+
+ private:
+  int32_t AddState() {
+    transitions_.resize(transitions_.size() + num_classes_, -1);
+    accepting_.push_back(false);
+    return static_cast<int32_t>(accepting_.size() - 1);
+  }
+
+  int64_t ByteClass(char c) const { return byte_classes_[static_cast<uint8_t>(c)]; }
+
+  std::array<uint16_t, 256> byte_classes_;
+  int64_t num_classes_;
+  std::vector<int32_t> transitions_;
+  std::vector<uint8_t> accepting_;
+};
+
 #ifdef ARROW_WITH_RE2
 struct RegexSubstringMatcher {
   const MatchSubstringOptions& options_;
-  const RE2 regex_match_;
+  const std::shared_ptr<const RE2> regex_match_;
 
   static Result<std::unique_ptr<RegexSubstringMatcher>> Make(
       const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false) {
     auto matcher = std::make_unique<RegexSubstringMatcher>(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(matcher->regex_match_));
+    RETURN_NOT_OK(RegexStatus(*matcher->regex_match_));
     return matcher;
   }
 
   explicit RegexSubstringMatcher(const MatchSubstringOptions& options,
                                  bool is_utf8 = true, bool literal = false)
       : options_(options),
-        regex_match_(options_.pattern,
-                     MakeRE2Options(is_utf8, options.ignore_case, literal)) {}
+        regex_match_(
+            GetCachedRegex(options_.pattern, is_utf8, options.ignore_case, literal)) {}
 
   bool Match(std::string_view current) const {
     auto piece = re2::StringPiece(current.data(), current.length());
-    return RE2::PartialMatch(piece, regex_match_);
+    return RE2::PartialMatch(piece, *regex_match_);
   }
 };
 #endif
 
-template <typename Type, typename Matcher>
+#ifdef ARROW_WITH_RE2
+// Matches all patterns in a single pass over each string
+struct RegexSetMatcher {
+  const std::shared_ptr<const RE2::Set> regex_set_;
+
+  static Result<std::unique_ptr<RegexSetMatcher>> Make(
+      const MatchAnySubstringOptions& options, bool is_utf8 = true) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto regex_set,
+        GetCachedRegexSet(options.patterns, is_utf8, options.ignore_case));
+    return std::make_unique<RegexSetMatcher>(std::move(regex_set));
+  }
+
+  explicit RegexSetMatcher(std::shared_ptr<const RE2::Set> regex_set)
+      : regex_set_(std::move(regex_set)) {}
+
+  bool Match(std::string_view current) const {
+    return regex_set_ != nullptr && regex_set_->Match(ToStringPiece(current), nullptr);
+  }
+};
+#endif
+
+template <typename Type, typename Matcher, typename Enable = void>
 struct MatchSubstringImpl {
   using offset_type = typename Type::offset_type;
 
@@ -1364,10 +1576,22 @@ struct MatchSubstringImpl {
   }
 };
 
+template <typename Type, typename Matcher>
+struct MatchSubstringImpl<Type, Matcher, enable_if_binary_view_like<Type>> {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out,
+                     const Matcher* matcher) {
+    ArrayIterator<Type> input_it(batch[0].array);
+    ArraySpan* out_arr = out->array_span_mutable();
+    ::arrow::internal::GenerateBitsUnrolled(
+        out_arr->buffers[1].data, out_arr->offset, batch.length,
+        [&]() -> bool { return matcher->Match(input_it()); });
+    return Status::OK();
+  }
+};
+
 template <typename Type, typename Matcher>
 struct MatchSubstring {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    // TODO Cache matcher across invocations (for regex compilation)
     ARROW_ASSIGN_OR_RAISE(auto matcher, Matcher::Make(MatchSubstringState::Get(ctx)));
     return MatchSubstringImpl<Type, Matcher>::Exec(ctx, batch, out, matcher.get());
   }
@@ -1377,7 +1601,6 @@ struct MatchSubstring {
 template <typename Type>
 struct MatchSubstring<Type, RegexSubstringMatcher> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    // TODO Cache matcher across invocations (for regex compilation)
     ARROW_ASSIGN_OR_RAISE(auto matcher,
                           RegexSubstringMatcher::Make(MatchSubstringState::Get(ctx),
                                                       /*is_utf8=*/Type::is_utf8));
@@ -1454,7 +1677,75 @@ struct MatchSubstring<Type, PlainEndsWithMatcher> {
   }
 };
 
+using MatchAnySubstringState = OptionsWrapper<MatchAnySubstringOptions>;
+
+// The matcher of match_any_substring is built once at kernel init and reused for
+// every batch, as compiling many patterns can cost more than matching a batch
+struct MatchAnySubstringMatcherState : public MatchAnySubstringState {
+  using MatchAnySubstringState::MatchAnySubstringState;
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    auto options = static_cast<const MatchAnySubstringOptions*>(args.options);
+    if (options == nullptr) {
+      return Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions");
+    }
+    auto state = std::make_unique<MatchAnySubstringMatcherState>(*options);
+    // Without patterns nothing matches, whatever the case sensitivity
+    if (options->ignore_case && !options->patterns.empty()) {
+#ifdef ARROW_WITH_RE2
+      const auto type_id = args.inputs[0].id();
+      const bool is_utf8 = is_string(type_id) || type_id == Type::STRING_VIEW;
+      MatchSubstringOptions converted_options(RE2::QuoteMeta(options->patterns[0]),
+                                              options->ignore_case);
+      for (size_t i = 1; i < options->patterns.size(); ++i) {
+        converted_options.pattern += "|" + RE2::QuoteMeta(options->patterns[i]);
+      }
+      ARROW_ASSIGN_OR_RAISE(state->regex_matcher,
+                            RegexSubstringMatcher::Make(converted_options, is_utf8));
+#else
+      return Status::NotImplemented("ignore_case requires RE2");
+#endif
+    } else {
+      ARROW_ASSIGN_OR_RAISE(state->plain_matcher,
+                            PlainMultiSubstringMatcher::Make(*options));
+    }
+    return state;
+  }
+
+  std::unique_ptr<PlainMultiSubstringMatcher> plain_matcher;
 #ifdef ARROW_WITH_RE2
+  std::unique_ptr<RegexSubstringMatcher> regex_matcher;
+#endif
+};
+
+template <typename Type>
+struct MatchAnySubstring {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& state = checked_cast<const MatchAnySubstringMatcherState&>(*ctx->state());
+#ifdef ARROW_WITH_RE2
+    if (state.regex_matcher != nullptr) {
+      return MatchSubstringImpl<Type, RegexSubstringMatcher>::Exec(
+          ctx, batch, out, state.regex_matcher.get());
+    }
+#endif
+    return MatchSubstringImpl<Type, PlainMultiSubstringMatcher>::Exec(
+        ctx, batch, out, state.plain_matcher.get());
+  }
+};
+
+#ifdef ARROW_WITH_RE2
+template <typename Type>
+struct MatchAnyRegex {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    ARROW_ASSIGN_OR_RAISE(auto matcher,
+                          RegexSetMatcher::Make(MatchAnySubstringState::Get(ctx),
+                                                /*is_utf8=*/Type::is_utf8));
+    return MatchSubstringImpl<Type, RegexSetMatcher>::Exec(ctx, batch, out,
+                                                           matcher.get());
+  }
+};
 
 // SQL LIKE match
 
@@ -1575,6 +1866,14 @@ const FunctionDoc match_substring_doc(
      "If ignore_case is set, only simple case folding is performed."),
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 
+const FunctionDoc match_any_substring_doc(
+    "Match strings against several literal patterns",
+    ("For each string in `strings`, emit true iff it contains any of the given\n"
+     "patterns. Null inputs emit null.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only simple case folding is performed."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
 const FunctionDoc starts_with_doc(
     "Check if strings start with a literal pattern",
     ("For each string in `strings`, emit true iff it starts with a given pattern.\n"
@@ -1603,6 +1902,16 @@ const FunctionDoc match_substring_regex_doc(
      "Null inputs emit null."),
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 
+const FunctionDoc match_any_regex_doc(
+    "Match strings against several regex patterns",
+    ("For each string in `strings`, emit true iff it matches any of the given\n"
+     "patterns at any position. The patterns are matched in a single pass.\n"
+     "The patterns must be given in MatchAnySubstringOptions.\n"
+     "If ignore_case is set, only simple case folding is performed.\n"
+     "\n"
+     "Null inputs emit null."),
+    {"strings"}, "MatchAnySubstringOptions", /*options_required=*/true);
+
 const FunctionDoc match_like_doc(
     "Match strings against SQL-style LIKE pattern",
     ("For each string in `strings`, emit true iff it matches a given pattern\n"
@@ -1613,6 +1922,14 @@ const FunctionDoc match_like_doc(
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 #endif
 
+template <template <typename...> class Generator, typename... Args>
+void AddBinaryViewPredicateKernels(ScalarFunction* func, KernelInit init) {
+  DCHECK_OK(func->AddKernel({binary_view()}, boolean(),
+                            Generator<BinaryViewType, Args...>::Exec, init));
+  DCHECK_OK(func->AddKernel({utf8_view()}, boolean(),
+                            Generator<StringViewType, Args...>::Exec, init));
+}
+
 void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<ScalarFunction>("match_substring", Arity::Unary(),
@@ -1622,6 +1939,22 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    AddBinaryViewPredicateKernels<MatchSubstring, PlainSubstringMatcher>(
+        func.get(), MatchSubstringState::Init);
+    AddDictionaryLookupKernels(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_substring", Arity::Unary(),
+                                                 match_any_substring_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnySubstring>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchAnySubstringMatcherState::Init));
+    }
+    AddBinaryViewPredicateKernels<MatchAnySubstring>(
+        func.get(), MatchAnySubstringMatcherState::Init);
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1633,6 +1966,9 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    AddBinaryViewPredicateKernels<MatchSubstring, PlainStartsWithMatcher>(
+        func.get(), MatchSubstringState::Init);
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1643,6 +1979,9 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    AddBinaryViewPredicateKernels<MatchSubstring, PlainEndsWithMatcher>(
+        func.get(), MatchSubstringState::Init);
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #ifdef ARROW_WITH_RE2
@@ -1654,6 +1993,22 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    AddBinaryViewPredicateKernels<MatchSubstring, RegexSubstringMatcher>(
+        func.get(), MatchSubstringState::Init);
+    AddDictionaryLookupKernels(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_regex", Arity::Unary(),
+                                                 match_any_regex_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnyRegex>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec),
+                                MatchAnySubstringState::Init));
+    }
+    AddBinaryViewPredicateKernels<MatchAnyRegex>(func.get(),
+                                                 MatchAnySubstringState::Init);
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1664,6 +2019,8 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    AddBinaryViewPredicateKernels<MatchLike>(func.get(), MatchSubstringState::Init);
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #endif
@@ -1685,7 +2042,7 @@ struct FindSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct FindSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   static Result<FindSubstringRegex> Make(const MatchSubstringOptions& options,
                                          bool is_utf8 = true, bool literal = false) {
@@ -1700,8 +2057,7 @@ struct FindSubstringRegex {
     regex.reserve(options.pattern.length() + 2);
     regex += literal ? RE2::QuoteMeta(options.pattern) : options.pattern;
     regex += ")";
-    regex_match_ = std::make_unique<RE2>(
-        regex, MakeRE2Options(is_utf8, options.ignore_case, /*literal=*/false));
+    regex_match_ = GetCachedRegex(regex, is_utf8, options.ignore_case);
   }
 
   template <typename OutValue, typename... Ignored>
@@ -1779,6 +2135,7 @@ void AddAsciiStringFindSubstring(FunctionRegistry* registry) {
     DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                               FindSubstringExec<FixedSizeBinaryType>::Exec,
                               MatchSubstringState::Init));
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #ifdef ARROW_WITH_RE2
@@ -1794,6 +2151,7 @@ void AddAsciiStringFindSubstring(FunctionRegistry* registry) {
     DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                               FindSubstringRegexExec<FixedSizeBinaryType>::Exec,
                               MatchSubstringState::Init));
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #endif
@@ -1827,12 +2185,12 @@ struct CountSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct CountSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const RE2> regex_match_;
 
   explicit CountSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
                                bool literal = false)
-      : regex_match_(new RE2(options.pattern,
-                             MakeRE2Options(is_utf8, options.ignore_case, literal))) {}
+      : regex_match_(
+            GetCachedRegex(options.pattern, is_utf8, options.ignore_case, literal)) {}
 
   static Result<CountSubstringRegex> Make(const MatchSubstringOptions& options,
                                           bool is_utf8 = true, bool literal = false) {
@@ -1928,6 +2286,7 @@ void AddAsciiStringCountSubstring(FunctionRegistry* registry) {
     DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                               CountSubstringExec<FixedSizeBinaryType>::Exec,
                               MatchSubstringState::Init));
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #ifdef ARROW_WITH_RE2
@@ -1943,6 +2302,7 @@ void AddAsciiStringCountSubstring(FunctionRegistry* registry) {
     DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                               CountSubstringRegexExec<FixedSizeBinaryType>::Exec,
                               MatchSubstringState::Init));
+    AddDictionaryLookupKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #endif
@@ -1961,7 +2321,6 @@ struct ReplaceSubstring {
   using OffsetBuilder = TypedBufferBuilder<offset_type>;
 
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    // TODO Cache replacer across invocations (for regex compilation)
     ARROW_ASSIGN_OR_RAISE(auto replacer, Replacer::Make(ReplaceState::Get(ctx)));
     return Replace(ctx, batch, *replacer, out);
   }
@@ -2044,19 +2403,19 @@ struct PlainSubstringReplacer {
 template <typename Type>
 struct RegexSubstringReplacer {
   const ReplaceSubstringOptions& options_;
-  const RE2 regex_find_;
-  const RE2 regex_replacement_;
+  const std::shared_ptr<const RE2> regex_find_;
+  const std::shared_ptr<const RE2> regex_replacement_;
 
   static Result<std::unique_ptr<RegexSubstringReplacer>> Make(
       const ReplaceSubstringOptions& options) {
     auto replacer = std::make_unique<RegexSubstringReplacer>(options);
 
-    RETURN_NOT_OK(RegexStatus(replacer->regex_find_));
-    RETURN_NOT_OK(RegexStatus(replacer->regex_replacement_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_find_));
+    RETURN_NOT_OK(RegexStatus(*replacer->regex_replacement_));
 
     std::string replacement_error;
-    if (!replacer->regex_replacement_.CheckRewriteString(replacer->options_.replacement,
-                                                         &replacement_error)) {
+    if (!replacer->regex_replacement_->CheckRewriteString(replacer->options_.replacement,
+                                                          &replacement_error)) {
       return Status::Invalid("Invalid replacement string: ",
                              std::move(replacement_error));
     }
@@ -2068,8 +2427,8 @@ struct RegexSubstringReplacer {
   // we have 2 regexes, one with () around it, one without.
   explicit RegexSubstringReplacer(const ReplaceSubstringOptions& options)
       : options_(options),
-        regex_find_("(" + options_.pattern + ")", MakeRE2Options<Type>()),
-        regex_replacement_(options_.pattern, MakeRE2Options<Type>()) {}
+        regex_find_(GetCachedRegex<Type>("(" + options_.pattern + ")")),
+        regex_replacement_(GetCachedRegex<Type>(options_.pattern)) {}
 
   Status ReplaceString(std::string_view s, TypedBufferBuilder<uint8_t>* builder) const {
     re2::StringPiece piece(s.data(), s.length());
@@ -2083,7 +2442,7 @@ struct RegexSubstringReplacer {
     // If s is empty, then it's essentially global
     if (options_.max_replacements == -1 || s.empty()) {
       std::string s_copy{s.data(), s.length()};
-      RE2::GlobalReplace(&s_copy, regex_replacement_, replacement);
+      RE2::GlobalReplace(&s_copy, *regex_replacement_, replacement);
       return builder->Append(reinterpret_cast<const uint8_t*>(s_copy.data()),
                              s_copy.length());
     }
@@ -2098,7 +2457,7 @@ struct RegexSubstringReplacer {
     int64_t max_replacements = options_.max_replacements;
     while ((i < end) && (max_replacements != 0)) {
       std::string found;
-      if (!RE2::FindAndConsume(&mutable_s, regex_find_, &found)) {
+      if (!RE2::FindAndConsume(&mutable_s, *regex_find_, &found)) {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(end - i)));
         i = end;
@@ -2109,7 +2468,7 @@ struct RegexSubstringReplacer {
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(i),
                                       static_cast<int64_t>(pos - i)));
         // replace the pattern in what we found
-        if (!RE2::Replace(&found, regex_replacement_, replacement)) {
+        if (!RE2::Replace(&found, *regex_replacement_, replacement)) {
           return Status::Invalid("Regex found, but replacement failed");
         }
         RETURN_NOT_OK(builder->Append(reinterpret_cast<const uint8_t*>(found.data()),
@@ -2206,15 +2565,14 @@ struct BaseExtractRegexData {
 
   int64_t num_groups() const { return static_cast<int64_t>(group_names.size()); }
 
-  std::unique_ptr<RE2> regex;
+  std::shared_ptr<const RE2> regex;
   std::vector<std::string> group_names;
 
  protected:
   explicit BaseExtractRegexData(const std::string& pattern, bool is_utf8)
-      : regex(new RE2(pattern, MakeRE2Options(is_utf8))) {}
+      : regex(GetCachedRegex(pattern, is_utf8)) {}
 };
 
-// TODO cache this once per ExtractRegexOptions
 struct ExtractRegexData : public BaseExtractRegexData {
   static Result<ExtractRegexData> Make(const ExtractRegexOptions& options, bool is_utf8) {
     ExtractRegexData data(options.pattern, is_utf8);
@@ -2611,6 +2969,15 @@ struct SliceBytesTransform : StringSliceTransformBase {
     return SliceBackward(input, input_string_bytes, output);
   }
 
+  std::optional<std::string_view> Substring(std::string_view input) const {
+    if (options->step != 1) {
+      return std::nullopt;
+    }
+    auto [begin_index, end_index] =
+        SliceForwardRange(*options, static_cast<int64_t>(input.size()));
+    return input.substr(begin_index, end_index - begin_index);
+  }
+
   static std::pair<int64_t, int64_t> SliceForwardRange(const SliceOptions& opt,
                                                        int64_t input_string_bytes) {
     int64_t begin = 0;
@@ -2795,6 +3162,12 @@ void AddAsciiStringSlice(FunctionRegistry* registry) {
     DCHECK_OK(
         func->AddKernel({ty}, ty, std::move(exec), SliceBytesTransform::State::Init));
   }
+  {
+    ScalarKernel kernel({binary_view()}, binary_view(), SliceBytes<BinaryViewType>::Exec,
+                        SliceBytesTransform::State::Init);
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
   using TransformExec = FixedSizeBinaryTransformExecWithState<SliceBytesTransform>;
   ScalarKernel fsb_kernel({InputType(Type::FIXED_SIZE_BINARY)},
                           OutputType(TransformExec::OutputType), TransformExec::Exec,
@@ -2963,7 +3336,7 @@ template <typename Type>
 struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
   using Options = SplitPatternOptions;
 
-  std::unique_ptr<RE2> regex_split;
+  std::shared_ptr<const RE2> regex_split;
 
   Status PreExec(const SplitPatternOptions& options) override {
     if (options.reverse) {
@@ -2975,7 +3348,7 @@ struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
     pattern.reserve(options.pattern.size() + 2);
     pattern += options.pattern;
     pattern += ')';
-    regex_split = std::make_unique<RE2>(pattern, MakeRE2Options<Type>());
+    regex_split = GetCachedRegex<Type>(pattern);
     return RegexStatus(*regex_split);
   }
 
@@ -16,6 +16,8 @@
 // under the License.
 
 #include <functional>
+#include <string>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -34,16 +36,17 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace compute {
 
 constexpr auto kSeed = 0x94378165;
 
 static void UnaryStringBenchmark(benchmark::State& state, const std::string& func_name,
-                                 const FunctionOptions* options = nullptr) {
+                                 const FunctionOptions* options = nullptr,
+                                 int64_t value_max_size = 32) {
   const int64_t array_length = 1 << 20;
   const int64_t value_min_size = 0;
-  const int64_t value_max_size = 32;
   const double null_probability = 0.01;
   random::RandomArrayGenerator rng(kSeed);
 
@@ -77,6 +80,40 @@ static void MatchSubstring(benchmark::State& state) {
   UnaryStringBenchmark(state, "match_substring", &options);
 }
 
+// Longer values, closer to log lines
+static void MatchSubstringLong(benchmark::State& state) {
+  MatchSubstringOptions options("abacd");
+  UnaryStringBenchmark(state, "match_substring", &options, /*value_max_size=*/256);
+}
+
+static void FindSubstring(benchmark::State& state) {
+  MatchSubstringOptions options("abacd");
+  UnaryStringBenchmark(state, "find_substring", &options, /*value_max_size=*/256);
+}
+
+static void CountSubstring(benchmark::State& state) {
+  MatchSubstringOptions options("ab");
+  UnaryStringBenchmark(state, "count_substring", &options, /*value_max_size=*/256);
+}
+
+static std::vector<std::string> MakePatterns(int64_t num_patterns) {
+  // Random patterns over the same alphabet as the data, most of which never match
+  random::RandomArrayGenerator rng(kSeed + 1);
+  auto patterns = checked_pointer_cast<StringArray>(
+      rng.String(num_patterns, /*min_length=*/4, /*max_length=*/8,
+                 /*null_probability=*/0));
+  std::vector<std::string> out;
+  for (int64_t i = 0; i < num_patterns; ++i) {
+    out.emplace_back(patterns->GetView(i));
+  }
+  return out;
+}
+
+static void MatchAnySubstring(benchmark::State& state) {
+  MatchAnySubstringOptions options(MakePatterns(state.range(0)));
+  UnaryStringBenchmark(state, "match_any_substring", &options, /*value_max_size=*/256);
+}
+
 static void SplitPattern(benchmark::State& state) {
   SplitPatternOptions options("a");
   UnaryStringBenchmark(state, "split_pattern", &options);
@@ -114,6 +151,21 @@ static void MatchLikeSuffix(benchmark::State& state) {
   MatchSubstringOptions options("%abac");
   UnaryStringBenchmark(state, "match_like", &options);
 }
+
+// The regex equivalent of MatchAnySubstring
+static void MatchSubstringRegexAlternation(benchmark::State& state) {
+  std::string pattern;
+  for (const auto& literal : MakePatterns(state.range(0))) {
+    if (!pattern.empty()) pattern += "|";
+    for (const char c : literal) {
+      // Escape the metacharacters between 'A' and 'z'
+      if (c == '[' || c == '\\' || c == ']' || c == '^') pattern += '\\';
+      pattern += c;
+    }
+  }
+  MatchSubstringOptions options(pattern);
+  UnaryStringBenchmark(state, "match_substring_regex", &options, /*value_max_size=*/256);
+}
 #endif
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -242,6 +294,10 @@ BENCHMARK(AsciiLower);
 BENCHMARK(AsciiUpper);
 BENCHMARK(IsAlphaNumericAscii);
 BENCHMARK(MatchSubstring);
+BENCHMARK(MatchSubstringLong);
+BENCHMARK(FindSubstring);
+BENCHMARK(CountSubstring);
+BENCHMARK(MatchAnySubstring)->RangeMultiplier(8)->Range(2, 512);
 BENCHMARK(SplitPattern);
 BENCHMARK(TrimSingleAscii);
 BENCHMARK(TrimManyAscii);
@@ -250,6 +306,7 @@ BENCHMARK(MatchLike);
 BENCHMARK(MatchLikeSubstring);
 BENCHMARK(MatchLikePrefix);
 BENCHMARK(MatchLikeSuffix);
+BENCHMARK(MatchSubstringRegexAlternation)->RangeMultiplier(8)->Range(2, 512);
 #endif
 #ifdef ARROW_WITH_UTF8PROC
 BENCHMARK(Utf8Lower);
@@ -17,10 +17,15 @@
 
 #pragma once
 
+#include <optional>
 #include <sstream>
+#include <string_view>
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/dictionary_internal.h"
+#include "arrow/util/binary_view_util.h"
+#include "arrow/util/bit_run_reader.h"
 
 namespace arrow {
 namespace compute {
@@ -46,6 +51,13 @@ struct StringTransformBase {
   virtual Status InvalidInputSequence() {
     return Status::Invalid("Invalid UTF8 sequence in input");
   }
+
+  // Transforms which only ever output a substring of their input can return it
+  // here, which allows string view outputs to reference the input data instead
+  // of copying it.  This is resolved statically, so derived transforms shadow it.
+  std::optional<std::string_view> Substring(std::string_view input) {
+    return std::nullopt;
+  }
 };
 
 template <typename offset_type>
@@ -68,7 +80,7 @@ static int64_t GetVarBinaryValuesLength(const ArraySpan& span) {
 ///
 /// and returns the number of codeunits of the `output` sequence or a negative
 /// value if an invalid input sequence is detected.
-template <typename Type, typename StringTransform>
+template <typename Type, typename StringTransform, typename Enable = void>
 struct StringTransformExecBase {
   using offset_type = typename Type::offset_type;
   using ArrayType = typename TypeTraits<Type>::ArrayType;
@@ -121,6 +133,96 @@ struct StringTransformExecBase {
   }
 };
 
+/// Specialization for string view outputs. Transformed values which don't fit
+/// inline are written to a single new data buffer.  Substrings of the input
+/// (see StringTransformBase::Substring) are emitted as views into the input's
+/// data buffers, which are then shared with the output.
+template <typename Type, typename StringTransform>
+struct StringTransformExecBase<Type, StringTransform, enable_if_binary_view_like<Type>> {
+  using c_type = BinaryViewType::c_type;
+
+  static Status Execute(KernelContext* ctx, StringTransform* transform,
+                        const ExecSpan& batch, ExecResult* out) {
+    const ArraySpan& input = batch[0].array;
+    const c_type* views = input.GetValues<c_type>(1);
+    auto data_buffers = input.GetVariadicBuffers();
+
+    int64_t input_ncodeunits = 0;
+    ::arrow::internal::VisitSetBitRunsVoid(
+        input.buffers[0].data, input.offset, input.length,
+        [&](int64_t position, int64_t length) {
+          for (int64_t i = position; i < position + length; ++i) {
+            input_ncodeunits += views[i].size();
+          }
+        });
+    const int64_t max_output_ncodeunits =
+        transform->MaxCodeunits(input.length, input_ncodeunits);
+    RETURN_NOT_OK(CheckOutputCapacity(max_output_ncodeunits));
+
+    ArrayData* output = out->array_data().get();
+    ARROW_ASSIGN_OR_RAISE(auto views_buffer,
+                          ctx->Allocate(input.length * sizeof(c_type)));
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer, ctx->Allocate(max_output_ncodeunits));
+    auto* out_views = views_buffer->mutable_data_as<c_type>();
+    uint8_t* output_str = values_buffer->mutable_data();
+
+    // The new data buffer comes first, so input buffer indices are shifted by one
+    constexpr int32_t kOutputBufferIndex = 0;
+    int32_t output_ncodeunits = 0;
+    bool shares_input = false;
+    for (int64_t i = 0; i < input.length; i++) {
+      if (input.IsNull(i)) {
+        out_views[i] = {};
+        continue;
+      }
+      const std::string_view value =
+          ::arrow::util::FromBinaryView(views[i], data_buffers.data());
+      if (std::optional<std::string_view> sub = transform->Substring(value)) {
+        if (sub->size() <= BinaryViewType::kInlineSize) {
+          out_views[i] = ::arrow::util::ToInlineBinaryView(*sub);
+        } else {
+          out_views[i] = ::arrow::util::ToNonInlineBinaryView(
+              sub->data(), static_cast<int32_t>(sub->size()),
+              views[i].ref.buffer_index + 1,
+              views[i].ref.offset + static_cast<int32_t>(sub->data() - value.data()));
+          shares_input = true;
+        }
+        continue;
+      }
+      const auto encoded_nbytes = static_cast<int32_t>(transform->Transform(
+          reinterpret_cast<const uint8_t*>(value.data()),
+          static_cast<int64_t>(value.size()), output_str + output_ncodeunits));
+      if (encoded_nbytes < 0) {
+        return transform->InvalidInputSequence();
+      }
+      out_views[i] = ::arrow::util::ToBinaryView(output_str + output_ncodeunits,
+                                                 encoded_nbytes, kOutputBufferIndex,
+                                                 output_ncodeunits);
+      if (encoded_nbytes > BinaryViewType::kInlineSize) {
+        output_ncodeunits += encoded_nbytes;
+      }
+    }
+    ARROW_DCHECK_LE(output_ncodeunits, max_output_ncodeunits);
+    RETURN_NOT_OK(values_buffer->Resize(output_ncodeunits, /*shrink_to_fit=*/true));
+
+    output->buffers.resize(2);
+    output->buffers[1] = std::move(views_buffer);
+    output->buffers.push_back(std::move(values_buffer));
+    if (shares_input) {
+      output->buffers.insert(output->buffers.end(), data_buffers.begin(),
+                             data_buffers.end());
+    }
+    return Status::OK();
+  }
+
+  static Status CheckOutputCapacity(int64_t ncodeunits) {
+    if (ncodeunits > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Result might not fit in a string view array");
+    }
+    return Status::OK();
+  }
+};
+
 template <typename Type, typename StringTransform>
 struct StringTransformExec : public StringTransformExecBase<Type, StringTransform> {
   using StringTransformExecBase<Type, StringTransform>::Execute;
@@ -156,6 +258,12 @@ void MakeUnaryStringBatchKernel(
     kernel.mem_allocation = mem_allocation;
     ARROW_DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
+  {
+    ScalarKernel kernel{{utf8_view()}, utf8_view(), ExecFunctor<StringViewType>::Exec};
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    ARROW_DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+  AddDictionaryTransformKernels(func.get());
   ARROW_DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -176,6 +284,13 @@ void MakeUnaryStringBatchKernelWithState(
     kernel.mem_allocation = mem_allocation;
     ARROW_DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
+  {
+    using tview = ExecFunctor<StringViewType>;
+    ScalarKernel kernel{{utf8_view()}, utf8_view(), tview::Exec, tview::State::Init};
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    ARROW_DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+  AddDictionaryTransformKernels(func.get());
   ARROW_DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -240,6 +355,10 @@ void AddUnaryStringPredicate(std::string name, FunctionRegistry* registry,
     auto exec = GenerateVarBinaryToVarBinary<StringPredicateFunctor, Predicate>(ty);
     ARROW_DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec)));
   }
+  ARROW_DCHECK_OK(
+      func->AddKernel({utf8_view()}, boolean(),
+                      StringPredicateFunctor<StringViewType, Predicate>::Exec));
+  AddDictionaryLookupKernels(func.get());
   ARROW_DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
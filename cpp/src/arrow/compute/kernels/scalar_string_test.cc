@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/test_util_internal.h"
@@ -497,6 +498,14 @@ TYPED_TEST(TestBaseBinaryKernels, FindSubstring) {
   this->CheckUnary("find_substring", R"(["abcbaabbbcaabccabaab"])", this->offset_type(),
                    "[7]", &options_double_char_2);
 
+  // Candidates sharing the first and last byte of the pattern, within and
+  // after the first 16 bytes
+  MatchSubstringOptions options_long{"needle"};
+  this->CheckUnary("find_substring",
+                   R"(["nxxxxe needl needle", "nexdle nxxdle neexle needlz needle",
+                       "needlneedle", "eedle needl"])",
+                   this->offset_type(), "[13, 28, 5, -1]", &options_long);
+
   MatchSubstringOptions options_empty{""};
   this->CheckUnary("find_substring", R"(["", "a", null])", this->offset_type(),
                    "[0, 0, null]", &options_empty);
@@ -1053,6 +1062,107 @@ TYPED_TEST(TestStringKernels, AsciiLower) {
                    "[\"aaazzæÆ&\", null, \"\", \"bbb\"]");
 }
 
+TYPED_TEST(TestStringKernels, DictionaryEncodedInput) {
+  // Transforms stay dictionary-encoded, predicates are gathered from the
+  // dictionary values
+  for (const auto& index_type : {int8(), uint16(), int32()}) {
+    auto input = DictArrayFromJSON(dictionary(index_type, this->type()),
+                                   "[0, 1, null, 2, 0, 3, 1]",
+                                   R"(["aAb", null, " xyZ ", ""])");
+    for (const auto& func_name :
+         {"ascii_upper", "ascii_lower", "ascii_trim_whitespace", "ascii_reverse"}) {
+      CheckDictionary(func_name, {input});
+    }
+#ifdef ARROW_WITH_UTF8PROC
+    CheckDictionary("utf8_lower", {input});
+    CheckDictionary("utf8_length", {input}, /*result_is_encoded=*/false);
+#endif
+    CheckDictionary("binary_length", {input}, /*result_is_encoded=*/false);
+
+    MatchSubstringOptions options{"a", /*ignore_case=*/true};
+    CheckDictionary("match_substring", {input}, /*result_is_encoded=*/false, &options);
+    CheckDictionary("starts_with", {input}, /*result_is_encoded=*/false, &options);
+    CheckDictionary("find_substring", {input}, /*result_is_encoded=*/false, &options);
+    CheckDictionary("count_substring", {input}, /*result_is_encoded=*/false, &options);
+  }
+}
+
+TYPED_TEST(TestStringKernels, DictionaryEncodedChunks) {
+  // Chunks sharing a dictionary share the transformed dictionary
+  auto dict_type = dictionary(int8(), this->type());
+  auto values = ArrayFromJSON(this->type(), R"(["aAb", null, " xyZ "])");
+  auto other_values = ArrayFromJSON(this->type(), R"(["q", "AA"])");
+  ASSERT_OK_AND_ASSIGN(
+      auto first, DictionaryArray::FromArrays(
+                      dict_type, ArrayFromJSON(int8(), "[0, 1, null, 2]"), values));
+  ASSERT_OK_AND_ASSIGN(
+      auto second,
+      DictionaryArray::FromArrays(dict_type, ArrayFromJSON(int8(), "[2, 0]"), values));
+  ASSERT_OK_AND_ASSIGN(auto third,
+                       DictionaryArray::FromArrays(
+                           dict_type, ArrayFromJSON(int8(), "[1, null]"), other_values));
+  auto input = std::make_shared<ChunkedArray>(ArrayVector{first, second, third});
+
+  ASSERT_OK_AND_ASSIGN(Datum upper, CallFunction("ascii_upper", {input}));
+  const auto& chunks = upper.chunked_array()->chunks();
+  ASSERT_EQ(chunks.size(), 3);
+  ASSERT_EQ(chunks[0]->data()->dictionary, chunks[1]->data()->dictionary);
+  AssertArraysEqual(*ArrayFromJSON(this->type(), R"(["AAB", null, " XYZ "])"),
+                    *MakeArray(chunks[1]->data()->dictionary));
+  AssertArraysEqual(*ArrayFromJSON(this->type(), R"(["Q", "AA"])"),
+                    *MakeArray(chunks[2]->data()->dictionary));
+
+  MatchSubstringOptions options{"a", /*ignore_case=*/true};
+  ASSERT_OK_AND_ASSIGN(Datum matches, CallFunction("match_substring", {input}, &options));
+  AssertChunkedEqual(*ChunkedArrayFromJSON(boolean(), {"[true, null, null, false]",
+                                                       "[false, true]", "[true, null]"}),
+                     *matches.chunked_array());
+}
+
+TEST(TestStringViewKernels, Transforms) {
+  auto input = ArrayFromJSON(utf8_view(), R"(["  a long string value  ", null,
+                                            " xyZ ", "", "abcdefghijklmnop"])");
+  CheckScalar("ascii_upper", {input},
+              ArrayFromJSON(utf8_view(), R"(["  A LONG STRING VALUE  ", null, " XYZ ", "",
+                                             "ABCDEFGHIJKLMNOP"])"));
+  CheckScalar("ascii_trim_whitespace", {input},
+              ArrayFromJSON(utf8_view(), R"(["a long string value", null, "xyZ", "",
+                                             "abcdefghijklmnop"])"));
+  TrimOptions trim_options{" ap"};
+  CheckScalar("ascii_ltrim", {input},
+              ArrayFromJSON(utf8_view(), R"(["long string value  ", null, "xyZ ", "",
+                                             "bcdefghijklmnop"])"),
+              &trim_options);
+  ASSERT_OK_AND_ASSIGN(Datum binary_input, Cast(input, binary_view()));
+  SliceOptions slice_options{/*start=*/2, /*stop=*/16};
+  CheckScalar("binary_slice", {binary_input},
+              ArrayFromJSON(binary_view(), R"(["a long string ", null, "yZ ", "",
+                                               "cdefghijklmnop"])"),
+              &slice_options);
+  CheckScalar("binary_length", {input}, ArrayFromJSON(int32(), "[23, null, 5, 0, 16]"));
+  MatchSubstringOptions match_options{"ing"};
+  CheckScalar("match_substring", {input},
+              ArrayFromJSON(boolean(), "[true, null, false, false, false]"),
+              &match_options);
+  CheckScalar("ascii_is_lower", {input},
+              ArrayFromJSON(boolean(), "[true, null, false, false, true]"));
+}
+
+TEST(TestStringViewKernels, SubstringsReferenceInput) {
+  // Trimmed values which aren't inlined are views into the input's data buffers
+  auto input = ArrayFromJSON(utf8_view(), R"(["  a long string value  ", "  short  "])");
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("ascii_trim_whitespace", {input}));
+  ValidateOutput(result);
+  AssertArraysEqual(*ArrayFromJSON(utf8_view(), R"(["a long string value", "short"])"),
+                    *result.make_array(), /*verbose=*/true);
+  const auto& input_buffers = input->data()->buffers;
+  const auto& output_buffers = result.array()->buffers;
+  ASSERT_EQ(input_buffers.size(), 3);
+  ASSERT_EQ(output_buffers.size(), 4);
+  ASSERT_EQ(output_buffers[2]->size(), 0);
+  ASSERT_EQ(output_buffers[3], input_buffers[2]);
+}
+
 TYPED_TEST(TestStringKernels, AsciiSwapCase) {
   this->CheckUnary("ascii_swapcase", "[]", this->type(), "[]");
   this->CheckUnary("ascii_swapcase", "[\"aAazZæÆ&\", null, \"\", \"BbB\"]", this->type(),
@@ -1567,6 +1677,37 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringIgnoreCase) {
 }
 #endif
 
+TYPED_TEST(TestBaseBinaryKernels, MatchAnySubstring) {
+  MatchAnySubstringOptions options{{"ab", "bcd", "cd"}};
+  this->CheckUnary("match_any_substring", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_substring",
+                   R"(["xab", "acb", "bc", null, "xxcdxx", "AB", "abcd", ""])",
+                   boolean(), "[true, false, false, null, true, false, true, false]",
+                   &options);
+
+  // Patterns which are prefixes or suffixes of each other
+  MatchAnySubstringOptions options_nested{{"abcde", "bc", "abcdf", "e"}};
+  this->CheckUnary("match_any_substring", R"(["abcdx", "abdx", "aabcdf", "xxxe", "ab"])",
+                   boolean(), "[true, false, true, true, false]", &options_nested);
+
+  MatchAnySubstringOptions options_none{{}};
+  this->CheckUnary("match_any_substring", R"(["abc", null, ""])", boolean(),
+                   "[false, null, false]", &options_none);
+
+  MatchAnySubstringOptions options_empty{{"xyz", ""}};
+  this->CheckUnary("match_any_substring", R"(["abc", null, ""])", boolean(),
+                   "[true, null, true]", &options_empty);
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernels, MatchAnySubstringIgnoreCase) {
+  MatchAnySubstringOptions options{{"aé(", "Err"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_substring",
+                   R"(["abc", "aEb", "baÉ(", "ERROR", "ae(", "Aé(", "er"])", boolean(),
+                   "[false, false, true, true, false, true, false]", &options);
+}
+#endif
+
 TYPED_TEST(TestBaseBinaryKernels, MatchStartsWith) {
   MatchSubstringOptions options{"abab"};
   this->CheckUnary("starts_with", "[]", boolean(), "[]", &options);
@@ -1665,6 +1806,42 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexInvalid) {
       CallFunction("match_substring_regex", {input}, &options));
 }
 
+TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexCached) {
+  // The compiled regex is reused by the second call, including its error
+  Datum input = ArrayFromJSON(this->type(), R"(["abc", "ab[", null])");
+  MatchSubstringOptions options{"b\\["};
+  MatchSubstringOptions invalid_options{"b["};
+  for (int i = 0; i < 2; ++i) {
+    this->CheckUnary("match_substring_regex", R"(["abc", "ab[", null])", boolean(),
+                     "[false, true, null]", &options);
+    ASSERT_RAISES(Invalid,
+                  CallFunction("match_substring_regex", {input}, &invalid_options));
+  }
+}
+
+TYPED_TEST(TestStringKernels, MatchAnyRegex) {
+  MatchAnySubstringOptions options{{"^ab", "\\d$", "é+"}};
+  this->CheckUnary("match_any_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_regex", R"(["abc", "cab", "c4", "4c", null, "éé", "É"])",
+                   boolean(), "[true, false, true, false, null, true, false]", &options);
+
+  MatchAnySubstringOptions options_insensitive{{"^ab", "é+"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_regex", R"(["abc", "AB", "É", "cab"])", boolean(),
+                   "[true, true, true, false]", &options_insensitive);
+
+  MatchAnySubstringOptions options_none{{}};
+  this->CheckUnary("match_any_regex", R"(["abc", null, ""])", boolean(),
+                   "[false, null, false]", &options_none);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnyRegexInvalid) {
+  Datum input = ArrayFromJSON(this->type(), "[null]");
+  MatchAnySubstringOptions options{{"valid", "invalid["}};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid regular expression: missing ]"),
+      CallFunction("match_any_regex", {input}, &options));
+}
+
 TYPED_TEST(TestStringKernels, MatchLike) {
   auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo\n", null])";
 
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <string>
 
+#include "arrow/array/builder_binary.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
@@ -47,6 +48,9 @@ void MakeUnaryStringUTF8TransformKernel(std::string name, FunctionRegistry* regi
     auto exec = GenerateVarBinaryToVarBinary<Transformer>(ty);
     DCHECK_OK(func->AddKernel({ty}, ty, std::move(exec)));
   }
+  DCHECK_OK(
+      func->AddKernel({utf8_view()}, utf8_view(), Transformer<StringViewType>::Exec));
+  AddDictionaryTransformKernels(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -640,6 +644,37 @@ struct Utf8NormalizeExec : public Utf8NormalizeBase {
   }
 };
 
+template <>
+struct Utf8NormalizeExec<StringViewType> : public Utf8NormalizeBase {
+  using State = OptionsWrapper<Utf8NormalizeOptions>;
+
+  using Utf8NormalizeBase::Utf8NormalizeBase;
+
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& options = State::Get(ctx);
+    Utf8NormalizeExec exec{options};
+
+    const ArraySpan& array = batch[0].array;
+    StringViewBuilder builder(ctx->memory_pool());
+    BufferBuilder scratch(ctx->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(array.length));
+
+    RETURN_NOT_OK(VisitArraySpanInline<StringViewType>(
+        array,
+        [&](std::string_view v) {
+          scratch.Rewind(0);
+          ARROW_ASSIGN_OR_RAISE(auto n_bytes, exec.Decompose(v, &scratch));
+          return builder.Append(scratch.data(), n_bytes);
+        },
+        [&]() { return builder.AppendNull(); }));
+
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+};
+
 const FunctionDoc utf8_normalize_doc(
     "Utf8-normalize input",
     ("For each string in `strings`, return the normal form.\n\n"
@@ -684,6 +719,12 @@ void AddUtf8StringLength(FunctionRegistry* registry) {
         applicator::ScalarUnaryNotNull<Int64Type, LargeStringType, Utf8Length>::Exec;
     DCHECK_OK(func->AddKernel({large_utf8()}, int64(), std::move(exec)));
   }
+  {
+    auto exec =
+        applicator::ScalarUnaryNotNull<Int32Type, StringViewType, Utf8Length>::Exec;
+    DCHECK_OK(func->AddKernel({utf8_view()}, int32(), std::move(exec)));
+  }
+  AddDictionaryLookupKernels(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -1278,6 +1319,12 @@ void AddUtf8StringSlice(FunctionRegistry* registry) {
     DCHECK_OK(
         func->AddKernel({ty}, ty, std::move(exec), SliceCodeunitsTransform::State::Init));
   }
+  {
+    ScalarKernel kernel({utf8_view()}, utf8_view(), SliceCodeunits<StringViewType>::Exec,
+                        SliceCodeunitsTransform::State::Init);
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <functional>
 
 #include "benchmark/benchmark.h"
@@ -84,6 +85,29 @@ static void BenchmarkTemporal(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+// Sorted input, as in time series, crosses few timezone transitions between
+// consecutive values
+template <UnaryOp& Op, std::shared_ptr<DataType>& timestamp_type>
+static void BenchmarkTemporalSorted(benchmark::State& state) {
+  RegressionArgs args(state);
+  ExecContext* ctx = default_exec_context();
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Numeric<Int64Type>(array_size, kInt64Min, kInt64Max,
+                                       /*null_probability=*/0);
+  auto values = array->data()->GetMutableValues<int64_t>(1);
+  std::sort(values, values + array_size);
+  EXPECT_OK_AND_ASSIGN(auto timestamp_array, array->View(timestamp_type));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Op(timestamp_array, ctx).status());
+  }
+
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 template <BinaryOp& Op, std::shared_ptr<DataType>& timestamp_type>
 static void BenchmarkTemporalBinary(benchmark::State& state) {
   RegressionArgs args(state);
@@ -167,6 +191,8 @@ static void BenchmarkAssumeTimezone(benchmark::State& state) {
 }
 
 auto zoned = timestamp(TimeUnit::NANO, "Pacific/Marquesas");
+// Unlike Pacific/Marquesas, observes daylight saving time
+auto zoned_dst = timestamp(TimeUnit::NANO, "America/New_York");
 auto non_zoned = timestamp(TimeUnit::NANO);
 auto time32_type = time32(TimeUnit::MILLI);
 auto time64_type = time64(TimeUnit::NANO);
@@ -189,10 +215,15 @@ auto date64_type = date64();
 
 #define DECLARE_TEMPORAL_BENCHMARKS(OP)                                 \
   BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, non_zoned)->Apply(SetArgs); \
-  BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, zoned)->Apply(SetArgs);
+  BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, zoned)->Apply(SetArgs);     \
+  BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, zoned_dst)->Apply(SetArgs);
+
+#define DECLARE_TEMPORAL_BENCHMARKS_ZONED(OP)                           \
+  BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, zoned)->Apply(SetArgs);     \
+  BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, zoned_dst)->Apply(SetArgs);
 
-#define DECLARE_TEMPORAL_BENCHMARKS_ZONED(OP) \
-  BENCHMARK_TEMPLATE(BenchmarkTemporal, OP, zoned)->Apply(SetArgs);
+#define DECLARE_TEMPORAL_SORTED_BENCHMARKS(OP)                                \
+  BENCHMARK_TEMPLATE(BenchmarkTemporalSorted, OP, zoned_dst)->Apply(SetArgs);
 
 #define DECLARE_TEMPORAL_BINARY_BENCHMARKS_DATES_AND_TIMESTAMPS(OP)             \
   BENCHMARK_TEMPLATE(BenchmarkTemporalBinary, OP, non_zoned)->Apply(SetArgs);   \
@@ -239,10 +270,17 @@ DECLARE_TEMPORAL_BENCHMARKS(Millisecond);
 DECLARE_TEMPORAL_BENCHMARKS(Microsecond);
 DECLARE_TEMPORAL_BENCHMARKS(Nanosecond);
 DECLARE_TEMPORAL_BENCHMARKS(Subsecond);
+DECLARE_TEMPORAL_BENCHMARKS(YearMonthDay);
+DECLARE_TEMPORAL_BENCHMARKS(ISOCalendar);
+DECLARE_TEMPORAL_SORTED_BENCHMARKS(Year);
+DECLARE_TEMPORAL_SORTED_BENCHMARKS(Hour);
+DECLARE_TEMPORAL_SORTED_BENCHMARKS(IsDaylightSavings);
+DECLARE_TEMPORAL_SORTED_BENCHMARKS(LocalTimestamp);
 
 // Other temporal benchmarks
 BENCHMARK_TEMPLATE(BenchmarkStrftime, non_zoned)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BenchmarkStrftime, zoned)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchmarkStrftime, zoned_dst)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BenchmarkStrptime, non_zoned)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BenchmarkStrptime, zoned)->Apply(SetArgs);
 BENCHMARK(BenchmarkAssumeTimezone)->Apply(SetArgs);
@@ -887,6 +887,33 @@ TEST_F(ScalarTemporalTest, TestZoned2) {
   }
 }
 
+TEST_F(ScalarTemporalTest, TestZonedTransitions) {
+  // Unsorted values around daylight saving time transitions and outside of the
+  // range covered by the cached timezone offsets
+  const char* times =
+      R"(["2021-03-14T06:59:59", "2021-11-07T06:00:00", "2021-03-14T07:00:00",
+          "1850-07-01T12:00:00", "2021-11-07T05:59:59", "2150-01-01T12:00:00",
+          "2021-03-14T06:59:59", null])";
+  auto hour = "[1, 1, 3, 7, 1, 7, 1, null]";
+  auto is_dst = "[false, false, true, false, true, false, false, null]";
+  auto strftime =
+      R"(["2021-03-14T01:59:59 EST", "2021-11-07T01:00:00 EST",
+          "2021-03-14T03:00:00 EDT", "1850-07-01T07:03:58 LMT",
+          "2021-11-07T01:59:59 EDT", "2150-01-01T07:00:00 EST",
+          "2021-03-14T01:59:59 EST", null])";
+  auto local =
+      R"(["2021-03-14T01:59:59", "2021-11-07T01:00:00", "2021-03-14T03:00:00",
+          "1850-07-01T07:03:58", "2021-11-07T01:59:59", "2150-01-01T07:00:00",
+          "2021-03-14T01:59:59", null])";
+
+  auto unit = timestamp(TimeUnit::SECOND, "America/New_York");
+  auto options = StrftimeOptions("%Y-%m-%dT%H:%M:%S %Z");
+  CheckScalarUnary("hour", unit, times, int64(), hour);
+  CheckScalarUnary("is_dst", unit, times, boolean(), is_dst);
+  CheckScalarUnary("strftime", unit, times, utf8(), strftime, &options);
+  CheckScalarUnary("local_timestamp", unit, times, timestamp(TimeUnit::SECOND), local);
+}
+
 TEST_F(ScalarTemporalTest, TestNonexistentTimezone) {
   auto data_buffer = Buffer::Wrap(std::vector<int32_t>{1, 2, 3});
   auto null_buffer = Buffer::FromString("\xff");
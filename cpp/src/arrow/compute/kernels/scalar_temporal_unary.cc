@@ -322,8 +322,8 @@ struct YearMonthDayVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
-    return [=](TimestampType::c_type arg) {
-      const auto ymd = GetYearMonthDay<Duration>(arg, ZonedLocalizer{tz});
+    return [=, localizer = ZonedLocalizer{tz}](TimestampType::c_type arg) {
+      const auto ymd = GetYearMonthDay<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(static_cast<const int32_t>(ymd[0]));
       field_builders[1]->UnsafeAppend(static_cast<const uint32_t>(ymd[1]));
       field_builders[2]->UnsafeAppend(static_cast<const uint32_t>(ymd[2]));
@@ -663,14 +663,16 @@ struct Nanosecond {
 template <typename Duration>
 struct IsDaylightSavings {
   explicit IsDaylightSavings(const FunctionOptions* options, const time_zone* tz)
-      : tz_(tz) {}
+      : localizer_(tz) {}
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status*) const {
-    return tz_->get_info(sys_time<Duration>{Duration{arg}}).save.count() != 0;
+    return localizer_
+        .GetInterval(floor<std::chrono::seconds>(Duration{arg}).count())
+        .is_dst;
   }
 
-  const time_zone* tz_;
+  ZonedLocalizer localizer_;
 };
 
 // ----------------------------------------------------------------------
@@ -1485,8 +1487,8 @@ struct ISOCalendarVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
-    return [=](TimestampType::c_type arg) {
-      const auto iso_calendar = GetIsoCalendar<Duration>(arg, ZonedLocalizer{tz});
+    return [=, localizer = ZonedLocalizer{tz}](TimestampType::c_type arg) {
+      const auto iso_calendar = GetIsoCalendar<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(iso_calendar[0]);
       field_builders[1]->UnsafeAppend(iso_calendar[1]);
       field_builders[2]->UnsafeAppend(iso_calendar[2]);
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+#include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/temporal_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+using arrow_vendored::date::sys_info;
+using arrow_vendored::date::sys_seconds;
+using std::chrono::seconds;
+
+namespace {
+
+// 1900-01-01 and 2100-01-01
+constexpr int64_t kTableBegin = -2208988800LL;
+constexpr int64_t kTableEnd = 4102444800LL;
+
+TimeZoneInterval MakeInterval(const sys_info& info) {
+  return {info.begin.time_since_epoch().count(), info.end.time_since_epoch().count(),
+          info.offset, info.save.count() != 0, info.abbrev};
+}
+
+}  // namespace
+
+TimeZoneOffsets::TimeZoneOffsets(const time_zone* tz) : tz_(tz) {
+  auto info = tz_->get_info(sys_seconds(seconds(kTableBegin)));
+  while (true) {
+    intervals_.push_back(MakeInterval(info));
+    if (info.end.time_since_epoch().count() >= kTableEnd) break;
+    info = tz_->get_info(info.end);
+  }
+}
+
+std::shared_ptr<const TimeZoneOffsets> TimeZoneOffsets::Get(const time_zone* tz) {
+  // Timezones are never destroyed, so they can be keyed by address
+  static std::mutex mutex;
+  static std::unordered_map<const time_zone*, std::shared_ptr<const TimeZoneOffsets>>
+      tables;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& table = tables[tz];
+  if (table == nullptr) {
+    table = std::make_shared<TimeZoneOffsets>(tz);
+  }
+  return table;
+}
+
+void TimeZoneOffsets::FindInterval(int64_t t, TimeZoneInterval* out) const {
+  if (t < intervals_.front().begin || t >= intervals_.back().end) {
+    // Outside of the table
+    *out = MakeInterval(tz_->get_info(sys_seconds(seconds(t))));
+    return;
+  }
+  // The first interval beginning after t follows the one containing t
+  auto it = std::upper_bound(
+      intervals_.begin(), intervals_.end(), t,
+      [](int64_t value, const TimeZoneInterval& interval) {
+        return value < interval.begin;
+      });
+  *out = *(it - 1);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -19,8 +19,12 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/util/macros.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -96,15 +100,63 @@ struct NonZonedLocalizer {
   sys_days ConvertDays(sys_days d) const { return d; }
 };
 
+// A period during which the UTC offset of a timezone doesn't change
+struct TimeZoneInterval {
+  // In seconds since the epoch, end excluded
+  int64_t begin;
+  int64_t end;
+  std::chrono::seconds offset;
+  bool is_dst;
+  std::string abbrev;
+};
+
+// The UTC offsets of a timezone between 1900 and 2100, precomputed from the
+// timezone database.  Looking up an offset in this table is a binary search
+// over the transitions of the timezone, without the locking and string
+// copies of time_zone::get_info().
+//
+// Tables are built once per timezone and shared by all kernels.
+class TimeZoneOffsets {
+ public:
+  explicit TimeZoneOffsets(const time_zone* tz);
+
+  // Get the shared table of a timezone, building it on first use
+  static std::shared_ptr<const TimeZoneOffsets> Get(const time_zone* tz);
+
+  // Find the interval containing the given time, in seconds since the epoch
+  void FindInterval(int64_t t, TimeZoneInterval* out) const;
+
+ private:
+  const time_zone* tz_;
+  // Ordered and contiguous
+  std::vector<TimeZoneInterval> intervals_;
+};
+
 struct ZonedLocalizer {
   using days_t = local_days;
 
+  explicit ZonedLocalizer(const time_zone* tz)
+      : tz(tz), offsets_(TimeZoneOffsets::Get(tz)) {}
+
   // Timezone-localizing conversions: UTC -> local time
   const time_zone* tz;
 
   template <typename Duration>
   local_time<Duration> ConvertTimePoint(int64_t t) const {
-    return tz->to_local(sys_time<Duration>(Duration{t}));
+    const Duration d{t};
+    const auto& interval = GetInterval(floor<std::chrono::seconds>(d).count());
+    return local_time<Duration>(d + interval.offset);
+  }
+
+  // Get the UTC offset interval containing the given time in seconds.
+  //
+  // Timestamps are often sorted or clustered, so the last interval is tried
+  // before searching the table.
+  const TimeZoneInterval& GetInterval(int64_t t) const {
+    if (ARROW_PREDICT_FALSE(t < last_interval_.begin || t >= last_interval_.end)) {
+      offsets_->FindInterval(t, &last_interval_);
+    }
+    return last_interval_;
   }
 
   template <typename Duration>
@@ -123,17 +175,22 @@ struct ZonedLocalizer {
   }
 
   local_days ConvertDays(sys_days d) const { return local_days(year_month_day(d)); }
+
+ private:
+  std::shared_ptr<const TimeZoneOffsets> offsets_;
+  // Empty until the first lookup
+  mutable TimeZoneInterval last_interval_{0, 0, std::chrono::seconds{0}, false, {}};
 };
 
 template <typename Duration>
 struct TimestampFormatter {
   const char* format;
-  const time_zone* tz;
+  ZonedLocalizer localizer;
   std::ostringstream bufstream;
 
   explicit TimestampFormatter(const std::string& format, const time_zone* tz,
                               const std::locale& locale)
-      : format(format.c_str()), tz(tz) {
+      : format(format.c_str()), localizer(tz) {
     bufstream.imbue(locale);
     // Propagate errors as C++ exceptions (to get an actual error message)
     bufstream.exceptions(std::ios::failbit | std::ios::badbit);
@@ -141,9 +198,14 @@ struct TimestampFormatter {
 
   Result<std::string> operator()(int64_t arg) {
     bufstream.str("");
-    const auto zt = zoned_time<Duration>{tz, sys_time<Duration>(Duration{arg})};
+    // Equivalent to formatting a zoned_time, using the cached UTC offsets
+    using LocalDuration = std::common_type_t<Duration, std::chrono::seconds>;
+    const Duration d{arg};
+    const auto& interval = localizer.GetInterval(floor<std::chrono::seconds>(d).count());
+    const local_time<LocalDuration> local(d + interval.offset);
     try {
-      arrow_vendored::date::to_stream(bufstream, format, zt);
+      arrow_vendored::date::to_stream(bufstream, format, local, &interval.abbrev,
+                                      &interval.offset);
     } catch (const std::runtime_error& ex) {
       bufstream.clear();
       return Status::Invalid("Failed formatting timestamp: ", ex.what());
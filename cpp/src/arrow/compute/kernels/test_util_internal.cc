@@ -24,6 +24,7 @@
 #include "arrow/array.h"
 #include "arrow/array/validate.h"
 #include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
@@ -173,8 +174,9 @@ void CheckScalar(std::string func_name, const DatumVector& inputs, Datum expecte
 }
 
 Datum CheckDictionaryNonRecursive(const std::string& func_name, const DatumVector& args,
-                                  bool result_is_encoded) {
-  EXPECT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, args));
+                                  bool result_is_encoded,
+                                  const FunctionOptions* options) {
+  EXPECT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, args, options));
   ValidateOutput(actual);
 
   DatumVector decoded_args;
@@ -188,7 +190,7 @@ Datum CheckDictionaryNonRecursive(const std::string& func_name, const DatumVecto
       decoded_args.push_back(arg);
     }
   }
-  EXPECT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, decoded_args));
+  EXPECT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, decoded_args, options));
 
   if (result_is_encoded) {
     EXPECT_EQ(Type::DICTIONARY, actual.type()->id())
@@ -205,8 +207,8 @@ Datum CheckDictionaryNonRecursive(const std::string& func_name, const DatumVecto
 }
 
 void CheckDictionary(const std::string& func_name, const DatumVector& args,
-                     bool result_is_encoded) {
-  auto actual = CheckDictionaryNonRecursive(func_name, args, result_is_encoded);
+                     bool result_is_encoded, const FunctionOptions* options) {
+  auto actual = CheckDictionaryNonRecursive(func_name, args, result_is_encoded, options);
 
   if (actual.is_scalar()) return;
   ASSERT_TRUE(actual.is_array());
@@ -215,22 +217,23 @@ void CheckDictionary(const std::string& func_name, const DatumVector& args,
   // Check all scalars
   for (int64_t i = 0; i < actual.length(); i++) {
     CheckDictionaryNonRecursive(func_name, GetDatums(GetScalars(args, i)),
-                                result_is_encoded);
+                                result_is_encoded, options);
   }
 
   // Check slices of the input
   const auto slice_length = actual.length() / 3;
   if (slice_length > 0) {
     CheckDictionaryNonRecursive(func_name, SliceArrays(args, 0, slice_length),
-                                result_is_encoded);
+                                result_is_encoded, options);
     CheckDictionaryNonRecursive(func_name, SliceArrays(args, slice_length, slice_length),
-                                result_is_encoded);
+                                result_is_encoded, options);
     CheckDictionaryNonRecursive(func_name, SliceArrays(args, 2 * slice_length),
-                                result_is_encoded);
+                                result_is_encoded, options);
   }
 
   // Check empty slice
-  CheckDictionaryNonRecursive(func_name, SliceArrays(args, 0, 0), result_is_encoded);
+  CheckDictionaryNonRecursive(func_name, SliceArrays(args, 0, 0), result_is_encoded,
+                              options);
 
   // Check chunked arrays
   if (slice_length > 0) {
@@ -245,7 +248,48 @@ void CheckDictionary(const std::string& func_name, const DatumVector& args,
         chunked_args.push_back(arg);
       }
     }
-    CheckDictionaryNonRecursive(func_name, chunked_args, result_is_encoded);
+    CheckDictionaryNonRecursive(func_name, chunked_args, result_is_encoded, options);
+  }
+}
+
+void CheckRunEndEncoded(const std::string& func_name, const DatumVector& args,
+                        const FunctionOptions* options) {
+  auto check = [&](const DatumVector& plain_args,
+                   const std::shared_ptr<DataType>& run_end_type) {
+    DatumVector encoded_args;
+    encoded_args.reserve(plain_args.size());
+    for (const auto& arg : plain_args) {
+      if (arg.is_array()) {
+        ASSERT_OK_AND_ASSIGN(auto encoded,
+                             RunEndEncode(arg, RunEndEncodeOptions(run_end_type)));
+        encoded_args.push_back(encoded);
+      } else {
+        encoded_args.push_back(arg);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func_name, plain_args, options));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func_name, encoded_args, options));
+    ValidateOutput(actual);
+    ASSERT_EQ(Type::RUN_END_ENCODED, actual.type()->id())
+        << "Result should have been run-end encoded";
+    ASSERT_OK_AND_ASSIGN(auto decoded, RunEndDecode(actual));
+    AssertDatumsApproxEqual(expected, decoded, /*verbose=*/true);
+  };
+
+  int64_t length = 0;
+  for (const auto& arg : args) {
+    if (arg.is_array()) length = arg.length();
+  }
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("run_end_type = ", *run_end_type);
+    check(args, run_end_type);
+    // Check slices of the input
+    const auto slice_length = length / 3;
+    if (slice_length > 0) {
+      check(SliceArrays(args, slice_length, slice_length), run_end_type);
+      check(SliceArrays(args, 2 * slice_length), run_end_type);
+    }
+    check(SliceArrays(args, 0, 0), run_end_type);
   }
 }
 
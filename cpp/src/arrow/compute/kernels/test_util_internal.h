@@ -107,7 +107,14 @@ void CheckScalar(std::string func_name, const DatumVector& inputs, Datum expecte
 // result_is_encoded controls whether the result is expected to be a
 // dictionary or not.
 void CheckDictionary(const std::string& func_name, const DatumVector& args,
-                     bool result_is_encoded = true);
+                     bool result_is_encoded = true,
+                     const FunctionOptions* options = nullptr);
+
+// Like CheckScalar, but run-end encodes the array arguments, checks that
+// the result is run-end encoded and compares it to the result of calling
+// the function on the plain arguments.
+void CheckRunEndEncoded(const std::string& func_name, const DatumVector& args,
+                        const FunctionOptions* options = nullptr);
 
 // Just call the function with the given arguments.
 void CheckScalarNonRecursive(const std::string& func_name, const DatumVector& inputs,
@@ -29,6 +29,7 @@
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bitmap.h"
 #include "arrow/util/bitmap_ops.h"
@@ -174,6 +175,42 @@ class ArrayCompareSorter {
   }
 };
 
+// Binary views are compared on their inline prefix first, so that most
+// comparisons don't need to dereference the out-of-line data buffers.
+template <>
+class ArrayCompareSorter<BinaryViewType> {
+ public:
+  Result<NullPartitionResult> operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                         const Array& array, int64_t offset,
+                                         const ArraySortOptions& options, ExecContext*) {
+    const auto& values = checked_cast<const BinaryViewArray&>(array);
+    const BinaryViewType::c_type* views = values.raw_values() - offset;
+    const std::shared_ptr<Buffer>* data_buffers = values.data()->buffers.data() + 2;
+
+    const auto p = PartitionNulls<BinaryViewArray, StablePartitioner>(
+        indices_begin, indices_end, values, offset, options.null_placement);
+    if (options.order == SortOrder::Ascending) {
+      std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
+                       [&](uint64_t left, uint64_t right) {
+                         return ::arrow::util::CompareBinaryView(
+                                    views[left], views[right], data_buffers,
+                                    data_buffers) < 0;
+                       });
+    } else {
+      std::stable_sort(p.non_nulls_begin, p.non_nulls_end,
+                       [&](uint64_t left, uint64_t right) {
+                         return ::arrow::util::CompareBinaryView(
+                                    views[right], views[left], data_buffers,
+                                    data_buffers) < 0;
+                       });
+    }
+    return p;
+  }
+};
+
+template <>
+class ArrayCompareSorter<StringViewType> : public ArrayCompareSorter<BinaryViewType> {};
+
 template <>
 class ArrayCompareSorter<DictionaryType> {
  public:
@@ -510,6 +547,7 @@ struct ArraySorter<Type, enable_if_t<is_integer_type<Type>::value &&
 template <typename Type>
 struct ArraySorter<
     Type, enable_if_t<is_floating_type<Type>::value || is_base_binary_type<Type>::value ||
+                      is_binary_view_like_type<Type>::value ||
                       is_fixed_size_binary_type<Type>::value ||
                       is_dictionary_type<Type>::value || is_struct_type<Type>::value>> {
   ArrayCompareSorter<Type> impl;
@@ -608,6 +646,12 @@ void AddArraySortingKernels(VectorKernel base, VectorFunction* func) {
     base.exec = GenerateVarBinaryBase<ExecTemplate, UInt64Type>(*physical_type);
     DCHECK_OK(func->AddKernel(base));
   }
+  base.signature = KernelSignature::Make({binary_view()}, uint64());
+  base.exec = ExecTemplate<UInt64Type, BinaryViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
+  base.signature = KernelSignature::Make({utf8_view()}, uint64());
+  base.exec = ExecTemplate<UInt64Type, StringViewType>::Exec;
+  DCHECK_OK(func->AddKernel(base));
   base.signature = KernelSignature::Make({Type::FIXED_SIZE_BINARY}, uint64());
   base.exec = ExecTemplate<UInt64Type, FixedSizeBinaryType>::Exec;
   DCHECK_OK(func->AddKernel(base));
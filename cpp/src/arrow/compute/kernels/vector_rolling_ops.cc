@@ -0,0 +1,639 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector functions computing an aggregate over a sliding window of rows.
+//
+// Each function is evaluated in a single pass: as the window slides, values
+// entering it are added to a running state and values leaving it are removed,
+// so the cost doesn't depend on the window size.
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/compute/kernels/common_internal.h"
+#include "arrow/result.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow::compute::internal {
+
+namespace {
+
+using RollingState = OptionsWrapper<RollingOptions>;
+
+// A forward-only cursor over the values of an input made of one or more chunks,
+// so that chunked inputs needn't be concatenated.
+template <typename CType>
+class ChunkedCursor {
+ public:
+  explicit ChunkedCursor(const std::vector<ArraySpan>& chunks) : chunks_(chunks) {
+    SkipEmptyChunks();
+  }
+
+  bool IsValid() const {
+    return validity_ == nullptr || bit_util::GetBit(validity_, chunk_offset_ + position_);
+  }
+
+  CType Value() const { return values_[position_]; }
+
+  void Next() {
+    if (++position_ == chunks_[chunk_index_].length) {
+      ++chunk_index_;
+      position_ = 0;
+      SkipEmptyChunks();
+    }
+  }
+
+ private:
+  void SkipEmptyChunks() {
+    while (chunk_index_ < chunks_.size() && chunks_[chunk_index_].length == 0) {
+      ++chunk_index_;
+    }
+    if (chunk_index_ < chunks_.size()) {
+      const ArraySpan& chunk = chunks_[chunk_index_];
+      values_ = chunk.GetValues<CType>(1);
+      validity_ = chunk.MayHaveNulls() ? chunk.buffers[0].data : nullptr;
+      chunk_offset_ = chunk.offset;
+    }
+  }
+
+  const std::vector<ArraySpan>& chunks_;
+  size_t chunk_index_ = 0;
+  int64_t position_ = 0;
+  const CType* values_ = nullptr;
+  const uint8_t* validity_ = nullptr;
+  int64_t chunk_offset_ = 0;
+};
+
+// Counts of the NaN and infinite values in a window, which can't be removed
+// from a running floating-point sum.
+struct NonFiniteCounts {
+  int64_t nan = 0;
+  int64_t pos_inf = 0;
+  int64_t neg_inf = 0;
+
+  // Return false if the value is finite and should be accumulated
+  template <typename CType>
+  bool Update(CType value, int64_t delta) {
+    if constexpr (std::is_floating_point_v<CType>) {
+      if (ARROW_PREDICT_TRUE(std::isfinite(value))) return false;
+      if (std::isnan(value)) {
+        nan += delta;
+      } else if (value > 0) {
+        pos_inf += delta;
+      } else {
+        neg_inf += delta;
+      }
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  bool any() const { return nan > 0 || pos_inf > 0 || neg_inf > 0; }
+
+  double Result() const {
+    if (nan > 0 || (pos_inf > 0 && neg_inf > 0)) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    return pos_inf > 0 ? std::numeric_limits<double>::infinity()
+                       : -std::numeric_limits<double>::infinity();
+  }
+};
+
+// Kahan summation, so that the rounding errors of adding and removing values
+// don't accumulate as the window slides
+struct CompensatedSum {
+  double sum = 0;
+  double compensation = 0;
+
+  void Add(double value) {
+    const double y = value - compensation;
+    const double t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+  }
+};
+
+template <typename ArgType, typename Enable = void>
+struct RollingSumOutType {
+  using Type = DoubleType;
+};
+
+template <typename ArgType>
+struct RollingSumOutType<ArgType, enable_if_signed_integer<ArgType>> {
+  using Type = Int64Type;
+};
+
+template <typename ArgType>
+struct RollingSumOutType<ArgType, enable_if_unsigned_integer<ArgType>> {
+  using Type = UInt64Type;
+};
+
+// The window states below are given the values entering and leaving the window,
+// along with their row indices, and only see non-null values.
+
+template <typename ArgType>
+struct RollingSum {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  using OutType = typename RollingSumOutType<ArgType>::Type;
+  using OutValue = typename GetOutputType<OutType>::T;
+
+  void Add(int64_t, ArgValue value) { Update(value, 1); }
+  void Remove(int64_t, ArgValue value) { Update(value, -1); }
+
+  bool Value(int64_t, OutValue* out) const {
+    if constexpr (is_integer_type<ArgType>::value) {
+      *out = static_cast<OutValue>(sum);
+    } else {
+      *out = non_finite.any() ? non_finite.Result() : compensated.sum;
+    }
+    return true;
+  }
+
+ private:
+  void Update(ArgValue value, int64_t delta) {
+    if constexpr (is_integer_type<ArgType>::value) {
+      // Integer sums wrap around on overflow
+      const auto unsigned_value = static_cast<uint64_t>(static_cast<OutValue>(value));
+      sum += delta > 0 ? unsigned_value : -unsigned_value;
+    } else if (!non_finite.Update(value, delta)) {
+      compensated.Add(delta * static_cast<double>(value));
+    }
+  }
+
+  uint64_t sum = 0;
+  CompensatedSum compensated;
+  NonFiniteCounts non_finite;
+};
+
+template <typename ArgType>
+struct RollingMean {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  using OutType = DoubleType;
+  using OutValue = double;
+
+  void Add(int64_t, ArgValue value) {
+    if (!non_finite.Update(value, 1)) compensated.Add(static_cast<double>(value));
+  }
+
+  void Remove(int64_t, ArgValue value) {
+    if (!non_finite.Update(value, -1)) compensated.Add(-static_cast<double>(value));
+  }
+
+  bool Value(int64_t count, double* out) const {
+    *out = non_finite.any() ? non_finite.Result()
+                            : compensated.sum / static_cast<double>(count);
+    return true;
+  }
+
+ private:
+  CompensatedSum compensated;
+  NonFiniteCounts non_finite;
+};
+
+// Welford's online algorithm, extended to removals
+template <typename ArgType>
+struct RollingStddev {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  using OutType = DoubleType;
+  using OutValue = double;
+
+  explicit RollingStddev(int ddof) : ddof(ddof) {}
+
+  void Add(int64_t, ArgValue value) {
+    if (non_finite.Update(value, 1)) return;
+    const double x = static_cast<double>(value);
+    ++count;
+    same_value_run = (same_value_run > 0 && x == last_value) ? same_value_run + 1 : 1;
+    last_value = x;
+    const double delta = x - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (x - mean);
+  }
+
+  void Remove(int64_t, ArgValue value) {
+    if (non_finite.Update(value, -1)) return;
+    const double x = static_cast<double>(value);
+    if (--count == 0) {
+      mean = m2 = 0;
+      return;
+    }
+    const double delta = x - mean;
+    mean -= delta / static_cast<double>(count);
+    m2 -= delta * (x - mean);
+  }
+
+  bool Value(int64_t total_count, double* out) const {
+    if (total_count <= ddof) return false;
+    if (non_finite.any()) {
+      *out = std::numeric_limits<double>::quiet_NaN();
+    } else {
+      // Removals leave rounding errors in m2, which must not show up as a
+      // spurious deviation when all the values are equal
+      *out = same_value_run >= count
+                 ? 0.0
+                 : std::sqrt(std::max(m2, 0.0) / static_cast<double>(count - ddof));
+    }
+    return true;
+  }
+
+ private:
+  int ddof;
+  int64_t count = 0;
+  double mean = 0;
+  double m2 = 0;
+  // The values added last are the ones in the window, so a run of equal values
+  // at least as long as the window means it is constant
+  int64_t same_value_run = 0;
+  double last_value = 0;
+  NonFiniteCounts non_finite;
+};
+
+// A monotonic deque: the values in the window that may still become its
+// extremum, in row order, the front being the current extremum.  Each value is
+// pushed and popped at most once.  NaNs are ignored unless the window only
+// contains NaNs, as in the min_max aggregate.
+template <typename ArgType, typename Compare>
+struct RollingExtremum {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  using OutType = ArgType;
+  using OutValue = ArgValue;
+
+  void Add(int64_t index, ArgValue value) {
+    if constexpr (std::is_floating_point_v<ArgValue>) {
+      if (std::isnan(value)) return;
+    }
+    while (!candidates.empty() && !Compare{}(candidates.back().second, value)) {
+      candidates.pop_back();
+    }
+    candidates.emplace_back(index, value);
+  }
+
+  void Remove(int64_t index, ArgValue) {
+    // A NaN or a value that was superseded by a later one isn't at the front
+    if (!candidates.empty() && candidates.front().first == index) {
+      candidates.pop_front();
+    }
+  }
+
+  bool Value(int64_t, OutValue* out) const {
+    if constexpr (std::is_floating_point_v<OutValue>) {
+      if (candidates.empty()) {
+        // Only NaNs in the window
+        *out = std::numeric_limits<OutValue>::quiet_NaN();
+        return true;
+      }
+    }
+    *out = candidates.front().second;
+    return true;
+  }
+
+ private:
+  std::deque<std::pair<int64_t, ArgValue>> candidates;
+};
+
+template <typename ArgType>
+using RollingMin = RollingExtremum<ArgType, std::less<typename GetViewType<ArgType>::T>>;
+template <typename ArgType>
+using RollingMax =
+    RollingExtremum<ArgType, std::greater<typename GetViewType<ArgType>::T>>;
+
+template <typename State>
+State MakeState(const RollingOptions& options) {
+  if constexpr (std::is_constructible_v<State, int>) {
+    return State(options.ddof);
+  } else {
+    return State();
+  }
+}
+
+std::vector<ArraySpan> GetChunks(const ExecValue& value) { return {value.array}; }
+
+std::vector<ArraySpan> GetChunks(const Datum& datum) {
+  std::vector<ArraySpan> chunks;
+  if (datum.is_array()) {
+    chunks.emplace_back(*datum.array());
+  } else {
+    for (const auto& chunk : datum.chunked_array()->chunks()) {
+      chunks.emplace_back(*chunk->data());
+    }
+  }
+  return chunks;
+}
+
+// Compute the bounds [start, end) of the windows of consecutive rows
+class FixedWindows {
+ public:
+  FixedWindows(const RollingOptions& options, int64_t length)
+      : size_(options.window_size),
+        // Centered windows extend past the current row, leaning towards the
+        // previous rows when the window size is even
+        offset_(options.center ? (options.window_size - 1) / 2 : 0),
+        length_(length) {}
+
+  Status Next(int64_t row, int64_t* start, int64_t* end) {
+    *end = std::min(length_, row + 1 + offset_);
+    *start = std::max<int64_t>(0, row + 1 + offset_ - size_);
+    return Status::OK();
+  }
+
+ private:
+  int64_t size_;
+  int64_t offset_;
+  int64_t length_;
+};
+
+// Compute the bounds [start, end) of the windows of rows whose times lie in
+// (time - window_size, time], the times being sorted in ascending order
+class TimeWindows {
+ public:
+  TimeWindows(const RollingOptions& options, const std::vector<ArraySpan>& times)
+      : size_(options.window_size), current_(times), start_cursor_(times) {}
+
+  Status Next(int64_t row, int64_t* start, int64_t* end) {
+    if (ARROW_PREDICT_FALSE(!current_.IsValid())) {
+      return Status::Invalid("Rolling window times must not contain nulls");
+    }
+    const int64_t time = current_.Value();
+    if (ARROW_PREDICT_FALSE(row > 0 && time < previous_time_)) {
+      return Status::Invalid("Rolling window times must be sorted in ascending order");
+    }
+    current_.Next();
+    previous_time_ = time;
+    // Times are sorted and non-null up to the current row, so the start of the
+    // window only moves forward
+    while (start_cursor_.Value() <= time - size_) {
+      start_cursor_.Next();
+      ++start_;
+    }
+    *start = start_;
+    *end = row + 1;
+    return Status::OK();
+  }
+
+ private:
+  int64_t size_;
+  ChunkedCursor<int64_t> current_;
+  ChunkedCursor<int64_t> start_cursor_;
+  int64_t start_ = 0;
+  int64_t previous_time_ = 0;
+};
+
+template <typename ArgType, typename State, typename Windows>
+Result<std::shared_ptr<ArrayData>> RollingExec(KernelContext* ctx,
+                                               const RollingOptions& options,
+                                               const std::vector<ArraySpan>& values,
+                                               int64_t length, int64_t min_periods,
+                                               Windows windows) {
+  using ArgValue = typename GetViewType<ArgType>::T;
+  using OutType = typename State::OutType;
+  using OutValue = typename GetOutputType<OutType>::T;
+
+  NumericBuilder<OutType> builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(length));
+
+  State state = MakeState<State>(options);
+  ChunkedCursor<ArgValue> entering(values);
+  ChunkedCursor<ArgValue> leaving(values);
+  int64_t window_start = 0;
+  int64_t window_end = 0;
+  // Number of non-null values in the window
+  int64_t count = 0;
+
+  for (int64_t row = 0; row < length; ++row) {
+    int64_t start, end;
+    RETURN_NOT_OK(windows.Next(row, &start, &end));
+    for (; window_end < end; ++window_end, entering.Next()) {
+      if (entering.IsValid()) {
+        state.Add(window_end, entering.Value());
+        ++count;
+      }
+    }
+    for (; window_start < start; ++window_start, leaving.Next()) {
+      if (leaving.IsValid()) {
+        state.Remove(window_start, leaving.Value());
+        --count;
+      }
+    }
+
+    OutValue value{};
+    if (count > 0 && count >= min_periods && state.Value(count, &value)) {
+      builder.UnsafeAppend(value);
+    } else {
+      builder.UnsafeAppendNull();
+    }
+  }
+
+  std::shared_ptr<ArrayData> result;
+  RETURN_NOT_OK(builder.FinishInternal(&result));
+  return result;
+}
+
+template <typename ArgType, typename State>
+Result<std::shared_ptr<ArrayData>> RollingFixed(KernelContext* ctx,
+                                                const std::vector<ArraySpan>& values,
+                                                int64_t length) {
+  const auto& options = RollingState::Get(ctx);
+  if (options.window_size <= 0) {
+    return Status::Invalid("Rolling window size must be strictly positive, got ",
+                           options.window_size);
+  }
+  const int64_t min_periods = options.min_periods.value_or(options.window_size);
+  if (min_periods < 0 || min_periods > options.window_size) {
+    return Status::Invalid("Rolling min_periods must be between 0 and the window size (",
+                           options.window_size, "), got ", min_periods);
+  }
+  return RollingExec<ArgType, State>(ctx, options, values, length, min_periods,
+                                     FixedWindows(options, length));
+}
+
+template <typename ArgType, typename State>
+Result<std::shared_ptr<ArrayData>> RollingByTime(KernelContext* ctx,
+                                                 const std::vector<ArraySpan>& values,
+                                                 const std::vector<ArraySpan>& times,
+                                                 int64_t length) {
+  const auto& options = RollingState::Get(ctx);
+  if (options.window_size <= 0) {
+    return Status::Invalid("Rolling window size must be strictly positive, got ",
+                           options.window_size);
+  }
+  if (options.center) {
+    return Status::NotImplemented("Centered time-based rolling windows");
+  }
+  const int64_t min_periods = options.min_periods.value_or(1);
+  if (min_periods < 0) {
+    return Status::Invalid("Rolling min_periods must be positive, got ", min_periods);
+  }
+  return RollingExec<ArgType, State>(ctx, options, values, length, min_periods,
+                                     TimeWindows(options, times));
+}
+
+template <typename ArgType, typename State>
+struct RollingKernel {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    ARROW_ASSIGN_OR_RAISE(out->value, (RollingFixed<ArgType, State>(
+                                          ctx, GetChunks(batch[0]), batch.length)));
+    return Status::OK();
+  }
+
+  static Status ExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ARROW_ASSIGN_OR_RAISE(out->value, (RollingFixed<ArgType, State>(
+                                          ctx, GetChunks(batch[0]), batch.length)));
+    return Status::OK();
+  }
+};
+
+template <typename ArgType, typename State>
+struct RollingByTimeKernel {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    ARROW_ASSIGN_OR_RAISE(out->value,
+                          (RollingByTime<ArgType, State>(ctx, GetChunks(batch[0]),
+                                                         GetChunks(batch[1]),
+                                                         batch.length)));
+    return Status::OK();
+  }
+
+  static Status ExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    ARROW_ASSIGN_OR_RAISE(out->value,
+                          (RollingByTime<ArgType, State>(ctx, GetChunks(batch[0]),
+                                                         GetChunks(batch[1]),
+                                                         batch.length)));
+    return Status::OK();
+  }
+};
+
+template <template <typename ArgType> typename State, bool kByTime>
+struct RollingKernelFactory {
+  std::vector<VectorKernel> kernels;
+
+  template <typename ArgType>
+  enable_if_number<ArgType, Status> Visit(const ArgType& type) {
+    using StateType = State<ArgType>;
+    auto out_type =
+        OutputType(TypeTraits<typename StateType::OutType>::type_singleton());
+    VectorKernel kernel;
+    kernel.can_execute_chunkwise = false;
+    kernel.null_handling = NullHandling::type::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::type::NO_PREALLOCATE;
+    kernel.init = RollingState::Init;
+    if constexpr (kByTime) {
+      kernel.exec = RollingByTimeKernel<ArgType, StateType>::Exec;
+      kernel.exec_chunked = RollingByTimeKernel<ArgType, StateType>::ExecChunked;
+      // Times are either timestamps or plain integers
+      for (auto times_type : {InputType(Type::TIMESTAMP), InputType(int64())}) {
+        kernel.signature = KernelSignature::Make(
+            {InputType(type.GetSharedPtr()), std::move(times_type)}, out_type);
+        kernels.push_back(kernel);
+      }
+    } else {
+      kernel.exec = RollingKernel<ArgType, StateType>::Exec;
+      kernel.exec_chunked = RollingKernel<ArgType, StateType>::ExecChunked;
+      kernel.signature = KernelSignature::Make({type.GetSharedPtr()}, out_type);
+      kernels.push_back(kernel);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Rolling kernel not implemented for type ",
+                                  type.ToString());
+  }
+};
+
+FunctionDoc MakeRollingDoc(const std::string& summary, const std::string& notes) {
+  std::string description =
+      "`values` must be numeric. Each output value is the\n" + summary +
+      " of the non-null values in the window ending at the same\n"
+      "row, or centered on it if RollingOptions::center is true. A window\n"
+      "with fewer than RollingOptions::min_periods non-null values produces\n"
+      "a null.";
+  if (!notes.empty()) description += "\n" + notes;
+  return FunctionDoc("Compute the " + summary + " over a sliding window of rows",
+                     std::move(description), {"values"}, "RollingOptions",
+                     /*options_required=*/true);
+}
+
+FunctionDoc MakeRollingByTimeDoc(const std::string& summary, const std::string& notes) {
+  std::string description =
+      "`values` must be numeric and `times` must be timestamps or int64, sorted\n"
+      "in ascending order and without nulls. Each output value is the\n" +
+      summary +
+      " of the non-null values whose time is in\n"
+      "(t - window_size, t], where t is the time of the same row and\n"
+      "RollingOptions::window_size is in the unit of `times`. A window with\n"
+      "fewer than RollingOptions::min_periods non-null values produces a null.";
+  if (!notes.empty()) description += "\n" + notes;
+  return FunctionDoc("Compute the " + summary + " over a sliding window of time",
+                     std::move(description), {"values", "times"}, "RollingOptions",
+                     /*options_required=*/true);
+}
+
+template <template <typename ArgType> typename State>
+void AddRollingFunctions(FunctionRegistry* registry, const std::string& name,
+                         const std::string& summary, const std::string& notes) {
+  auto func = std::make_shared<VectorFunction>(name, Arity::Unary(),
+                                               MakeRollingDoc(summary, notes));
+  auto by_time_func = std::make_shared<VectorFunction>(
+      name + "_by_time", Arity::Binary(), MakeRollingByTimeDoc(summary, notes));
+
+  RollingKernelFactory<State, /*kByTime=*/false> factory;
+  RollingKernelFactory<State, /*kByTime=*/true> by_time_factory;
+  for (const auto& ty : NumericTypes()) {
+    DCHECK_OK(VisitTypeInline(*ty, &factory));
+    DCHECK_OK(VisitTypeInline(*ty, &by_time_factory));
+  }
+  for (auto& kernel : factory.kernels) {
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+  for (auto& kernel : by_time_factory.kernels) {
+    DCHECK_OK(by_time_func->AddKernel(std::move(kernel)));
+  }
+
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+  DCHECK_OK(registry->AddFunction(std::move(by_time_func)));
+}
+
+}  // namespace
+
+void RegisterVectorRolling(FunctionRegistry* registry) {
+  AddRollingFunctions<RollingSum>(registry, "rolling_sum", "sum",
+                                  "Results will wrap around on integer overflow.");
+  AddRollingFunctions<RollingMean>(registry, "rolling_mean", "mean", "");
+  AddRollingFunctions<RollingMin>(
+      registry, "rolling_min", "minimum",
+      "NaNs are ignored unless the window only contains NaNs.");
+  AddRollingFunctions<RollingMax>(
+      registry, "rolling_max", "maximum",
+      "NaNs are ignored unless the window only contains NaNs.");
+  AddRollingFunctions<RollingStddev>(
+      registry, "rolling_stddev", "standard deviation",
+      "The divisor is the number of non-null values minus RollingOptions::ddof.");
+}
+
+}  // namespace arrow::compute::internal
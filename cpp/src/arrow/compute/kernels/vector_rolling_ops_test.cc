@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util_internal.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+static const std::vector<std::string> kRollingFunctionNames{
+    "rolling_sum", "rolling_mean", "rolling_min", "rolling_max", "rolling_stddev"};
+
+std::shared_ptr<DataType> RollingOutputType(const std::string& function,
+                                            const std::shared_ptr<DataType>& ty) {
+  if (function == "rolling_min" || function == "rolling_max") {
+    return ty;
+  } else if (function == "rolling_sum" && is_signed_integer(ty->id())) {
+    return int64();
+  } else if (function == "rolling_sum" && is_unsigned_integer(ty->id())) {
+    return uint64();
+  }
+  return float64();
+}
+
+void CheckRolling(const std::string& function, const std::vector<Datum>& args,
+                  const Datum& expected, const RollingOptions& options) {
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(function, args, &options));
+  ValidateOutput(actual);
+  AssertDatumsEqual(expected, actual, /*verbose=*/true,
+                    EqualOptions::Defaults().nans_equal(true));
+}
+
+TEST(TestRolling, Empty) {
+  RollingOptions options(2);
+  for (const auto& function : kRollingFunctionNames) {
+    for (const auto& ty : NumericTypes()) {
+      auto out_ty = RollingOutputType(function, ty);
+      CheckVectorUnary(function, ArrayFromJSON(ty, "[]"), ArrayFromJSON(out_ty, "[]"),
+                       &options);
+      CheckVectorUnary(function, ChunkedArrayFromJSON(ty, {"[]"}),
+                       ChunkedArrayFromJSON(out_ty, {"[]"}), &options);
+    }
+  }
+}
+
+TEST(TestRolling, AllNulls) {
+  RollingOptions options(2, /*min_periods=*/0);
+  for (const auto& function : kRollingFunctionNames) {
+    for (const auto& ty : NumericTypes()) {
+      auto out_ty = RollingOutputType(function, ty);
+      CheckVectorUnary(function, ArrayFromJSON(ty, "[null, null, null]"),
+                       ArrayFromJSON(out_ty, "[null, null, null]"), &options);
+      CheckVectorUnary(function,
+                       ChunkedArrayFromJSON(ty, {"[null]", "[]", "[null, null]"}),
+                       ChunkedArrayFromJSON(out_ty, {"[null, null, null]"}), &options);
+    }
+  }
+}
+
+TEST(TestRolling, OptionsRequired) {
+  ASSERT_RAISES(Invalid, CallFunction("rolling_sum", {ArrayFromJSON(int64(), "[1]")}));
+}
+
+TEST(TestRolling, InvalidOptions) {
+  auto values = ArrayFromJSON(int64(), "[1, 2, 3]");
+  auto times = ArrayFromJSON(int64(), "[1, 2, 3]");
+  for (const auto& function : kRollingFunctionNames) {
+    RollingOptions zero_window(0);
+    ASSERT_RAISES(Invalid, CallFunction(function, {values}, &zero_window));
+    ASSERT_RAISES(Invalid, CallFunction(function + "_by_time", {values, times},
+                                        &zero_window));
+    RollingOptions too_many_periods(2, /*min_periods=*/3);
+    ASSERT_RAISES(Invalid, CallFunction(function, {values}, &too_many_periods));
+    RollingOptions center(2, std::nullopt, /*center=*/true);
+    ASSERT_RAISES(NotImplemented,
+                  CallFunction(function + "_by_time", {values, times}, &center));
+  }
+}
+
+TEST(TestRollingSum, FixedWindow) {
+  for (const auto& ty : NumericTypes()) {
+    auto out_ty = RollingOutputType("rolling_sum", ty);
+    auto values = ArrayFromJSON(ty, "[1, 2, 3, null, 5, 6, 7]");
+
+    RollingOptions options(3);
+    CheckVectorUnary("rolling_sum", values,
+                     ArrayFromJSON(out_ty, "[null, null, 6, null, null, null, 18]"),
+                     &options);
+
+    options.min_periods = 1;
+    CheckVectorUnary("rolling_sum", values,
+                     ArrayFromJSON(out_ty, "[1, 3, 6, 5, 8, 11, 18]"), &options);
+
+    options.center = true;
+    CheckVectorUnary("rolling_sum", values,
+                     ArrayFromJSON(out_ty, "[3, 6, 5, 8, 11, 18, 13]"), &options);
+
+    // Chunk boundaries don't split the windows
+    CheckVectorUnary("rolling_sum",
+                     ChunkedArrayFromJSON(ty, {"[1, 2]", "[]", "[3, null, 5]", "[6, 7]"}),
+                     ChunkedArrayFromJSON(out_ty, {"[3, 6, 5, 8, 11, 18, 13]"}),
+                     &options);
+  }
+}
+
+TEST(TestRollingSum, EvenCenteredWindow) {
+  // Centered windows of even size lean towards the previous rows
+  RollingOptions options(4, /*min_periods=*/1, /*center=*/true);
+  CheckVectorUnary("rolling_sum", ArrayFromJSON(int64(), "[1, 2, 3, 4, 5]"),
+                   ArrayFromJSON(int64(), "[3, 6, 10, 14, 12]"), &options);
+}
+
+TEST(TestRollingSum, IntegerOverflow) {
+  RollingOptions options(2);
+  CheckVectorUnary("rolling_sum",
+                   ArrayFromJSON(int64(), "[9223372036854775807, 1, 2]"),
+                   ArrayFromJSON(int64(), "[null, -9223372036854775808, 3]"), &options);
+}
+
+TEST(TestRollingSum, NonFinite) {
+  // Infinities and NaNs only affect the windows containing them
+  RollingOptions options(2);
+  CheckRolling("rolling_sum",
+               {ArrayFromJSON(float64(), "[1, Inf, 2, -Inf, Inf, NaN, 3, 4]")},
+               ArrayFromJSON(float64(), "[null, Inf, Inf, -Inf, NaN, NaN, NaN, 7]"),
+               options);
+}
+
+TEST(TestRollingMean, FixedWindow) {
+  for (const auto& ty : NumericTypes()) {
+    RollingOptions options(2, /*min_periods=*/1);
+    CheckVectorUnary("rolling_mean", ArrayFromJSON(ty, "[1, 2, null, 5, 6]"),
+                     ArrayFromJSON(float64(), "[1, 1.5, 2, 5, 5.5]"), &options);
+  }
+}
+
+TEST(TestRollingMinMax, FixedWindow) {
+  for (const auto& ty : NumericTypes()) {
+    auto values = ChunkedArrayFromJSON(ty, {"[4, 2, 3]", "[1, null, 5, 6]", "[1]"});
+    RollingOptions options(3, /*min_periods=*/2);
+    CheckVectorUnary("rolling_min", values,
+                     ChunkedArrayFromJSON(ty, {"[null, 2, 2, 1, 1, 1, 5, 1]"}),
+                     &options);
+    CheckVectorUnary("rolling_max", values,
+                     ChunkedArrayFromJSON(ty, {"[null, 4, 4, 3, 3, 5, 6, 6]"}),
+                     &options);
+  }
+}
+
+TEST(TestRollingMinMax, NaN) {
+  // NaNs are ignored unless the window only contains NaNs
+  RollingOptions options(2);
+  for (const auto& ty : FloatingPointTypes()) {
+    auto values = ArrayFromJSON(ty, "[1, NaN, NaN, 3, -Inf]");
+    CheckRolling("rolling_min", {values}, ArrayFromJSON(ty, "[null, 1, NaN, 3, -Inf]"),
+                 options);
+    CheckRolling("rolling_max", {values}, ArrayFromJSON(ty, "[null, 1, NaN, 3, 3]"),
+                 options);
+  }
+}
+
+TEST(TestRollingStddev, FixedWindow) {
+  for (const auto& ty : NumericTypes()) {
+    auto values = ArrayFromJSON(ty, "[1, 3, 3, 7, null, 7]");
+
+    RollingOptions options(2, /*min_periods=*/1, /*center=*/false, /*ddof=*/0);
+    CheckVectorUnary("rolling_stddev", values,
+                     ArrayFromJSON(float64(), "[0, 1, 0, 2, 0, 0]"), &options);
+
+    // Not enough values for the degrees of freedom
+    options.ddof = 1;
+    CheckVectorUnary("rolling_stddev", values,
+                     ArrayFromJSON(float64(), "[null, 1.4142135623730951, 0, "
+                                              "2.8284271247461903, null, null]"),
+                     &options);
+  }
+}
+
+TEST(TestRolling, ByTime) {
+  auto values = ChunkedArrayFromJSON(float64(), {"[1, 2, null]", "[4, 8, 16]"});
+  // Windows of 10 seconds, right-closed
+  auto times = ChunkedArrayFromJSON(
+      timestamp(TimeUnit::SECOND),
+      {R"(["2000-01-01T00:00:00", "2000-01-01T00:00:05"])",
+       R"(["2000-01-01T00:00:05", "2000-01-01T00:00:10", "2000-01-01T00:00:20",
+           "2000-01-01T00:00:31"])"});
+  RollingOptions options(10);
+
+  auto check = [&](const std::string& function, const std::string& expected) {
+    CheckRolling(function, {values, times}, ChunkedArrayFromJSON(float64(), {expected}),
+                 options);
+  };
+  check("rolling_sum_by_time", "[1, 3, 3, 6, 8, 16]");
+  check("rolling_mean_by_time", "[1, 1.5, 1.5, 3, 8, 16]");
+  check("rolling_min_by_time", "[1, 1, 1, 2, 8, 16]");
+  check("rolling_max_by_time", "[1, 2, 2, 4, 8, 16]");
+
+  options.min_periods = 2;
+  check("rolling_sum_by_time", "[null, 3, 3, 6, null, null]");
+
+  // Times can also be plain integers
+  CheckRolling("rolling_sum_by_time",
+               {ArrayFromJSON(int32(), "[1, 2, 3]"), ArrayFromJSON(int64(), "[0, 1, 3]")},
+               ArrayFromJSON(int64(), "[1, 3, 3]"), RollingOptions(2));
+}
+
+TEST(TestRolling, ByTimeInvalidTimes) {
+  RollingOptions options(10);
+  auto values = ArrayFromJSON(int64(), "[1, 2, 3]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("sorted"),
+      CallFunction("rolling_sum_by_time", {values, ArrayFromJSON(int64(), "[1, 3, 2]")},
+                   &options));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("nulls"),
+      CallFunction("rolling_sum_by_time",
+                   {values, ArrayFromJSON(int64(), "[1, null, 2]")}, &options));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -199,6 +199,14 @@ struct TakeBenchmark {
     BenchChunked(chunked_array, chunk_indices_too);
   }
 
+  void ChunkedListInt64(int64_t num_chunks, bool chunk_indices_too) {
+    auto chunked_array = GenChunkedArray(num_chunks, [this](int64_t chunk_length) {
+      return rand.List(*rand.Int64(chunk_length * 4, -100, 100, args.null_proportion),
+                       chunk_length, args.null_proportion);
+    });
+    BenchChunked(chunked_array, chunk_indices_too);
+  }
+
   void Bench(const std::shared_ptr<Array>& values) {
     const double indices_null_proportion = indices_have_nulls ? args.null_proportion : 0;
     const int64_t num_indices = static_cast<int64_t>(selection_factor * values->length());
@@ -326,6 +334,38 @@ struct FilterBenchmark {
     state.SetItemsProcessed(state.iterations() * values->length());
   }
 
+  void ChunkedInt64(int64_t num_chunks) {
+    const int64_t array_size = args.size / sizeof(int64_t);
+    auto values = rand.Int64(array_size, -100, 100, args.values_null_proportion);
+    BenchChunked(values, num_chunks);
+  }
+
+  void ChunkedString(int64_t num_chunks) {
+    const int64_t array_size = args.size / 16;
+    auto values = rand.String(array_size, /*min_length=*/0, /*max_length=*/32,
+                              args.values_null_proportion);
+    BenchChunked(values, num_chunks);
+  }
+
+  // Filter a ChunkedArray with a filter chunked at different boundaries
+  void BenchChunked(const std::shared_ptr<Array>& values, int64_t num_chunks) {
+    auto filter = rand.Boolean(values->length(), args.selected_proportion,
+                               args.filter_null_proportion);
+    const int64_t chunk_length = values->length() / num_chunks + 1;
+    ArrayVector value_chunks, filter_chunks;
+    for (int64_t offset = 0; offset < values->length(); offset += chunk_length) {
+      value_chunks.push_back(values->Slice(offset, chunk_length));
+      filter_chunks.push_back(filter->Slice(offset + chunk_length / 2, chunk_length));
+    }
+    filter_chunks.insert(filter_chunks.begin(), filter->Slice(0, chunk_length / 2));
+    auto chunked_values = std::make_shared<ChunkedArray>(std::move(value_chunks));
+    auto chunked_filter = std::make_shared<ChunkedArray>(std::move(filter_chunks));
+    for (auto _ : state) {
+      ABORT_NOT_OK(Filter(chunked_values, chunked_filter).status());
+    }
+    state.SetItemsProcessed(state.iterations() * values->length());
+  }
+
   void BenchRecordBatch() {
     const int64_t total_data_cells = 10000000;
     const int64_t num_columns = state.range(0);
@@ -362,6 +402,14 @@ struct FilterBenchmark {
   }
 };
 
+static void FilterChunkedInt64FilterNoNulls(benchmark::State& state) {
+  FilterBenchmark(state, false).ChunkedInt64(/*num_chunks=*/100);
+}
+
+static void FilterChunkedStringFilterWithNulls(benchmark::State& state) {
+  FilterBenchmark(state, true).ChunkedString(/*num_chunks=*/100);
+}
+
 static void FilterInt64FilterNoNulls(benchmark::State& state) {
   FilterBenchmark(state, false).Int64();
 }
@@ -522,6 +570,31 @@ static void TakeChunkedChunkedStringFewMonotonicIndices(benchmark::State& state)
       .ChunkedString(/*num_chunks=*/100, /*chunk_indices_too=*/true);
 }
 
+static void TakeChunkedChunkedListInt64RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false)
+      .ChunkedListInt64(/*num_chunks=*/100, /*chunk_indices_too=*/true);
+}
+
+static void TakeChunkedChunkedListInt64RandomIndicesWithNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/true)
+      .ChunkedListInt64(/*num_chunks=*/100, /*chunk_indices_too=*/true);
+}
+
+static void TakeChunkedChunkedListInt64MonotonicIndices(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false, /*monotonic=*/true)
+      .ChunkedListInt64(/*num_chunks=*/100, /*chunk_indices_too=*/true);
+}
+
+static void TakeChunkedFlatStringRandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false)
+      .ChunkedString(/*num_chunks=*/100, /*chunk_indices_too=*/false);
+}
+
+static void TakeChunkedFlatStringRandomIndicesWithNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/true)
+      .ChunkedString(/*num_chunks=*/100, /*chunk_indices_too=*/false);
+}
+
 static void TakeChunkedFlatInt64RandomIndicesNoNulls(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false)
       .ChunkedInt64(/*num_chunks=*/100, /*chunk_indices_too=*/false);
@@ -580,6 +653,10 @@ BENCHMARK(FilterFSLInt64FilterWithNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterStringFilterNoNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterStringFilterWithNulls)->Apply(FilterSetArgs);
 
+// Chunked values x Chunked filter
+BENCHMARK(FilterChunkedInt64FilterNoNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterChunkedStringFilterWithNulls)->Apply(FilterSetArgs);
+
 void FilterRecordBatchSetArgs(benchmark::internal::Benchmark* bench) {
   for (auto num_cols : std::vector<int>({10, 50, 100})) {
     for (int i = 0; i < static_cast<int>(g_filter_params.size()); ++i) {
@@ -638,6 +715,9 @@ BENCHMARK(TakeChunkedChunkedStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeChunkedChunkedStringFewRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeChunkedChunkedStringMonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeChunkedChunkedStringFewMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedChunkedListInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedChunkedListInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedChunkedListInt64MonotonicIndices)->Apply(TakeSetArgs);
 
 // Chunked values x Flat indices
 BENCHMARK(TakeChunkedFlatInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
@@ -645,6 +725,8 @@ BENCHMARK(TakeChunkedFlatInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeChunkedFlatInt64FewRandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeChunkedFlatInt64MonotonicIndices)->Apply(TakeSetArgs);
 BENCHMARK(TakeChunkedFlatInt64FewMonotonicIndices)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedFlatStringRandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeChunkedFlatStringRandomIndicesWithNulls)->Apply(TakeSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
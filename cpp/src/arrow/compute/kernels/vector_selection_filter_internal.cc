@@ -938,8 +938,14 @@ Result<std::shared_ptr<RecordBatch>> FilterRecordBatch(const RecordBatch& batch,
       filter_array = *filter.array();
       break;
     case Datum::CHUNKED_ARRAY: {
-      ARROW_ASSIGN_OR_RAISE(auto combined, Concatenate(filter.chunked_array()->chunks()));
-      filter_array = *combined->data();
+      // Only the (bit-packed) filter is ever concatenated here, never the values
+      const auto& filter_chunks = filter.chunked_array()->chunks();
+      if (filter_chunks.size() == 1) {
+        filter_array = *filter_chunks[0]->data();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto combined, Concatenate(filter_chunks));
+        filter_array = *combined->data();
+      }
       break;
     }
     default:
@@ -950,12 +956,15 @@ Result<std::shared_ptr<RecordBatch>> FilterRecordBatch(const RecordBatch& batch,
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrayData> indices,
                         GetTakeIndices(filter_array, filter_opts.null_selection_behavior,
                                        ctx->memory_pool()));
-  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(Datum out, Take(batch.column(i)->data(), Datum(indices),
-                                          TakeOptions::NoBoundsCheck(), ctx));
-    columns[i] = out.make_array();
-  }
+  const int num_columns = batch.num_columns();
+  std::vector<std::shared_ptr<Array>> columns(num_columns);
+  RETURN_NOT_OK(OptionalParallelForSelection(
+      ctx, num_columns * indices->length, num_columns, [&](int i) -> Status {
+        ARROW_ASSIGN_OR_RAISE(Datum out, Take(batch.column(i)->data(), Datum(indices),
+                                              TakeOptions::NoBoundsCheck(), ctx));
+        columns[i] = out.make_array();
+        return Status::OK();
+      }));
   return RecordBatch::Make(batch.schema(), indices->length, std::move(columns));
 }
 
@@ -996,27 +1005,42 @@ Result<std::shared_ptr<Table>> FilterTable(const Table& table, const Datum& filt
   // Instead of filtering each column with the boolean filter
   // (which would be slow if the table has a large number of columns: ARROW-10569),
   // convert each filter chunk to indices, and take() the column.
-  const int64_t num_chunks = static_cast<int64_t>(inputs.back().size());
+  // Output chunks are independent, so they are produced in parallel.
+  const int num_chunks = static_cast<int>(inputs.back().size());
+  std::vector<ArrayVector> chunk_columns(num_chunks);
+  std::vector<int64_t> chunk_num_rows(num_chunks, 0);
+  RETURN_NOT_OK(OptionalParallelForSelection(
+      ctx, num_columns * table.num_rows(), num_chunks, [&](int i) -> Status {
+        const ArrayData& filter_chunk = *inputs.back()[i]->data();
+        ARROW_ASSIGN_OR_RAISE(
+            const auto indices,
+            GetTakeIndices(filter_chunk, filter_opts.null_selection_behavior,
+                           ctx->memory_pool()));
+
+        if (indices->length > 0) {
+          // Take from all input columns
+          chunk_num_rows[i] = indices->length;
+          Datum indices_datum{std::move(indices)};
+          chunk_columns[i].resize(num_columns);
+          for (int col = 0; col < num_columns; ++col) {
+            const auto& column_chunk = inputs[col][i];
+            ARROW_ASSIGN_OR_RAISE(Datum out, Take(column_chunk, indices_datum,
+                                                  TakeOptions::NoBoundsCheck(), ctx));
+            chunk_columns[i][col] = std::move(out).make_array();
+          }
+        }
+        return Status::OK();
+      }));
+
   std::vector<ArrayVector> out_columns(num_columns);
   int64_t out_num_rows = 0;
-
-  for (int64_t i = 0; i < num_chunks; ++i) {
-    const ArrayData& filter_chunk = *inputs.back()[i]->data();
-    ARROW_ASSIGN_OR_RAISE(
-        const auto indices,
-        GetTakeIndices(filter_chunk, filter_opts.null_selection_behavior,
-                       ctx->memory_pool()));
-
-    if (indices->length > 0) {
-      // Take from all input columns
-      Datum indices_datum{std::move(indices)};
-      for (int col = 0; col < num_columns; ++col) {
-        const auto& column_chunk = inputs[col][i];
-        ARROW_ASSIGN_OR_RAISE(Datum out, Take(column_chunk, indices_datum,
-                                              TakeOptions::NoBoundsCheck(), ctx));
-        out_columns[col].push_back(std::move(out).make_array());
-      }
-      out_num_rows += indices->length;
+  for (int i = 0; i < num_chunks; ++i) {
+    if (chunk_num_rows[i] == 0) {
+      continue;
+    }
+    out_num_rows += chunk_num_rows[i];
+    for (int col = 0; col < num_columns; ++col) {
+      out_columns[col].push_back(std::move(chunk_columns[i][col]));
     }
   }
 
@@ -40,7 +40,9 @@
 #include "arrow/util/fixed_width_internal.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/ree_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -66,6 +68,20 @@ void RegisterSelectionFunction(const std::string& name, FunctionDoc doc,
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
+Status OptionalParallelForSelection(ExecContext* ctx, int64_t total_length,
+                                    int num_tasks,
+                                    const std::function<Status(int)>& func) {
+  // Below this many output rows, dispatching to the thread pool costs more
+  // than it saves
+  constexpr int64_t kMinParallelLength = 1 << 16;
+  auto* executor = ctx->executor() != nullptr ? ctx->executor()
+                                              : ::arrow::internal::GetCpuThreadPool();
+  const bool use_threads = ctx->use_threads() && num_tasks > 1 &&
+                           total_length >= kMinParallelLength &&
+                           !executor->OwnsThisThread();
+  return ::arrow::internal::OptionalParallelFor(use_threads, num_tasks, func, executor);
+}
+
 namespace {
 
 /// \brief Iterate over a REE filter, emitting ranges of a plain values array that
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -45,6 +46,16 @@ void RegisterSelectionFunction(const std::string& name, FunctionDoc doc,
                                const FunctionOptions* default_options,
                                FunctionRegistry* registry);
 
+/// \brief Call `func(i)` for i in [0, num_tasks), in parallel if the
+/// ExecContext allows it and the selection is large enough to benefit.
+///
+/// total_length is the number of output rows produced by all the tasks. Tasks
+/// run serially when called from a thread of the executor itself, as waiting
+/// on nested tasks from there could exhaust the thread pool.
+Status OptionalParallelForSelection(ExecContext* ctx, int64_t total_length,
+                                    int num_tasks,
+                                    const std::function<Status(int)>& func);
+
 /// \brief Callback type for VisitPlainxREEFilterOutputSegments.
 ///
 /// position is the logical position in the values array relative to its offset.
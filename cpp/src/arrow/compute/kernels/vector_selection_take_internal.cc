@@ -25,8 +25,10 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/chunk_resolver.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/gather_internal.h"
 #include "arrow/compute/kernels/vector_selection_internal.h"
@@ -40,6 +42,7 @@
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/fixed_width_internal.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging_internal.h"
@@ -529,6 +532,281 @@ Status ExtensionTake(KernelContext* ctx, const ExecSpan& batch, ExecResult* out)
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Take from chunked values
+//
+// Rather than concatenating the chunks of the values first, every index is
+// resolved to a chunk and an index in that chunk with a ChunkResolver.
+// Fixed-width values are then gathered directly from their chunks. Values of
+// other types are taken from each chunk in turn, and the pieces (which are as
+// large as the output, not the input) are put back in index order with a final
+// take that is skipped if they already are in order.
+
+template <typename IndexCType>
+using TakeLocations = std::vector<TypedChunkLocation<IndexCType>>;
+
+template <typename IndexCType, int kByteWidth>
+void GatherFixedWidthFromChunks(const ArrayVector& chunks,
+                                const TakeLocations<IndexCType>& locations,
+                                const ArraySpan& indices, int64_t byte_width,
+                                ArrayData* out) {
+  if constexpr (kByteWidth > 0) {
+    DCHECK_EQ(byte_width, kByteWidth);
+    byte_width = kByteWidth;
+  }
+  std::vector<const uint8_t*> chunk_values(chunks.size());
+  std::vector<const uint8_t*> chunk_is_valid(chunks.size());
+  std::vector<int64_t> chunk_offsets(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    ArraySpan chunk(*chunks[i]->data());
+    chunk_values[i] = util::OffsetPointerOfFixedByteWidthValues(chunk);
+    chunk_is_valid[i] = chunk.MayHaveNulls() ? chunk.buffers[0].data : nullptr;
+    chunk_offsets[i] = chunk.offset;
+  }
+
+  uint8_t* out_values = util::MutableFixedWidthValuesPointer(out);
+  if (out->buffers[0] == nullptr) {
+    // Neither indices nor values have nulls
+    for (int64_t i = 0; i < indices.length; ++i) {
+      const auto& loc = locations[i];
+      memcpy(out_values + i * byte_width,
+             chunk_values[loc.chunk_index] + loc.index_in_chunk * byte_width,
+             byte_width);
+    }
+    out->null_count = 0;
+    return;
+  }
+
+  uint8_t* out_is_valid = out->buffers[0]->mutable_data();
+  int64_t valid_count = 0;
+  for (int64_t i = 0; i < indices.length; ++i) {
+    bool is_valid = indices.IsValid(i);
+    if (is_valid) {
+      const auto& loc = locations[i];
+      const uint8_t* is_valid_bitmap = chunk_is_valid[loc.chunk_index];
+      is_valid = is_valid_bitmap == nullptr ||
+                 bit_util::GetBit(is_valid_bitmap,
+                                  chunk_offsets[loc.chunk_index] + loc.index_in_chunk);
+      if (is_valid) {
+        memcpy(out_values + i * byte_width,
+               chunk_values[loc.chunk_index] + loc.index_in_chunk * byte_width,
+               byte_width);
+      }
+    }
+    if (!is_valid) {
+      memset(out_values + i * byte_width, 0, byte_width);
+    }
+    bit_util::SetBitTo(out_is_valid, i, is_valid);
+    valid_count += is_valid;
+  }
+  out->null_count = indices.length - valid_count;
+}
+
+// Whether the values can be gathered by GatherFixedWidthFromChunks
+bool CanGatherFixedWidthFromChunks(const ChunkedArray& values) {
+  if (util::FixedWidthInBytes(*values.type()) <= 0) {
+    // Booleans and zero-width values
+    return false;
+  }
+  for (const auto& chunk : values.chunks()) {
+    if (!util::IsFixedWidthLike(ArraySpan(*chunk->data()), /*force_null_count=*/false,
+                                /*exclude_bool_and_dictionary=*/true)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> TakeFixedWidthFromChunks(
+    const ChunkedArray& values, const TakeLocations<IndexCType>& locations,
+    const ArraySpan& indices, ExecContext* ctx) {
+  bool allocate_validity = indices.MayHaveNulls();
+  for (const auto& chunk : values.chunks()) {
+    allocate_validity = allocate_validity || chunk->data()->MayHaveNulls();
+  }
+  KernelContext kernel_ctx(ctx);
+  auto out = std::make_shared<ArrayData>(values.type(), indices.length);
+  RETURN_NOT_OK(util::internal::PreallocateFixedWidthArrayData(
+      &kernel_ctx, indices.length, /*source=*/ArraySpan(*values.chunk(0)->data()),
+      allocate_validity, out.get()));
+
+  const int64_t byte_width = util::FixedWidthInBytes(*values.type());
+  switch (byte_width) {
+    case 1:
+      GatherFixedWidthFromChunks<IndexCType, 1>(values.chunks(), locations, indices,
+                                                byte_width, out.get());
+      break;
+    case 2:
+      GatherFixedWidthFromChunks<IndexCType, 2>(values.chunks(), locations, indices,
+                                                byte_width, out.get());
+      break;
+    case 4:
+      GatherFixedWidthFromChunks<IndexCType, 4>(values.chunks(), locations, indices,
+                                                byte_width, out.get());
+      break;
+    case 8:
+      GatherFixedWidthFromChunks<IndexCType, 8>(values.chunks(), locations, indices,
+                                                byte_width, out.get());
+      break;
+    case 16:
+      GatherFixedWidthFromChunks<IndexCType, 16>(values.chunks(), locations, indices,
+                                                 byte_width, out.get());
+      break;
+    default:
+      GatherFixedWidthFromChunks<IndexCType, 0>(values.chunks(), locations, indices,
+                                                byte_width, out.get());
+      break;
+  }
+  return out;
+}
+
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> TakeFromChunksByChunk(
+    const ChunkedArray& values, const TakeLocations<IndexCType>& locations,
+    const ArraySpan& indices, ExecContext* ctx) {
+  MemoryPool* pool = ctx->memory_pool();
+  const int num_chunks = values.num_chunks();
+  const int64_t length = indices.length;
+
+  // Bucket the non-null indices by chunk (a counting sort, so that the indices
+  // into each chunk keep their relative order)
+  std::vector<int64_t> chunk_starts(num_chunks + 1, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    if (indices.IsValid(i)) {
+      DCHECK_LT(locations[i].chunk_index, static_cast<uint64_t>(num_chunks));
+      ++chunk_starts[locations[i].chunk_index + 1];
+    }
+  }
+  for (int c = 0; c < num_chunks; ++c) {
+    chunk_starts[c + 1] += chunk_starts[c];
+  }
+  const int64_t num_valid = chunk_starts[num_chunks];
+
+  ARROW_ASSIGN_OR_RAISE(auto local_indices,
+                        AllocateBuffer(num_valid * sizeof(IndexCType), pool));
+  ARROW_ASSIGN_OR_RAISE(auto positions, AllocateBuffer(length * sizeof(int64_t), pool));
+  auto* local_indices_data = local_indices->mutable_data_as<IndexCType>();
+  auto* positions_data = positions->mutable_data_as<int64_t>();
+  std::vector<int64_t> cursors(chunk_starts.begin(), chunk_starts.end() - 1);
+  bool in_order = true;
+  for (int64_t i = 0; i < length; ++i) {
+    if (indices.IsValid(i)) {
+      const auto& loc = locations[i];
+      const int64_t position = cursors[loc.chunk_index]++;
+      local_indices_data[position] = loc.index_in_chunk;
+      positions_data[i] = position;
+      in_order = in_order && position == i;
+    } else {
+      positions_data[i] = 0;
+      in_order = false;
+    }
+  }
+
+  std::shared_ptr<Buffer> local_indices_buffer = std::move(local_indices);
+  auto local_indices_type = CTypeTraits<IndexCType>::type_singleton();
+  ArrayVector pieces;
+  for (int c = 0; c < num_chunks; ++c) {
+    const int64_t piece_length = chunk_starts[c + 1] - chunk_starts[c];
+    if (piece_length == 0) {
+      continue;
+    }
+    auto piece_indices = ArrayData::Make(
+        local_indices_type, piece_length,
+        {nullptr, SliceBuffer(local_indices_buffer, chunk_starts[c] * sizeof(IndexCType),
+                              piece_length * sizeof(IndexCType))},
+        /*null_count=*/0);
+    ARROW_ASSIGN_OR_RAISE(Datum piece, Take(values.chunk(c), std::move(piece_indices),
+                                            TakeOptions::NoBoundsCheck(), ctx));
+    pieces.push_back(piece.make_array());
+  }
+
+  std::shared_ptr<Array> gathered;
+  if (pieces.empty()) {
+    ARROW_ASSIGN_OR_RAISE(gathered, MakeArrayOfNull(values.type(), 0, pool));
+  } else if (pieces.size() == 1) {
+    gathered = std::move(pieces[0]);
+  } else {
+    ARROW_ASSIGN_OR_RAISE(gathered, Concatenate(pieces, pool));
+  }
+  if (in_order) {
+    // Also implies that there are no null indices
+    return gathered->data();
+  }
+
+  std::shared_ptr<Buffer> positions_validity;
+  if (indices.MayHaveNulls()) {
+    ARROW_ASSIGN_OR_RAISE(positions_validity,
+                          ::arrow::internal::CopyBitmap(pool, indices.buffers[0].data,
+                                                        indices.offset, length));
+  }
+  auto positions_data_array =
+      ArrayData::Make(int64(), length,
+                      {std::move(positions_validity), std::move(positions)},
+                      indices.GetNullCount());
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        Take(std::move(gathered), std::move(positions_data_array),
+                             TakeOptions::NoBoundsCheck(), ctx));
+  return result.array();
+}
+
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> TakeFromChunksImpl(const ChunkedArray& values,
+                                                      const ChunkResolver& resolver,
+                                                      const ArraySpan& indices,
+                                                      ExecContext* ctx) {
+  // Null index slots may hold any value, they are resolved all the same but
+  // their locations are never used.
+  TakeLocations<IndexCType> locations(indices.length);
+  const bool resolved = resolver.ResolveMany(
+      indices.length, indices.GetValues<IndexCType>(1), locations.data());
+  DCHECK(resolved);
+  ARROW_UNUSED(resolved);
+
+  if (CanGatherFixedWidthFromChunks(values)) {
+    return TakeFixedWidthFromChunks(values, locations, indices, ctx);
+  }
+  return TakeFromChunksByChunk(values, locations, indices, ctx);
+}
+
+/// \brief Take from a ChunkedArray of at least two chunks without
+/// concatenating them.
+Result<std::shared_ptr<ArrayData>> TakeFromChunks(const ChunkedArray& values,
+                                                  const ChunkResolver& resolver,
+                                                  const Array& indices,
+                                                  const TakeOptions& options,
+                                                  ExecContext* ctx) {
+  if (!is_integer(indices.type_id())) {
+    return Status::TypeError("Take indices must be of integer type, got ",
+                             *indices.type());
+  }
+  const int byte_width = indices.type()->byte_width();
+  if ((byte_width == 1 && values.num_chunks() > std::numeric_limits<uint8_t>::max()) ||
+      (byte_width == 2 && values.num_chunks() > std::numeric_limits<uint16_t>::max())) {
+    // Chunk indices wouldn't fit in the locations resolved for these indices
+    ARROW_ASSIGN_OR_RAISE(Datum wide_indices,
+                          Cast(indices, int32(), CastOptions::Safe(), ctx));
+    return TakeFromChunks(values, resolver, *wide_indices.make_array(), options, ctx);
+  }
+
+  ArraySpan indices_span(*indices.data());
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(indices_span, values.length()));
+  }
+  // As elsewhere, boundschecked indices can be interpreted as unsigned
+  switch (byte_width) {
+    case 1:
+      return TakeFromChunksImpl<uint8_t>(values, resolver, indices_span, ctx);
+    case 2:
+      return TakeFromChunksImpl<uint16_t>(values, resolver, indices_span, ctx);
+    case 4:
+      return TakeFromChunksImpl<uint32_t>(values, resolver, indices_span, ctx);
+    default:
+      DCHECK_EQ(byte_width, 8);
+      return TakeFromChunksImpl<uint64_t>(values, resolver, indices_span, ctx);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Take metafunction implementation
 
@@ -581,8 +859,11 @@ class TakeMetaFunction : public MetaFunction {
   }
 
   static Result<std::shared_ptr<ArrayData>> TakeCAA(
-      const std::shared_ptr<ChunkedArray>& values, const Array& indices,
-      const TakeOptions& options, ExecContext* ctx) {
+      const std::shared_ptr<ChunkedArray>& values, const ChunkResolver& resolver,
+      const Array& indices, const TakeOptions& options, ExecContext* ctx) {
+    if (values->num_chunks() > 1) {
+      return TakeFromChunks(*values, resolver, indices, options, ctx);
+    }
     ARROW_ASSIGN_OR_RAISE(auto values_array,
                           ChunkedArrayAsArray(values, ctx->memory_pool()));
     std::vector<Datum> args = {std::move(values_array), indices};
@@ -592,7 +873,9 @@ class TakeMetaFunction : public MetaFunction {
   static Result<std::shared_ptr<ChunkedArray>> TakeCAC(
       const std::shared_ptr<ChunkedArray>& values, const Array& indices,
       const TakeOptions& options, ExecContext* ctx) {
-    ARROW_ASSIGN_OR_RAISE(auto new_chunk, TakeCAA(values, indices, options, ctx));
+    ChunkResolver resolver(values->chunks());
+    ARROW_ASSIGN_OR_RAISE(auto new_chunk,
+                          TakeCAA(values, resolver, indices, options, ctx));
     return std::make_shared<ChunkedArray>(MakeArray(std::move(new_chunk)));
   }
 
@@ -600,22 +883,17 @@ class TakeMetaFunction : public MetaFunction {
       const std::shared_ptr<ChunkedArray>& values,
       const std::shared_ptr<ChunkedArray>& indices, const TakeOptions& options,
       ExecContext* ctx) {
-    // XXX: for every chunk in indices, values are gathered from all chunks in values to
-    // form a new chunk in the result. Performing this concatenation is not ideal, but
-    // greatly simplifies the implementation before something more efficient is
-    // implemented.
-    ARROW_ASSIGN_OR_RAISE(auto values_array,
-                          ChunkedArrayAsArray(values, ctx->memory_pool()));
-    std::vector<Datum> args = {std::move(values_array), {}};
-    std::vector<std::shared_ptr<Array>> new_chunks;
-    new_chunks.resize(indices->num_chunks());
-    for (int i = 0; i < indices->num_chunks(); i++) {
-      args[1] = indices->chunk(i);
-      // XXX: this loop can use TakeCAA once it can handle ChunkedArray
-      // without concatenating first
-      ARROW_ASSIGN_OR_RAISE(auto chunk, TakeAAA(args, options, ctx));
-      new_chunks[i] = MakeArray(chunk);
-    }
+    // Every chunk of indices produces a chunk of the result, gathering values
+    // from all the chunks of values as needed
+    ChunkResolver resolver(values->chunks());
+    std::vector<std::shared_ptr<Array>> new_chunks(indices->num_chunks());
+    RETURN_NOT_OK(OptionalParallelForSelection(
+        ctx, indices->length(), indices->num_chunks(), [&](int i) -> Status {
+          ARROW_ASSIGN_OR_RAISE(
+              auto chunk, TakeCAA(values, resolver, *indices->chunk(i), options, ctx));
+          new_chunks[i] = MakeArray(std::move(chunk));
+          return Status::OK();
+        }));
     return std::make_shared<ChunkedArray>(std::move(new_chunks), values->type());
   }
 
@@ -657,20 +935,38 @@ class TakeMetaFunction : public MetaFunction {
                                                 ExecContext* ctx) {
     auto ncols = table->num_columns();
     std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
-
-    for (int j = 0; j < ncols; j++) {
-      ARROW_ASSIGN_OR_RAISE(columns[j], TakeCAC(table->column(j), indices, options, ctx));
-    }
+    RETURN_NOT_OK(OptionalParallelForSelection(
+        ctx, ncols * indices.length(), ncols, [&](int j) -> Status {
+          return TakeCAC(table->column(j), indices, options, ctx).Value(&columns[j]);
+        }));
     return Table::Make(table->schema(), std::move(columns));
   }
 
   static Result<std::shared_ptr<Table>> TakeTCT(
       const std::shared_ptr<Table>& table, const std::shared_ptr<ChunkedArray>& indices,
       const TakeOptions& options, ExecContext* ctx) {
-    auto ncols = table->num_columns();
+    // One task per output chunk of every column
+    const int ncols = table->num_columns();
+    const int nchunks = indices->num_chunks();
+    std::vector<ChunkResolver> resolvers;
+    resolvers.reserve(ncols);
+    for (int j = 0; j < ncols; j++) {
+      resolvers.emplace_back(table->column(j)->chunks());
+    }
+    std::vector<ArrayVector> new_chunks(ncols, ArrayVector(nchunks));
+    RETURN_NOT_OK(OptionalParallelForSelection(
+        ctx, ncols * indices->length(), ncols * nchunks, [&](int task) -> Status {
+          const int j = task / nchunks;
+          const int i = task % nchunks;
+          ARROW_ASSIGN_OR_RAISE(auto chunk, TakeCAA(table->column(j), resolvers[j],
+                                                    *indices->chunk(i), options, ctx));
+          new_chunks[j][i] = MakeArray(std::move(chunk));
+          return Status::OK();
+        }));
     std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
     for (int j = 0; j < ncols; j++) {
-      ARROW_ASSIGN_OR_RAISE(columns[j], TakeCCC(table->column(j), indices, options, ctx));
+      columns[j] = std::make_shared<ChunkedArray>(std::move(new_chunks[j]),
+                                                  table->column(j)->type());
     }
     return Table::Make(table->schema(), std::move(columns));
   }
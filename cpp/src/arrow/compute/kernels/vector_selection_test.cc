@@ -2192,6 +2192,77 @@ TEST(TestTakeKernelWithChunkedIndices, TakeChunkedArray) {
   }
 }
 
+TEST(TestTakeKernelWithChunkedIndices, TakeChunkedArrayMatchesConcatenated) {
+  // Chunked values are taken from without being concatenated, which must give
+  // the same results as taking from the concatenated values
+  random::RandomArrayGenerator rng(kRandomSeed);
+  auto check = [&](const std::shared_ptr<ChunkedArray>& values,
+                   const std::shared_ptr<Array>& indices) {
+    ARROW_SCOPED_TRACE("values type: ", *values->type(), ", indices: ", *indices);
+    ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(values->chunks()));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Take(concatenated, indices));
+    ASSERT_OK_AND_ASSIGN(Datum actual, Take(values, indices));
+    ValidateOutput(actual);
+    ASSERT_EQ(actual.chunked_array()->num_chunks(), 1);
+    AssertArraysEqual(*expected.make_array(), *actual.chunked_array()->chunk(0),
+                      /*verbose=*/true);
+
+    auto chunked_indices = std::make_shared<ChunkedArray>(
+        ArrayVector{indices->Slice(0, 3), indices->Slice(3)}, indices->type());
+    ASSERT_OK_AND_ASSIGN(actual, Take(values, chunked_indices));
+    ValidateOutput(actual);
+    ASSERT_OK_AND_ASSIGN(auto actual_array,
+                         Concatenate(actual.chunked_array()->chunks()));
+    AssertArraysEqual(*expected.make_array(), *actual_array, /*verbose=*/true);
+  };
+
+  for (const auto& type :
+       {int32(), float64(), decimal128(12, 2), fixed_size_binary(3), boolean(), utf8(),
+        large_binary(), list(int16()), fixed_size_list(int8(), 2),
+        struct_({field("a", int32()), field("b", utf8())}),
+        dictionary(int8(), utf8())}) {
+    auto values = rng.ArrayOf(type, 100, /*null_probability=*/0.2);
+    // Uneven chunks, one of them empty and some of them sliced
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{values->Slice(0, 10), values->Slice(10, 0), values->Slice(10, 45),
+                    values->Slice(55, 44), values->Slice(99)},
+        type);
+
+    check(chunked, ArrayFromJSON(int32(), "[0, 99, 10, 54, 55, 3, 98, 12]"));
+    check(chunked, ArrayFromJSON(int64(), "[0, 1, 2, 20, 50, 60, 70, 99]"));
+    check(chunked, ArrayFromJSON(uint8(), "[null, 99, 10, null, 55, 3, 12, 12]"));
+    check(chunked, rng.Int16(1000, 0, 99, /*null_probability=*/0.1));
+    check(chunked, rng.Int16(1000, 0, 99, /*null_probability=*/0));
+  }
+}
+
+TEST(TestTakeKernelWithChunkedIndices, TakeChunkedArrayManyChunks) {
+  // More chunks than int8 indices can address as chunk numbers
+  ArrayVector chunks;
+  for (int i = 0; i < 300; ++i) {
+    chunks.push_back(ArrayFromJSON(utf8(), "[\"" + std::to_string(i) + "\"]"));
+  }
+  auto values = std::make_shared<ChunkedArray>(chunks);
+  AssertChunkedEqual(*ChunkedArrayFromJSON(utf8(), {R"(["0", "127", null, "5"])"}),
+                     *Take(values, ArrayFromJSON(int8(), "[0, 127, null, 5]"))
+                          ->chunked_array());
+  ASSERT_RAISES(IndexError, Take(values, ArrayFromJSON(int16(), "[300]")));
+}
+
+TEST(TestTakeKernelWithChunkedIndices, TakeChunkedDictionaries) {
+  // Chunks with different dictionaries
+  auto values = std::make_shared<ChunkedArray>(ArrayVector{
+      DictArrayFromJSON(dictionary(int8(), utf8()), "[0, 1, null]", R"(["a", "b"])"),
+      DictArrayFromJSON(dictionary(int8(), utf8()), "[1, 0]", R"(["c", "a"])")});
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       Take(values, ArrayFromJSON(int32(), "[4, 2, 3, 0, null, 1]")));
+  ValidateOutput(actual);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(actual, utf8()));
+  AssertChunkedEqual(
+      *ChunkedArrayFromJSON(utf8(), {R"(["c", null, "a", "a", null, "b"])"}),
+      *decoded.chunked_array());
+}
+
 TEST(TestTakeKernelWithTable, TakeTable) {
   std::vector<std::shared_ptr<Field>> fields = {field("a", int32()), field("b", utf8())};
   auto schm = schema(fields);
@@ -242,9 +242,11 @@ class TestNthToIndicesForDecimal : public TestNthToIndicesBase<ArrowType> {
 };
 TYPED_TEST_SUITE(TestNthToIndicesForDecimal, DecimalArrowTypes);
 
+using NthToIndicesStringTypes = testing::Types<StringType, StringViewType>;
+
 template <typename ArrowType>
 class TestNthToIndicesForStrings : public TestNthToIndices<ArrowType> {};
-TYPED_TEST_SUITE(TestNthToIndicesForStrings, testing::Types<StringType>);
+TYPED_TEST_SUITE(TestNthToIndicesForStrings, NthToIndicesStringTypes);
 
 TYPED_TEST(TestNthToIndicesForReal, NthToIndicesDoesNotProvideDefaultOptions) {
   auto input = ArrayFromJSON(this->GetType(), "[null, 1, 3.3, null, 2, 5.3]");
@@ -591,7 +593,7 @@ template <typename ArrowType>
 class TestArraySortIndicesForTemporal : public TestArraySortIndices<ArrowType> {};
 TYPED_TEST_SUITE(TestArraySortIndicesForTemporal, TemporalArrowTypes);
 
-using StringSortTestTypes = testing::Types<StringType, LargeStringType>;
+using StringSortTestTypes = testing::Types<StringType, LargeStringType, StringViewType>;
 
 template <typename ArrowType>
 class TestArraySortIndicesForStrings : public TestArraySortIndices<ArrowType> {};
@@ -757,6 +759,13 @@ TYPED_TEST(TestArraySortIndicesForStrings, SortStrings) {
                             null_placement, "[1, 2, 0]");
     this->AssertSortIndices(R"(["testing", "sort", "for", "strings"])",
                             SortOrder::Ascending, null_placement, "[2, 1, 3, 0]");
+    // Strings sharing a prefix and exceeding the inline size of views
+    this->AssertSortIndices(
+        R"(["a long string value", "a long string valuf", "a long str", "a"])",
+        SortOrder::Ascending, null_placement, "[3, 2, 0, 1]");
+    this->AssertSortIndices(
+        R"(["a long string value", "a long string valuf", "a long str", "a"])",
+        SortOrder::Descending, null_placement, "[1, 0, 2, 3]");
   }
 
   const char* input = R"([null, "c", "b", null, "a", "b"])";
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/wrapped_kernel_internal.h"
+
+#include <utility>
+
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+using ::arrow::compute::detail::KernelExecutor;
+
+Result<Datum> ExecuteWith(KernelExecutor* executor, const ExecBatch& batch) {
+  ::arrow::compute::detail::DatumAccumulator listener;
+  RETURN_NOT_OK(executor->Execute(batch, &listener));
+  return executor->WrapResults(batch.values, listener.values());
+}
+
+}  // namespace
+
+Result<TypeHolder> WrappedKernelState::GetOutputType(KernelContext* ctx) {
+  if (ctx->state() == NULLPTR) {
+    return Status::Invalid("Wrapping kernel output type resolved before init");
+  }
+  return Get(ctx).out_type;
+}
+
+Status WrappedKernelState::Init(KernelContext* ctx, const ScalarFunction* func,
+                                std::vector<TypeHolder> decoded_types,
+                                const FunctionOptions* options) {
+  in_types = std::move(decoded_types);
+  ARROW_ASSIGN_OR_RAISE(kernel, func->DispatchBest(&in_types));
+  this->options = options;
+
+  executor_ctx_ = std::make_unique<KernelContext>(ctx->exec_context(), kernel);
+  if (kernel->init) {
+    ARROW_ASSIGN_OR_RAISE(kernel_state,
+                          kernel->init(executor_ctx_.get(), {kernel, in_types, options}));
+    executor_ctx_->SetState(kernel_state.get());
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      out_type, kernel->signature->out_type().Resolve(executor_ctx_.get(), in_types));
+
+  executor_ = KernelExecutor::MakeScalar();
+  return executor_->Init(executor_ctx_.get(), {kernel, in_types, options});
+}
+
+Result<Datum> WrappedKernelState::Execute(KernelContext* ctx, std::vector<Datum> args,
+                                          int64_t length) const {
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (in_types[i] != args[i].type()) {
+      ARROW_ASSIGN_OR_RAISE(args[i], Cast(args[i], CastOptions::Safe(in_types[i]),
+                                          ctx->exec_context()));
+    }
+  }
+  ExecBatch batch(std::move(args), length);
+
+  // An executor can't be shared by concurrent executions, so those get their own
+  std::unique_lock<std::mutex> lock(executor_mutex_, std::try_to_lock);
+  if (lock.owns_lock() && executor_ctx_->exec_context() == ctx->exec_context()) {
+    return ExecuteWith(executor_.get(), batch);
+  }
+  if (lock.owns_lock()) {
+    lock.unlock();
+  }
+  KernelContext kernel_ctx(ctx->exec_context(), kernel);
+  kernel_ctx.SetState(kernel_state.get());
+  auto executor = KernelExecutor::MakeScalar();
+  RETURN_NOT_OK(executor->Init(&kernel_ctx, {kernel, in_types, options}));
+  return ExecuteWith(executor.get(), batch);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
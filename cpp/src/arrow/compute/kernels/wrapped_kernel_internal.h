@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+// Helpers for kernels that wrap another kernel of the same function, e.g. to
+// evaluate it on the values of dictionary or run-end encoded arguments.
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+/// \brief The kernel of a function selected for the decoded argument types of
+/// a wrapping kernel, together with its initialized state
+///
+/// This is immutable once initialized so that it can be shared by concurrent
+/// executions, e.g. of a bound Expression.  The executor of the wrapped kernel
+/// is created on init and reused by executions that don't overlap.
+struct WrappedKernelState : public KernelState {
+  const Kernel* kernel = NULLPTR;
+  std::unique_ptr<KernelState> kernel_state;
+  std::vector<TypeHolder> in_types;
+  TypeHolder out_type;
+  const FunctionOptions* options = NULLPTR;
+
+  static const WrappedKernelState& Get(KernelContext* ctx) {
+    return ::arrow::internal::checked_cast<const WrappedKernelState&>(*ctx->state());
+  }
+
+  /// \brief The output type of the wrapped kernel, from which the wrapping
+  /// kernel resolves its own
+  static Result<TypeHolder> GetOutputType(KernelContext* ctx);
+
+  /// \brief Dispatch `func` on the decoded argument types and initialize the
+  /// selected kernel
+  Status Init(KernelContext* ctx, const ScalarFunction* func,
+              std::vector<TypeHolder> decoded_types, const FunctionOptions* options);
+
+  /// \brief Execute the wrapped kernel on decoded arguments of the given length
+  Result<Datum> Execute(KernelContext* ctx, std::vector<Datum> args,
+                        int64_t length) const;
+
+ private:
+  std::unique_ptr<KernelContext> executor_ctx_;
+  std::unique_ptr<::arrow::compute::detail::KernelExecutor> executor_;
+  mutable std::mutex executor_mutex_;
+};
+
+/// \brief Make the init function of a kernel wrapping the kernel of `func`
+/// selected for the argument types transformed by `decode_types`
+template <typename State = WrappedKernelState>
+KernelInit MakeWrappedKernelInit(const ScalarFunction* func,
+                                 void (*decode_types)(std::vector<TypeHolder>*)) {
+  return [func, decode_types](KernelContext* ctx, const KernelInitArgs& args)
+             -> Result<std::unique_ptr<KernelState>> {
+    auto state = std::make_unique<State>();
+    std::vector<TypeHolder> decoded_types = args.inputs;
+    decode_types(&decoded_types);
+    RETURN_NOT_OK(state->Init(ctx, func, std::move(decoded_types), args.options));
+    return state;
+  };
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
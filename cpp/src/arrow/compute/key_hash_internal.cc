@@ -357,12 +357,19 @@ void Hashing32::HashInt(bool combine_hashes, uint32_t num_keys, uint64_t key_len
 void Hashing32::HashFixed(int64_t hardware_flags, bool combine_hashes, uint32_t num_keys,
                           uint64_t key_length, const uint8_t* keys, uint32_t* hashes,
                           uint32_t* temp_hashes_for_combine) {
+  uint32_t num_processed = 0;
   if (ARROW_POPCOUNT64(key_length) == 1 && key_length <= sizeof(uint64_t)) {
-    HashInt(combine_hashes, num_keys, key_length, keys, hashes);
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+    if ((hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+        arrow::internal::CpuInfo::AVX512) {
+      num_processed = HashInt_avx512(combine_hashes, num_keys, key_length, keys, hashes);
+    }
+#endif
+    HashInt(combine_hashes, num_keys - num_processed, key_length,
+            keys + key_length * num_processed, hashes + num_processed);
     return;
   }
 
-  uint32_t num_processed = 0;
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (hardware_flags & arrow::internal::CpuInfo::AVX2) {
     num_processed = HashFixedLen_avx2(combine_hashes, num_keys, key_length, keys, hashes,
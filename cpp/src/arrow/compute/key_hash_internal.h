@@ -155,6 +155,14 @@ class ARROW_EXPORT Hashing32 {
                                   const uint8_t* concatenated_keys, uint32_t* hashes,
                                   uint32_t* hashes_temp_for_combine);
 #endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  template <bool T_COMBINE_HASHES, typename T>
+  static uint32_t HashIntImp_avx512(uint32_t num_keys, const T* keys, uint32_t* hashes);
+  static uint32_t HashInt_avx512(bool combine_hashes, uint32_t num_keys,
+                                 uint64_t key_length, const uint8_t* keys,
+                                 uint32_t* hashes);
+#endif
 };
 
 class ARROW_EXPORT Hashing64 {
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Load 8 consecutive keys, zero-extended to 64 bits
+template <typename T>
+inline __m512i LoadKeys8_avx512(const T* keys);
+
+template <>
+inline __m512i LoadKeys8_avx512<uint8_t>(const uint8_t* keys) {
+  return _mm512_cvtepu8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(keys)));
+}
+
+template <>
+inline __m512i LoadKeys8_avx512<uint16_t>(const uint16_t* keys) {
+  return _mm512_cvtepu16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys)));
+}
+
+template <>
+inline __m512i LoadKeys8_avx512<uint32_t>(const uint32_t* keys) {
+  return _mm512_cvtepu32_epi64(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys)));
+}
+
+template <>
+inline __m512i LoadKeys8_avx512<uint64_t>(const uint64_t* keys) {
+  return _mm512_loadu_si512(keys);
+}
+
+// Upper 32 bits of the 64-bit products of 8 keys with the multiplier
+template <typename T>
+inline __m256i MultiplyHigh8_avx512(const T* keys) {
+  constexpr uint64_t kMultiplier = 11400714785074694791ULL;
+  const __m512i multiplier = _mm512_set1_epi64(static_cast<int64_t>(kMultiplier));
+  __m512i product = _mm512_mullo_epi64(LoadKeys8_avx512(keys), multiplier);
+  return _mm512_cvtepi64_epi32(_mm512_srli_epi64(product, 32));
+}
+
+}  // namespace
+
+// Same computation as HashIntImp: the hash is the lower half of the byte-swapped 64-bit
+// product, that is the byte-swapped upper half of the product.
+//
+template <bool T_COMBINE_HASHES, typename T>
+uint32_t Hashing32::HashIntImp_avx512(uint32_t num_keys, const T* keys,
+                                      uint32_t* hashes) {
+  constexpr int unroll = 16;
+  const __m512i byte_swap =
+      _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+  for (uint32_t i = 0; i < num_keys / unroll; ++i) {
+    __m256i hash_lo = MultiplyHigh8_avx512(keys + i * unroll);
+    __m256i hash_hi = MultiplyHigh8_avx512(keys + i * unroll + unroll / 2);
+    __m512i hash = _mm512_inserti64x4(_mm512_castsi256_si512(hash_lo), hash_hi, 1);
+    hash = _mm512_shuffle_epi8(hash, byte_swap);
+    if (T_COMBINE_HASHES) {
+      __m512i previous_hash = _mm512_loadu_si512(hashes + i * unroll);
+      __m512i x = _mm512_add_epi32(_mm512_slli_epi32(previous_hash, 6),
+                                   _mm512_srli_epi32(previous_hash, 2));
+      __m512i y = _mm512_add_epi32(hash, _mm512_set1_epi32(kCombineConst));
+      hash = _mm512_xor_si512(previous_hash, _mm512_add_epi32(x, y));
+    }
+    _mm512_storeu_si512(hashes + i * unroll, hash);
+  }
+  return num_keys - (num_keys % unroll);
+}
+
+uint32_t Hashing32::HashInt_avx512(bool combine_hashes, uint32_t num_keys,
+                                   uint64_t key_length, const uint8_t* keys,
+                                   uint32_t* hashes) {
+  switch (key_length) {
+    case sizeof(uint8_t):
+      return combine_hashes ? HashIntImp_avx512<true>(num_keys, keys, hashes)
+                            : HashIntImp_avx512<false>(num_keys, keys, hashes);
+    case sizeof(uint16_t):
+      return combine_hashes
+                 ? HashIntImp_avx512<true>(
+                       num_keys, reinterpret_cast<const uint16_t*>(keys), hashes)
+                 : HashIntImp_avx512<false>(
+                       num_keys, reinterpret_cast<const uint16_t*>(keys), hashes);
+    case sizeof(uint32_t):
+      return combine_hashes
+                 ? HashIntImp_avx512<true>(
+                       num_keys, reinterpret_cast<const uint32_t*>(keys), hashes)
+                 : HashIntImp_avx512<false>(
+                       num_keys, reinterpret_cast<const uint32_t*>(keys), hashes);
+    case sizeof(uint64_t):
+      return combine_hashes
+                 ? HashIntImp_avx512<true>(
+                       num_keys, reinterpret_cast<const uint64_t*>(keys), hashes)
+                 : HashIntImp_avx512<false>(
+                       num_keys, reinterpret_cast<const uint64_t*>(keys), hashes);
+    default:
+      return 0;
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <algorithm>
 #include <chrono>
 #include <map>
 #include <random>
@@ -41,8 +42,8 @@ using internal::CpuInfo;
 namespace compute {
 
 std::vector<int64_t> HardwareFlagsForTesting() {
-  // Our key-hash and key-map routines currently only have AVX2 optimizations
-  return GetSupportedHardwareFlags({CpuInfo::AVX2});
+  // Our key-hash and key-map routines have AVX2 and AVX-512 optimizations
+  return GetSupportedHardwareFlags({CpuInfo::AVX2, CpuInfo::AVX512});
 }
 
 class TestVectorHash {
@@ -315,6 +316,37 @@ TEST(VectorHash, FixedLengthTailByteSafety) {
   HashFixedLengthFrom(/*key_length=*/19, /*num_rows=*/64, /*start_row=*/63);
 }
 
+TEST(VectorHash, IntegerKeys) {
+  constexpr int num_rows = 1000;
+  const auto hardware_flags_for_testing = HardwareFlagsForTesting();
+  ASSERT_GT(hardware_flags_for_testing.size(), 0);
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  for (int key_length : {1, 2, 4, 8}) {
+    std::vector<uint8_t> keys(num_rows * key_length);
+    std::generate(keys.begin(), keys.end(), [&] { return byte_dist(gen); });
+    std::vector<uint32_t> initial_hashes(num_rows);
+    std::generate(initial_hashes.begin(), initial_hashes.end(), [&] { return gen(); });
+
+    for (bool combine_hashes : {false, true}) {
+      ARROW_SCOPED_TRACE("key_length = ", key_length, ", combine = ", combine_hashes);
+      std::vector<std::vector<uint32_t>> hashes32(hardware_flags_for_testing.size(),
+                                                  initial_hashes);
+      for (size_t i = 0; i < hardware_flags_for_testing.size(); ++i) {
+        // Hash from an odd row so that the SIMD loops leave a tail to the scalar code
+        Hashing32::HashFixed(hardware_flags_for_testing[i], combine_hashes, num_rows - 3,
+                             key_length, keys.data() + 3 * key_length,
+                             hashes32[i].data() + 3, /*temp_hashes_for_combine=*/nullptr);
+      }
+      for (size_t i = 1; i < hardware_flags_for_testing.size(); ++i) {
+        ASSERT_EQ(hashes32[i], hashes32[0])
+            << "scalar and simd approaches yielded different 32-bit hashes";
+      }
+    }
+  }
+}
+
 // Make sure that Hashing32/64::HashBatch uses no more stack space than declared in
 // Hashing32/64::kHashBatchTempStackUsage.
 TEST(VectorHash, HashBatchTempStackUsage) {
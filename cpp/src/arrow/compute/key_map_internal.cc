@@ -130,9 +130,15 @@ void SwissTable::extract_group_ids(const int num_keys, const uint16_t* optional_
   int num_processed = 0;
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags_ & CpuInfo::AVX512) == CpuInfo::AVX512 && !optional_selection) {
+    num_processed =
+        extract_group_ids_avx512(num_keys, hashes, local_slots, out_group_ids);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2) && defined(ARROW_HAVE_RUNTIME_BMI2)
-  if ((hardware_flags_ & CpuInfo::AVX2) && CpuInfo::GetInstance()->HasEfficientBmi2() &&
-      !optional_selection) {
+  if (num_processed == 0 && (hardware_flags_ & CpuInfo::AVX2) &&
+      CpuInfo::GetInstance()->HasEfficientBmi2() && !optional_selection) {
     num_processed = extract_group_ids_avx2(num_keys, hashes, local_slots, out_group_ids);
   }
 #endif
@@ -301,8 +307,15 @@ void SwissTable::early_filter(const int num_keys, const uint32_t* hashes,
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
   int num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags_ & CpuInfo::AVX512) == CpuInfo::AVX512) {
+    num_processed = early_filter_imp_avx512_x8(num_keys, hashes, out_match_bitvector,
+                                               out_local_slots);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2) && defined(ARROW_HAVE_RUNTIME_BMI2)
-  if ((hardware_flags_ & CpuInfo::AVX2) && CpuInfo::GetInstance()->HasEfficientBmi2()) {
+  if (num_processed == 0 && (hardware_flags_ & CpuInfo::AVX2) &&
+      CpuInfo::GetInstance()->HasEfficientBmi2()) {
     if (log_blocks_ <= 4) {
       num_processed = early_filter_imp_avx2_x32(num_keys, hashes, out_match_bitvector,
                                                 out_local_slots);
@@ -229,6 +229,15 @@ class ARROW_EXPORT SwissTable {
   int extract_group_ids_avx2(const int num_keys, const uint32_t* hashes,
                              const uint8_t* local_slots, uint32_t* out_group_ids) const;
 #endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // The functions below require AVX512F, AVX512CD, AVX512VL, AVX512DQ and AVX512BW
+  int early_filter_imp_avx512_x8(const int num_hashes, const uint32_t* hashes,
+                                 uint8_t* out_match_bitvector,
+                                 uint8_t* out_local_slots) const;
+  int extract_group_ids_avx512(const int num_keys, const uint32_t* hashes,
+                               const uint8_t* local_slots,
+                               uint32_t* out_group_ids) const;
+#endif
 
   void run_comparisons(const int num_keys, const uint16_t* optional_selection_ids,
                        const uint8_t* optional_selection_bitvector,
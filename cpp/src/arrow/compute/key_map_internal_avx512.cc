@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+
+#include "arrow/compute/key_map_internal.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+// This is a translation of the scalar search_block() for 8 hashes at a time, with each
+// 64-bit block of slot status bytes in its own 64-bit lane.  Byte comparisons produce
+// mask registers directly and leading zero counts are native, so unlike the AVX2
+// version no emulation of either is needed.
+//
+// Returns the number of hashes actually processed, which may be less than
+// requested due to alignment required by SIMD.
+//
+int SwissTable::early_filter_imp_avx512_x8(const int num_hashes, const uint32_t* hashes,
+                                           uint8_t* out_match_bitvector,
+                                           uint8_t* out_local_slots) const {
+  // Number of inputs processed together in a loop
+  constexpr int unroll = 8;
+
+  constexpr uint64_t kEachByteIs1 = 0x0101010101010101ULL;
+  constexpr uint64_t kEachByteIs8 = 0x0808080808080808ULL;
+
+  const int num_group_id_bits = num_groupid_bits_from_log_blocks(log_blocks_);
+  const int num_block_bytes = num_block_bytes_from_num_groupid_bits(num_group_id_bits);
+  const __m512i vstamp_mask = _mm512_set1_epi64((1 << bits_stamp_) - 1);
+  // Broadcasts the lowest byte of every 64-bit lane to the whole lane
+  const __m512i vbyte_repeat_pattern = _mm512_set_epi64(
+      kEachByteIs8, 0, kEachByteIs8, 0, kEachByteIs8, 0, kEachByteIs8, 0);
+
+  // Small tables have all their status words fit into two registers, in which case
+  // they are looked up with a permutation instead of a memory gather.
+  const bool blocks_in_registers = log_blocks_ <= 3;
+  __m512i vblocks_lo = _mm512_setzero_si512();
+  __m512i vblocks_hi = _mm512_setzero_si512();
+  if (blocks_in_registers) {
+    ARROW_DCHECK_EQ(num_block_bytes, 16);
+    const int num_words = (num_block_bytes << log_blocks_) / 8;
+    const auto* blocks_u64 = reinterpret_cast<const uint64_t*>(blocks_->data());
+    vblocks_lo = _mm512_maskz_loadu_epi64(
+        static_cast<__mmask8>((1U << std::min(num_words, 8)) - 1U), blocks_u64);
+    if (num_words > 8) {
+      vblocks_hi = _mm512_maskz_loadu_epi64(
+          static_cast<__mmask8>((1U << (num_words - 8)) - 1U), blocks_u64 + 8);
+    }
+  }
+
+  for (int i = 0; i < num_hashes / unroll; ++i) {
+    // Calculate block index and hash stamp for a byte in a block
+    //
+    __m512i vhash = _mm512_cvtepu32_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes) + i));
+    __m512i vblock_id = _mm512_srli_epi64(vhash, bits_shift_for_block_and_stamp_);
+    __m512i vstamp = _mm512_and_si512(vblock_id, vstamp_mask);
+    vblock_id = _mm512_srli_epi64(vblock_id, bits_shift_for_block_);
+
+    __m512i vblock;
+    if (blocks_in_registers) {
+      // Status words are every num_block_bytes / 8 = 2 words
+      __m512i vword_id = _mm512_slli_epi64(vblock_id, 1);
+      vblock = _mm512_permutex2var_epi64(vblocks_lo, vword_id, vblocks_hi);
+    } else {
+      __m512i vblock_offset =
+          _mm512_mul_epu32(vblock_id, _mm512_set1_epi64(num_block_bytes));
+      vblock = _mm512_i64gather_epi64(vblock_offset, blocks_->data(), 1);
+    }
+
+    // Empty slots have the highest bit set, stamps have it cleared so they can never
+    // match an empty slot.
+    __m512i vstamp_bytes = _mm512_shuffle_epi8(vstamp, vbyte_repeat_pattern);
+    __mmask64 matches = _mm512_cmpeq_epi8_mask(vblock, vstamp_bytes);
+    __mmask64 empty = _mm512_movepi8_mask(vblock);
+
+    // In case when there are no matches in slots and the block is full (no empty slots),
+    // pretend that there is a match in the last slot, i.e. the lowest byte.
+    //
+    matches |= ~empty & kEachByteIs1;
+
+    __m512i vmatches = _mm512_movm_epi8(matches);
+    out_match_bitvector[i] = _mm512_test_epi64_mask(vmatches, vmatches);
+
+    // The highest byte corresponds to the first slot, so the local slot is the number of
+    // leading bytes that are neither a match nor empty.
+    __m512i vlocal_slot =
+        _mm512_srli_epi64(_mm512_lzcnt_epi64(_mm512_movm_epi8(matches | empty)), 3);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out_local_slots + i * unroll),
+                     _mm512_cvtepi64_epi8(vlocal_slot));
+  }
+
+  return num_hashes - (num_hashes % unroll);
+}
+
+// Gathers the candidate group ids pointed to by local slots of 8 keys at a time.  Offsets
+// are computed in 64 bits to avoid overflows in large hash tables (see GH-44513).
+//
+int SwissTable::extract_group_ids_avx512(const int num_keys, const uint32_t* hashes,
+                                         const uint8_t* local_slots,
+                                         uint32_t* out_group_ids) const {
+  // Number of inputs processed together in a loop
+  constexpr int unroll = 8;
+
+  int num_groupid_bits = num_groupid_bits_from_log_blocks(log_blocks_);
+  int num_groupid_bytes = num_groupid_bits / 8;
+  uint32_t mask = num_groupid_bytes == 1   ? 0xFF
+                  : num_groupid_bytes == 2 ? 0xFFFF
+                                           : 0xFFFFFFFF;
+  int num_block_bytes = num_block_bytes_from_num_groupid_bits(num_groupid_bits);
+  const uint8_t* slots_base = blocks_->data() + bytes_status_in_block_;
+
+  for (int i = 0; i < num_keys / unroll; ++i) {
+    __m512i hash = _mm512_cvtepu32_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hashes) + i));
+    // A shift by 32 (for a single block) correctly yields zero for 64-bit lanes
+    __m512i block_id = _mm512_srli_epi64(hash, bits_hash_ - log_blocks_);
+    __m512i local_slot = _mm512_cvtepu8_epi64(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(local_slots + i * unroll)));
+
+    __m512i block_offset = _mm512_mul_epu32(block_id, _mm512_set1_epi64(num_block_bytes));
+    __m512i slot_offset = _mm512_add_epi64(
+        block_offset, _mm512_mul_epu32(local_slot, _mm512_set1_epi64(num_groupid_bytes)));
+    __m256i group_id = _mm512_i64gather_epi32(slot_offset, slots_base, 1);
+    group_id = _mm256_and_si256(group_id, _mm256_set1_epi32(mask));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_group_ids) + i, group_id);
+  }
+  return num_keys - (num_keys % unroll);
+}
+
+}  // namespace compute
+}  // namespace arrow
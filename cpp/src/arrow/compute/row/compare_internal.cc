@@ -128,8 +128,15 @@ void KeyCompare::CompareBinaryColumnToRow(uint32_t offset_within_row,
                                           const RowTableImpl& rows,
                                           uint8_t* match_bytevector) {
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (ctx->has_avx512()) {
+    num_processed = CompareBinaryColumnToRow_avx512(
+        use_selection, offset_within_row, num_rows_to_compare, sel_left_maybe_null,
+        left_to_right_map, ctx, col, rows, match_bytevector);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (ctx->has_avx2()) {
+  if (num_processed == 0 && ctx->has_avx2()) {
     num_processed = CompareBinaryColumnToRow_avx2(
         use_selection, offset_within_row, num_rows_to_compare, sel_left_maybe_null,
         left_to_right_map, ctx, col, rows, match_bytevector);
@@ -312,8 +319,13 @@ void KeyCompare::CompareVarBinaryColumnToRow(uint32_t id_varbinary_col,
 void KeyCompare::AndByteVectors(LightContext* ctx, uint32_t num_elements,
                                 uint8_t* bytevector_A, const uint8_t* bytevector_B) {
   uint32_t num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (ctx->has_avx512()) {
+    num_processed = AndByteVectors_avx512(num_elements, bytevector_A, bytevector_B);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
-  if (ctx->has_avx2()) {
+  if (num_processed == 0 && ctx->has_avx2()) {
     num_processed = AndByteVectors_avx2(num_elements, bytevector_A, bytevector_B);
   }
 #endif
@@ -174,6 +174,19 @@ class ARROW_EXPORT KeyCompare {
       const uint32_t* left_to_right_map, LightContext* ctx, const KeyColumnArray& col,
       const RowTableImpl& rows, uint8_t* match_bytevector);
 
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+
+  static uint32_t AndByteVectors_avx512(uint32_t num_elements, uint8_t* bytevector_A,
+                                        const uint8_t* bytevector_B);
+
+  static uint32_t CompareBinaryColumnToRow_avx512(
+      bool use_selection, uint32_t offset_within_row, uint32_t num_rows_to_compare,
+      const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+      LightContext* ctx, const KeyColumnArray& col, const RowTableImpl& rows,
+      uint8_t* match_bytevector);
+
 #endif
 };
 
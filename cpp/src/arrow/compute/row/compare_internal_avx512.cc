@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+
+#include "arrow/compute/row/compare_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Compares 16 fixed width values of the left column against the corresponding fields
+// of the encoded rows on the right side, outputting one byte (0xFF for equality) per
+// row.
+//
+template <bool use_selection, int column_width>
+uint32_t CompareFixedWidthColumnToRowImp_avx512(
+    uint32_t offset_within_row, uint32_t num_rows_to_compare,
+    const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+    const KeyColumnArray& col, const RowTableImpl& rows, uint8_t* match_bytevector) {
+  static_assert(sizeof(RowTableImpl::offset_type) == sizeof(int64_t),
+                "CompareFixedWidthColumnToRowImp_avx512 only supports 64-bit "
+                "RowTableImpl::offset_type");
+  constexpr uint32_t unroll = 16;
+
+  const bool is_fixed_length = rows.metadata().is_fixed_length;
+  const uint8_t* rows_left = col.data(1);
+  const uint8_t* rows_right =
+      is_fixed_length ? rows.fixed_length_rows(/*row_id=*/0) : rows.var_length_rows();
+  const __m512i fixed_length = _mm512_set1_epi64(rows.metadata().fixed_length);
+  const __m512i field_offset = _mm512_set1_epi64(offset_within_row);
+
+  for (uint32_t i = 0; i < num_rows_to_compare / unroll; ++i) {
+    __m512i irow_left = _mm512_setzero_si512();
+    __m512i irow_right;
+    if (use_selection) {
+      irow_left = _mm512_cvtepu16_epi32(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sel_left_maybe_null) + i));
+      irow_right = _mm512_i32gather_epi32(irow_left, left_to_right_map, 4);
+    } else {
+      irow_right = _mm512_loadu_si512(left_to_right_map + i * unroll);
+    }
+
+    // 64-bit offsets of the field within the right rows, 8 rows per register
+    __m512i offset_right[2];
+    for (int half = 0; half < 2; ++half) {
+      __m256i irow_right_half = half == 0 ? _mm512_castsi512_si256(irow_right)
+                                          : _mm512_extracti64x4_epi64(irow_right, 1);
+      if (is_fixed_length) {
+        offset_right[half] =
+            _mm512_mul_epu32(_mm512_cvtepu32_epi64(irow_right_half), fixed_length);
+      } else {
+        offset_right[half] = _mm512_i32gather_epi64(irow_right_half, rows.offsets(),
+                                                    sizeof(RowTableImpl::offset_type));
+      }
+      offset_right[half] = _mm512_add_epi64(offset_right[half], field_offset);
+    }
+
+    __mmask16 match;
+    if (column_width == sizeof(uint64_t)) {
+      __mmask8 match_half[2];
+      for (int half = 0; half < 2; ++half) {
+        __m512i left;
+        if (use_selection) {
+          __m256i irow_left_half = half == 0 ? _mm512_castsi512_si256(irow_left)
+                                             : _mm512_extracti64x4_epi64(irow_left, 1);
+          left = _mm512_i32gather_epi64(irow_left_half, rows_left, sizeof(uint64_t));
+        } else {
+          left = _mm512_loadu_si512(rows_left +
+                                    (i * unroll + half * unroll / 2) * sizeof(uint64_t));
+        }
+        __m512i right = _mm512_i64gather_epi64(offset_right[half], rows_right, 1);
+        match_half[half] = _mm512_cmpeq_epi64_mask(left, right);
+      }
+      match = static_cast<__mmask16>(match_half[0] | (match_half[1] << 8));
+    } else {
+      __m512i left;
+      if (use_selection) {
+        left = _mm512_i32gather_epi32(irow_left, rows_left, column_width);
+      } else if (column_width == sizeof(uint8_t)) {
+        left = _mm512_cvtepu8_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows_left) + i));
+      } else if (column_width == sizeof(uint16_t)) {
+        left = _mm512_cvtepu16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows_left) + i));
+      } else {
+        left = _mm512_loadu_si512(rows_left + i * unroll * sizeof(uint32_t));
+      }
+      __m256i right_lo = _mm512_i64gather_epi32(offset_right[0], rows_right, 1);
+      __m256i right_hi = _mm512_i64gather_epi32(offset_right[1], rows_right, 1);
+      __m512i right = _mm512_inserti64x4(_mm512_castsi256_si512(right_lo), right_hi, 1);
+      if (column_width != sizeof(uint32_t)) {
+        const __m512i mask =
+            _mm512_set1_epi32(column_width == sizeof(uint8_t) ? 0xff : 0xffff);
+        left = _mm512_and_si512(left, mask);
+        right = _mm512_and_si512(right, mask);
+      }
+      match = _mm512_cmpeq_epi32_mask(left, right);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(match_bytevector) + i,
+                     _mm_movm_epi8(match));
+  }
+  return num_rows_to_compare - (num_rows_to_compare % unroll);
+}
+
+template <bool use_selection>
+uint32_t CompareFixedWidthColumnToRow_avx512(
+    uint32_t offset_within_row, uint32_t num_rows_to_compare,
+    const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+    const KeyColumnArray& col, const RowTableImpl& rows, uint8_t* match_bytevector) {
+  switch (col.metadata().fixed_length) {
+    case sizeof(uint8_t):
+      return CompareFixedWidthColumnToRowImp_avx512<use_selection, sizeof(uint8_t)>(
+          offset_within_row, num_rows_to_compare, sel_left_maybe_null, left_to_right_map,
+          col, rows, match_bytevector);
+    case sizeof(uint16_t):
+      return CompareFixedWidthColumnToRowImp_avx512<use_selection, sizeof(uint16_t)>(
+          offset_within_row, num_rows_to_compare, sel_left_maybe_null, left_to_right_map,
+          col, rows, match_bytevector);
+    case sizeof(uint32_t):
+      return CompareFixedWidthColumnToRowImp_avx512<use_selection, sizeof(uint32_t)>(
+          offset_within_row, num_rows_to_compare, sel_left_maybe_null, left_to_right_map,
+          col, rows, match_bytevector);
+    case sizeof(uint64_t):
+      return CompareFixedWidthColumnToRowImp_avx512<use_selection, sizeof(uint64_t)>(
+          offset_within_row, num_rows_to_compare, sel_left_maybe_null, left_to_right_map,
+          col, rows, match_bytevector);
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+uint32_t KeyCompare::AndByteVectors_avx512(uint32_t num_elements, uint8_t* bytevector_A,
+                                           const uint8_t* bytevector_B) {
+  constexpr int unroll = 64;
+  for (uint32_t i = 0; i < num_elements / unroll; ++i) {
+    __m512i result = _mm512_and_si512(_mm512_loadu_si512(bytevector_A + i * unroll),
+                                      _mm512_loadu_si512(bytevector_B + i * unroll));
+    _mm512_storeu_si512(bytevector_A + i * unroll, result);
+  }
+  return (num_elements - (num_elements % unroll));
+}
+
+uint32_t KeyCompare::CompareBinaryColumnToRow_avx512(
+    bool use_selection, uint32_t offset_within_row, uint32_t num_rows_to_compare,
+    const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+    LightContext* ctx, const KeyColumnArray& col, const RowTableImpl& rows,
+    uint8_t* match_bytevector) {
+  uint32_t col_width = col.metadata().fixed_length;
+  if (col_width != 1 && col_width != 2 && col_width != 4 && col_width != 8) {
+    // Bit columns and other widths are left to the AVX2 version
+    return 0;
+  }
+  int64_t num_rows_safe = col.length();
+  if (col_width == 1 || col_width == 2) {
+    // In this case we will access left column memory 4B at a time
+    num_rows_safe =
+        TailSkipForSIMD::FixBinaryAccess(sizeof(uint32_t), col.length(), col_width);
+  }
+  if (sel_left_maybe_null) {
+    num_rows_to_compare = static_cast<uint32_t>(TailSkipForSIMD::FixSelection(
+        num_rows_safe, static_cast<int>(num_rows_to_compare), sel_left_maybe_null));
+  } else {
+    num_rows_to_compare = static_cast<uint32_t>(
+        std::min(num_rows_safe, static_cast<int64_t>(num_rows_to_compare)));
+  }
+
+  if (use_selection) {
+    return CompareFixedWidthColumnToRow_avx512<true>(
+        offset_within_row, num_rows_to_compare, sel_left_maybe_null, left_to_right_map,
+        col, rows, match_bytevector);
+  } else {
+    return CompareFixedWidthColumnToRow_avx512<false>(
+        offset_within_row, num_rows_to_compare, sel_left_maybe_null, left_to_right_map,
+        col, rows, match_bytevector);
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -952,14 +952,446 @@ struct GrouperFastImpl : public Grouper {
   SwissTable::AppendImpl map_append_impl_;
 };
 
+Result<std::unique_ptr<Grouper>> MakeHashGrouper(const std::vector<TypeHolder>& key_types,
+                                                 ExecContext* ctx) {
+  if (GrouperFastImpl::CanUse(key_types)) {
+    return GrouperFastImpl::Make(key_types, ctx);
+  }
+  return GrouperImpl::Make(key_types, ctx);
+}
+
+// A grouper for a single boolean, integer or dictionary key which maps key values
+// to group ids through a table indexed by the value itself, rather than hashing.
+//
+// The table covers the range of values seen so far.  Once that range grows too wide
+// for a dense table, the existing groups are handed over to a hash-based grouper
+// (keeping their ids) which then handles all further batches.
+struct DirectMapGrouper : public Grouper {
+  // Widest range of key values kept in a direct table (256 KiB of group ids)
+  static constexpr uint64_t kMaxTableSize = uint64_t{1} << 16;
+
+  static bool CanUse(const std::vector<TypeHolder>& key_types) {
+    if (key_types.size() != 1) {
+      return false;
+    }
+    const auto id = key_types[0].id();
+    // Dictionary indices are always integers
+    return id == Type::BOOL || is_integer(id) || id == Type::DICTIONARY;
+  }
+
+  static Result<std::unique_ptr<DirectMapGrouper>> Make(
+      const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
+    auto impl = std::make_unique<DirectMapGrouper>();
+    impl->ctx_ = ctx;
+    impl->key_types_ = key_types;
+    impl->key_type_ = key_types[0].GetSharedPtr();
+    impl->physical_id_ = impl->key_type_->id();
+    if (impl->physical_id_ == Type::DICTIONARY) {
+      impl->physical_id_ =
+          checked_cast<const DictionaryType&>(*impl->key_type_).index_type()->id();
+    }
+    return impl;
+  }
+
+  Status Reset() override {
+    table_.clear();
+    table_base_ = 0;
+    keys_.clear();
+    null_group_id_ = kNoGroupId;
+    hash_grouper_.reset();
+    hash_to_group_id_.clear();
+    // As in GrouperFastImpl, the dictionary is assumed to stay the same throughout
+    // the grouper's lifespan.
+    return Status::OK();
+  }
+
+  Status Populate(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeImpl(batch, offset, length, GrouperMode::kPopulate).status();
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeImpl(batch, offset, length, GrouperMode::kConsume);
+  }
+
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeImpl(batch, offset, length, GrouperMode::kLookup);
+  }
+
+  uint32_t num_groups() const override {
+    if (hash_grouper_) {
+      return hash_grouper_->num_groups();
+    }
+    return static_cast<uint32_t>(keys_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    if (hash_grouper_) {
+      return GetHashedUniques();
+    }
+    const auto num_groups = static_cast<int64_t>(keys_.size());
+
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+    if (null_group_id_ != kNoGroupId) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap,
+                            AllocateBitmap(num_groups, ctx_->memory_pool()));
+      bit_util::SetBitsTo(null_bitmap->mutable_data(), 0, num_groups, true);
+      bit_util::ClearBit(null_bitmap->mutable_data(), null_group_id_);
+      null_count = 1;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto values, DecodeKeys());
+    auto uniques = ArrayData::Make(key_type_, num_groups,
+                                   {std::move(null_bitmap), std::move(values)},
+                                   null_count);
+    if (key_type_->id() == Type::DICTIONARY) {
+      if (dictionary_) {
+        uniques->dictionary = dictionary_->data();
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            auto dict,
+            MakeEmptyArray(checked_cast<const DictionaryType&>(*key_type_).value_type(),
+                           ctx_->memory_pool()));
+        uniques->dictionary = dict->data();
+      }
+    }
+    return ExecBatch({std::move(uniques)}, num_groups);
+  }
+
+ private:
+  // Keys are the values widened to 64 bits, with the sign bit of signed values
+  // flipped so that key order matches value order.
+  template <typename CType>
+  static uint64_t ToKey(CType value) {
+    if constexpr (std::is_signed_v<CType>) {
+      return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t{1} << 63);
+    } else {
+      return static_cast<uint64_t>(value);
+    }
+  }
+
+  template <typename CType>
+  static auto ValueKeys(const ArraySpan& data) {
+    const CType* values = data.GetValues<CType>(1);
+    return [values](int64_t i) { return ToKey(values[i]); };
+  }
+
+  Result<std::shared_ptr<Buffer>> DecodeKeys() const {
+    switch (physical_id_) {
+      case Type::BOOL: {
+        ARROW_ASSIGN_OR_RAISE(auto values,
+                              AllocateEmptyBitmap(keys_.size(), ctx_->memory_pool()));
+        for (size_t i = 0; i < keys_.size(); ++i) {
+          bit_util::SetBitTo(values->mutable_data(), i, keys_[i] != 0);
+        }
+        return values;
+      }
+      case Type::INT8:
+        return DecodeKeys<int8_t>();
+      case Type::UINT8:
+        return DecodeKeys<uint8_t>();
+      case Type::INT16:
+        return DecodeKeys<int16_t>();
+      case Type::UINT16:
+        return DecodeKeys<uint16_t>();
+      case Type::INT32:
+        return DecodeKeys<int32_t>();
+      case Type::UINT32:
+        return DecodeKeys<uint32_t>();
+      case Type::INT64:
+        return DecodeKeys<int64_t>();
+      case Type::UINT64:
+        return DecodeKeys<uint64_t>();
+      default:
+        return Status::NotImplemented("Keys of type ", *key_type_);
+    }
+  }
+
+  template <typename CType>
+  Result<std::shared_ptr<Buffer>> DecodeKeys() const {
+    ARROW_ASSIGN_OR_RAISE(auto values, AllocateBuffer(keys_.size() * sizeof(CType),
+                                                      ctx_->memory_pool()));
+    auto out = values->template mutable_data_as<CType>();
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      if constexpr (std::is_signed_v<CType>) {
+        out[i] = static_cast<CType>(static_cast<int64_t>(keys_[i] ^ (uint64_t{1} << 63)));
+      } else {
+        out[i] = static_cast<CType>(keys_[i]);
+      }
+    }
+    return values;
+  }
+
+  Result<Datum> ConsumeImpl(const ExecSpan& batch, int64_t offset, int64_t length,
+                            GrouperMode mode) {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    if (offset != 0 || length != batch.length) {
+      auto batch_slice = batch.ToExecBatch().Slice(offset, length);
+      return ConsumeImpl(ExecSpan(batch_slice), 0, -1, mode);
+    }
+    if (batch.num_values() != 1) {
+      return Status::Invalid("expected batch size 1 but got ", batch.num_values());
+    }
+    // ARROW-14027: broadcast scalar arguments for now
+    if (batch[0].is_scalar()) {
+      ExecBatch expanded = batch.ToExecBatch();
+      ARROW_ASSIGN_OR_RAISE(expanded.values[0],
+                            MakeArrayFromScalar(*expanded.values[0].scalar(),
+                                                expanded.length, ctx_->memory_pool()));
+      return ConsumeImpl(ExecSpan(expanded), 0, -1, mode);
+    }
+    if (hash_grouper_) {
+      return ConsumeHashed(batch, mode);
+    }
+
+    const ArraySpan& data = batch[0].array;
+    if (key_type_->id() == Type::DICTIONARY) {
+      auto dict = MakeArray(data.dictionary().ToArrayData());
+      if (dictionary_) {
+        if (!dictionary_->Equals(dict)) {
+          return Status::NotImplemented("Unifying differing dictionaries");
+        }
+      } else {
+        dictionary_ = std::move(dict);
+      }
+    }
+
+    auto visit = [&](auto&& get_key) -> Result<Datum> {
+      if (mode != GrouperMode::kLookup && !ReserveKeys(data, get_key)) {
+        RETURN_NOT_OK(SwitchToHashGrouper());
+        return ConsumeHashed(batch, mode);
+      }
+      return MapKeys(data, get_key, mode);
+    };
+    switch (physical_id_) {
+      case Type::BOOL: {
+        const uint8_t* bits = data.buffers[1].data;
+        return visit([&](int64_t i) -> uint64_t {
+          return bit_util::GetBit(bits, data.offset + i) ? 1 : 0;
+        });
+      }
+      case Type::INT8:
+        return visit(ValueKeys<int8_t>(data));
+      case Type::UINT8:
+        return visit(ValueKeys<uint8_t>(data));
+      case Type::INT16:
+        return visit(ValueKeys<int16_t>(data));
+      case Type::UINT16:
+        return visit(ValueKeys<uint16_t>(data));
+      case Type::INT32:
+        return visit(ValueKeys<int32_t>(data));
+      case Type::UINT32:
+        return visit(ValueKeys<uint32_t>(data));
+      case Type::INT64:
+        return visit(ValueKeys<int64_t>(data));
+      case Type::UINT64:
+        return visit(ValueKeys<uint64_t>(data));
+      default:
+        return Status::NotImplemented("Keys of type ", *key_type_);
+    }
+  }
+
+  // Grow the table to cover the keys of a batch, so that MapKeys doesn't have to
+  // check bounds when inserting.  Returns false if the range would be too wide.
+  template <typename GetKey>
+  bool ReserveKeys(const ArraySpan& data, GetKey&& get_key) {
+    uint64_t lo = std::numeric_limits<uint64_t>::max();
+    uint64_t hi = 0;
+    const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0].data : NULLPTR;
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (validity && !bit_util::GetBit(validity, data.offset + i)) {
+        continue;
+      }
+      const uint64_t key = get_key(i);
+      lo = std::min(lo, key);
+      hi = std::max(hi, key);
+    }
+    if (lo > hi) {
+      // Only nulls
+      return true;
+    }
+    if (!table_.empty()) {
+      const uint64_t table_end = table_base_ + (table_.size() - 1);
+      if (lo >= table_base_ && hi <= table_end) {
+        return true;
+      }
+      lo = std::min(lo, table_base_);
+      hi = std::max(hi, table_end);
+    }
+    if (hi - lo >= kMaxTableSize) {
+      return false;
+    }
+
+    // Grow at least geometrically, towards the side the new keys fall on, so
+    // that steadily increasing or decreasing keys don't reallocate every batch
+    const uint64_t size = std::max(
+        hi - lo + 1, std::min<uint64_t>(2 * static_cast<uint64_t>(table_.size()),
+                                        kMaxTableSize));
+    if (!table_.empty() && lo < table_base_) {
+      lo = hi >= size - 1 ? hi - (size - 1) : 0;
+    } else {
+      hi = lo <= std::numeric_limits<uint64_t>::max() - (size - 1)
+               ? lo + (size - 1)
+               : std::numeric_limits<uint64_t>::max();
+      lo = hi - (size - 1);
+    }
+
+    std::vector<uint32_t> table(size, kNoGroupId);
+    if (!table_.empty()) {
+      std::copy(table_.begin(), table_.end(), table.begin() + (table_base_ - lo));
+    }
+    table_ = std::move(table);
+    table_base_ = lo;
+    return true;
+  }
+
+  template <typename GetKey>
+  Result<Datum> MapKeys(const ArraySpan& data, GetKey&& get_key, GrouperMode mode) {
+    const int64_t length = data.length;
+    const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0].data : NULLPTR;
+    const bool insert_new_keys = mode != GrouperMode::kLookup;
+
+    TypedBufferBuilder<uint32_t> group_ids_builder(ctx_->memory_pool());
+    TypedBufferBuilder<bool> null_bitmap_builder(ctx_->memory_pool());
+    if (mode == GrouperMode::kConsume) {
+      RETURN_NOT_OK(group_ids_builder.Resize(length));
+    } else if (mode == GrouperMode::kLookup) {
+      RETURN_NOT_OK(group_ids_builder.Resize(length));
+      RETURN_NOT_OK(null_bitmap_builder.Resize(length));
+    }
+
+    for (int64_t i = 0; i < length; ++i) {
+      uint32_t group_id;
+      if (validity && !bit_util::GetBit(validity, data.offset + i)) {
+        if (null_group_id_ == kNoGroupId && insert_new_keys) {
+          null_group_id_ = static_cast<uint32_t>(keys_.size());
+          keys_.push_back(0);
+        }
+        group_id = null_group_id_;
+      } else {
+        const uint64_t slot = get_key(i) - table_base_;
+        if (insert_new_keys) {
+          group_id = table_[slot];
+          if (group_id == kNoGroupId) {
+            group_id = table_[slot] = static_cast<uint32_t>(keys_.size());
+            keys_.push_back(table_base_ + slot);
+          }
+        } else {
+          group_id = slot < table_.size() ? table_[slot] : kNoGroupId;
+        }
+      }
+
+      if (mode == GrouperMode::kConsume) {
+        group_ids_builder.UnsafeAppend(group_id);
+      } else if (mode == GrouperMode::kLookup) {
+        const bool found = group_id != kNoGroupId;
+        group_ids_builder.UnsafeAppend(found ? group_id : 0);
+        null_bitmap_builder.UnsafeAppend(found);
+      }
+    }
+
+    if (mode == GrouperMode::kPopulate) {
+      return Datum();
+    }
+    std::shared_ptr<Buffer> null_bitmap;
+    if (mode == GrouperMode::kLookup) {
+      ARROW_ASSIGN_OR_RAISE(null_bitmap, null_bitmap_builder.Finish());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_builder.Finish());
+    return Datum(UInt32Array(length, std::move(group_ids), std::move(null_bitmap)));
+  }
+
+  // Hand the groups over to a hash-based grouper.  It may number the groups
+  // differently, so for those that existed before the switch its ids are mapped back
+  // to ours.
+  Status SwitchToHashGrouper() {
+    ARROW_ASSIGN_OR_RAISE(auto uniques, GetUniques());
+    ARROW_ASSIGN_OR_RAISE(hash_grouper_, MakeHashGrouper(key_types_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(auto hash_ids, hash_grouper_->Consume(ExecSpan(uniques)));
+    DCHECK_EQ(hash_grouper_->num_groups(), keys_.size());
+
+    const uint32_t* ids = hash_ids.array()->GetValues<uint32_t>(1);
+    bool same_ids = true;
+    hash_to_group_id_.resize(keys_.size());
+    for (uint32_t group_id = 0; group_id < keys_.size(); ++group_id) {
+      hash_to_group_id_[ids[group_id]] = group_id;
+      same_ids &= ids[group_id] == group_id;
+    }
+    if (same_ids) {
+      hash_to_group_id_ = {};
+    }
+    table_ = {};
+    keys_ = {};
+    return Status::OK();
+  }
+
+  Result<Datum> ConsumeHashed(const ExecSpan& batch, GrouperMode mode) {
+    if (mode == GrouperMode::kPopulate) {
+      RETURN_NOT_OK(hash_grouper_->Populate(batch));
+      return Datum();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, mode == GrouperMode::kConsume
+                                              ? hash_grouper_->Consume(batch)
+                                              : hash_grouper_->Lookup(batch));
+    if (!hash_to_group_id_.empty()) {
+      // The group ids were freshly allocated by the hash grouper
+      auto& data = *group_ids.array();
+      uint32_t* ids = data.GetMutableValues<uint32_t>(1);
+      for (int64_t i = 0; i < data.length; ++i) {
+        if (ids[i] < hash_to_group_id_.size()) {
+          ids[i] = hash_to_group_id_[ids[i]];
+        }
+      }
+    }
+    return group_ids;
+  }
+
+  Result<ExecBatch> GetHashedUniques() {
+    ARROW_ASSIGN_OR_RAISE(auto uniques, hash_grouper_->GetUniques());
+    if (hash_to_group_id_.empty()) {
+      return uniques;
+    }
+    // Put the uniques back in our group id order
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(uniques.length * sizeof(uint32_t),
+                                         ctx_->memory_pool()));
+    auto indices = indices_buffer->mutable_data_as<uint32_t>();
+    for (uint32_t hash_id = 0; hash_id < uniques.length; ++hash_id) {
+      indices[hash_id < hash_to_group_id_.size() ? hash_to_group_id_[hash_id]
+                                                 : hash_id] = hash_id;
+    }
+    UInt32Array take_indices(uniques.length, std::move(indices_buffer));
+    ARROW_ASSIGN_OR_RAISE(uniques.values[0],
+                          Take(uniques.values[0], take_indices.data(),
+                               TakeOptions::NoBoundsCheck(), ctx_));
+    return uniques;
+  }
+
+  ExecContext* ctx_;
+  std::vector<TypeHolder> key_types_;
+  std::shared_ptr<DataType> key_type_;
+  Type::type physical_id_;
+  std::shared_ptr<Array> dictionary_;
+
+  // Group id of each key in [table_base_, table_base_ + table_.size())
+  std::vector<uint32_t> table_;
+  uint64_t table_base_ = 0;
+  // Key of each group (0 for the null group)
+  std::vector<uint64_t> keys_;
+  uint32_t null_group_id_ = kNoGroupId;
+
+  std::unique_ptr<Grouper> hash_grouper_;
+  // Our group id for each group the hash grouper took over, if they differ
+  std::vector<uint32_t> hash_to_group_id_;
+};
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<TypeHolder>& key_types,
                                                ExecContext* ctx) {
-  if (GrouperFastImpl::CanUse(key_types)) {
-    return GrouperFastImpl::Make(key_types, ctx);
+  if (DirectMapGrouper::CanUse(key_types)) {
+    return DirectMapGrouper::Make(key_types, ctx);
   }
-  return GrouperImpl::Make(key_types, ctx);
+  return MakeHashGrouper(key_types, ctx);
 }
 
 Result<std::shared_ptr<ListArray>> Grouper::ApplyGroupings(const ListArray& groupings,
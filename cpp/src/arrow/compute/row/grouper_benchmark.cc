@@ -24,6 +24,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
+#include "arrow/util/cpu_info.h"
 
 namespace arrow {
 namespace compute {
@@ -99,6 +100,50 @@ static void GrouperWithMultiTypes(benchmark::State& state, const DataTypeVector&
   GrouperBenchmark(state, exec_span, ctx);
 }
 
+// Single keys drawn from `num_distinct` values.  Booleans, small integer ranges and
+// dictionary indices are mapped to groups through a table indexed by value, while
+// wide integer ranges go through the hash table.
+static void GrouperWithSingleKey(benchmark::State& state,
+                                 const std::shared_ptr<DataType>& type,
+                                 int64_t num_distinct) {
+  auto ctx = default_exec_context();
+
+  RegressionArgs args(state, false);
+  const int64_t num_rows = args.size;
+
+  std::vector<std::string> keys = {"null_probability"};
+  std::vector<std::string> values = {internal::ToChars(args.null_proportion)};
+  if (type->id() == Type::DICTIONARY) {
+    keys.push_back("values");
+    values.push_back(internal::ToChars(num_distinct));
+  } else if (is_integer(type->id())) {
+    keys.insert(keys.end(), {"min", "max"});
+    values.insert(values.end(), {"0", internal::ToChars(num_distinct - 1)});
+  }
+  auto field = ::arrow::field("", type, key_value_metadata(keys, values));
+
+  random::RandomArrayGenerator rng(kSeed);
+  ExecBatch exec_batch({rng.ArrayOf(*field, num_rows, kDefaultBufferAlignment,
+                                    ctx->memory_pool())},
+                       num_rows);
+  GrouperBenchmark(state, ExecSpan(exec_batch), ctx);
+}
+
+// Hash table lookups and key comparisons dispatch to AVX-512 when available; this
+// runs the same workload with the AVX-512 feature flags masked off to compare the two.
+static void GrouperWithAvx512(benchmark::State& state, const DataTypeVector& types,
+                              bool enable_avx512) {
+  auto cpu_info = const_cast<internal::CpuInfo*>(internal::CpuInfo::GetInstance());
+  if (!cpu_info->IsDetected(internal::CpuInfo::AVX512)) {
+    state.SkipWithError("AVX-512 not available");
+    return;
+  }
+  const bool was_enabled = cpu_info->IsSupported(internal::CpuInfo::AVX512);
+  cpu_info->EnableFeature(internal::CpuInfo::AVX512, enable_avx512);
+  GrouperWithMultiTypes(state, types);
+  cpu_info->EnableFeature(internal::CpuInfo::AVX512, was_enabled);
+}
+
 void SetArgs(benchmark::internal::Benchmark* bench) {
   BenchmarkSetArgsWithSizes(bench, {1 << 10, 1 << 12});
 }
@@ -129,6 +174,30 @@ BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{fixed_size_binary(32)}",
                   {fixed_size_binary(32)})
     ->Apply(SetArgs);
 
+// single keys with few distinct values
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "boolean", boolean(), 2)->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "int8", int8(), 100)->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "int16", int16(), 1000)->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "int32/dense", int32(), 1000)->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "int64/dense", int64(), 1000)->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "int64/sparse", int64(), int64_t{1} << 40)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithSingleKey, "dictionary(int32, utf8)",
+                  dictionary(int32(), utf8()), 100)
+    ->Apply(SetArgs);
+
+// AVX-512 against AVX2
+BENCHMARK_CAPTURE(GrouperWithAvx512, "{int64, int32}/avx2", {int64(), int32()}, false)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithAvx512, "{int64, int32}/avx512", {int64(), int32()}, true)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithAvx512, "{int16, int32, int64}/avx2",
+                  {int16(), int32(), int64()}, false)
+    ->Apply(SetArgs);
+BENCHMARK_CAPTURE(GrouperWithAvx512, "{int16, int32, int64}/avx512",
+                  {int16(), int32(), int64()}, true)
+    ->Apply(SetArgs);
+
 // combination types
 BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{boolean, utf8}", {boolean(), utf8()})
     ->Apply(SetArgs);
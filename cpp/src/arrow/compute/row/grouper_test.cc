@@ -1109,6 +1109,43 @@ TEST(Grouper, RandomInt64Keys) {
   TestRandomLookup(TestGrouper({int64()}));
 }
 
+TEST(Grouper, RandomSmallIntKeys) {
+  for (auto ty : {int8(), uint8(), int16(), uint16()}) {
+    ARROW_SCOPED_TRACE("key type = ", *ty);
+    TestRandomConsume(TestGrouper({ty}));
+    TestRandomLookup(TestGrouper({ty}));
+  }
+}
+
+TEST(Grouper, IntKeysWideningRange) {
+  // Single integer keys are first mapped through a table indexed by value, which is
+  // replaced by a hash table once the range of values gets too wide.  The groups
+  // found until then must keep their ids.
+  for (auto ty : {int32(), uint32(), int64(), uint64()}) {
+    ARROW_SCOPED_TRACE("key type = ", *ty);
+    TestGrouper g({ty});
+    auto consume = [&](const std::string& key_json, const std::string& expected) {
+      ASSERT_OK_AND_ASSIGN(Datum ids, g.grouper_->Consume(ExecSpan(
+                                          ExecBatchFromJSON({ty}, key_json))));
+      AssertDatumsEqual(ArrayFromJSON(uint32(), expected), ids, /*verbose=*/true);
+    };
+
+    consume("[[3], [null], [5], [3]]", "[0, 1, 2, 0]");
+    consume("[[5], [1000000000], [null], [3]]", "[2, 3, 1, 0]");
+    consume("[[7], [3], [1000000000]]", "[4, 0, 3]");
+    g.ExpectUniques("[[3], [null], [5], [1000000000], [7]]");
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum ids,
+        g.grouper_->Lookup(ExecSpan(ExecBatchFromJSON({ty}, "[[7], [8], [null], [5]]"))));
+    AssertDatumsEqual(ArrayFromJSON(uint32(), "[4, null, 1, 2]"), ids, /*verbose=*/true);
+
+    ASSERT_OK(g.grouper_->Reset());
+    g.ExpectConsume("[[1000000000], [3], [1000000000]]", "[0, 1, 0]");
+    ASSERT_EQ(g.grouper_->num_groups(), 2);
+  }
+}
+
 TEST(Grouper, RandomStringKeys) {
   for (auto string_type : {utf8(), large_utf8()}) {
     ARROW_SCOPED_TRACE("string_type = ", *string_type);
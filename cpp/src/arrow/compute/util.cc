@@ -89,6 +89,17 @@ void bits_to_indexes_internal(int64_t hardware_flags, const int num_bits,
   // 64 bits at a time
   constexpr int unroll = 64;
   int tail = num_bits % unroll;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if ((hardware_flags & CpuInfo::AVX512) == CpuInfo::AVX512) {
+    if (filter_input_indexes) {
+      avx512::bits_filter_indexes_avx512(bit_to_search, num_bits - tail, bits,
+                                         input_indexes, num_indexes, indexes);
+    } else {
+      avx512::bits_to_indexes_avx512(bit_to_search, num_bits - tail, bits, num_indexes,
+                                     indexes, base_index);
+    }
+  } else
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2) && defined(ARROW_HAVE_RUNTIME_BMI2)
   if ((hardware_flags & CpuInfo::AVX2) && CpuInfo::GetInstance()->HasEfficientBmi2()) {
     if (filter_input_indexes) {
@@ -98,8 +109,9 @@ void bits_to_indexes_internal(int64_t hardware_flags, const int num_bits,
       avx2::bits_to_indexes_avx2(bit_to_search, num_bits - tail, bits, num_indexes,
                                  indexes, base_index);
     }
-  } else {
+  } else
 #endif
+  {
     *num_indexes = 0;
     for (int i = 0; i < num_bits / unroll; ++i) {
       uint64_t word = util::SafeLoad(&reinterpret_cast<const uint64_t*>(bits)[i]);
@@ -112,9 +124,7 @@ void bits_to_indexes_internal(int64_t hardware_flags, const int num_bits,
         bits_to_indexes_helper(word, i * 64 + base_index, num_indexes, indexes);
       }
     }
-#if defined(ARROW_HAVE_RUNTIME_AVX2) && defined(ARROW_HAVE_RUNTIME_BMI2)
   }
-#endif
   // Optionally process the last partial word with masking out bits outside range
   if (tail) {
     const uint8_t* bits_tail = bits + (num_bits - tail) / 8;
@@ -113,6 +113,21 @@ ARROW_EXPORT bool are_all_bytes_zero_avx2(const uint8_t* bytes, uint32_t num_byt
 
 #endif
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+// The functions below require AVX512F, AVX512VL and AVX512BW
+
+namespace avx512 {
+ARROW_EXPORT void bits_filter_indexes_avx512(int bit_to_search, const int num_bits,
+                                             const uint8_t* bits,
+                                             const uint16_t* input_indexes,
+                                             int* num_indexes, uint16_t* indexes);
+ARROW_EXPORT void bits_to_indexes_avx512(int bit_to_search, const int num_bits,
+                                         const uint8_t* bits, int* num_indexes,
+                                         uint16_t* indexes, uint16_t base_index = 0);
+}  // namespace avx512
+
+#endif
+
 }  // namespace bit_util
 }  // namespace util
 
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+
+namespace arrow::util::bit_util::avx512 {
+
+// Each 64-bit word of the input bit vector is processed as four 16-bit masks.  The
+// selected candidates (either consecutive row ids or input indexes) are packed with a
+// single compress instruction, so unlike the AVX2 version no BMI2 is needed and no
+// lookup table of byte sequences has to be built.
+template <int bit_to_search, bool filter_input_indexes>
+void bits_to_indexes_imp_avx512(const int num_bits, const uint8_t* bits,
+                                const uint16_t* input_indexes, int* num_indexes,
+                                uint16_t* indexes, uint16_t base_index = 0) {
+  // 64 bits at a time
+  constexpr int unroll = 64;
+
+  // The caller takes care of processing the remaining bits at the end outside of the
+  // multiples of 64
+  ARROW_DCHECK(num_bits % unroll == 0);
+
+  const __m512i sequence_0_to_15 =
+      _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  int num_indexes_total = 0;
+  for (int i = 0; i < num_bits / unroll; ++i) {
+    uint64_t word = reinterpret_cast<const uint64_t*>(bits)[i];
+    if (bit_to_search == 0) {
+      word = ~word;
+    }
+    for (int j = 0; j < unroll / 16 && word != 0; ++j, word >>= 16) {
+      auto mask = static_cast<__mmask16>(word & 0xffff);
+      if (mask == 0) {
+        continue;
+      }
+      __m512i candidates;
+      if (filter_input_indexes) {
+        candidates = _mm512_cvtepu16_epi32(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(input_indexes + i * unroll + j * 16)));
+      } else {
+        candidates = _mm512_add_epi32(
+            sequence_0_to_15, _mm512_set1_epi32(i * unroll + j * 16 + base_index));
+      }
+      __m256i selected =
+          _mm512_cvtepi32_epi16(_mm512_maskz_compress_epi32(mask, candidates));
+      int num_selected = arrow::bit_util::PopCount(static_cast<uint32_t>(mask));
+      // Masked store, so that nothing is written past the last selected index
+      _mm256_mask_storeu_epi16(indexes + num_indexes_total,
+                               static_cast<__mmask16>((1U << num_selected) - 1U),
+                               selected);
+      num_indexes_total += num_selected;
+    }
+  }
+  *num_indexes = num_indexes_total;
+}
+
+void bits_to_indexes_avx512(int bit_to_search, const int num_bits, const uint8_t* bits,
+                            int* num_indexes, uint16_t* indexes, uint16_t base_index) {
+  if (bit_to_search == 0) {
+    bits_to_indexes_imp_avx512<0, false>(num_bits, bits, nullptr, num_indexes, indexes,
+                                         base_index);
+  } else {
+    ARROW_DCHECK(bit_to_search == 1);
+    bits_to_indexes_imp_avx512<1, false>(num_bits, bits, nullptr, num_indexes, indexes,
+                                         base_index);
+  }
+}
+
+void bits_filter_indexes_avx512(int bit_to_search, const int num_bits,
+                                const uint8_t* bits, const uint16_t* input_indexes,
+                                int* num_indexes, uint16_t* indexes) {
+  if (bit_to_search == 0) {
+    bits_to_indexes_imp_avx512<0, true>(num_bits, bits, input_indexes, num_indexes,
+                                        indexes);
+  } else {
+    ARROW_DCHECK(bit_to_search == 1);
+    bits_to_indexes_imp_avx512<1, true>(num_bits, bits, input_indexes, num_indexes,
+                                        indexes);
+  }
+}
+
+}  // namespace arrow::util::bit_util::avx512
@@ -76,6 +76,12 @@ Future<std::optional<int64_t>> Fragment::CountRows(compute::Expression,
   return Future<std::optional<int64_t>>::MakeFinished(std::nullopt);
 }
 
+Future<std::optional<MetadataAggregation>> Fragment::AggregateMetadata(
+    const std::vector<MetadataAggregate>&, compute::Expression,
+    const std::shared_ptr<ScanOptions>&) {
+  return Future<std::optional<MetadataAggregation>>::MakeFinished(std::nullopt);
+}
+
 Status Fragment::ClearCachedMetadata() {
   auto lock = physical_schema_mutex_.Lock();
   physical_schema_.reset();
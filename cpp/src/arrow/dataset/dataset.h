@@ -145,6 +145,36 @@ struct ARROW_DS_EXPORT InspectedFragment {
   std::vector<std::string> column_names;
 };
 
+/// \brief An aggregate which a fragment may compute from its metadata
+struct ARROW_DS_EXPORT MetadataAggregate {
+  enum Kind {
+    /// The number of rows
+    kCountAll,
+    /// The number of non-null values of the target
+    kCountValid,
+    /// The number of null values of the target
+    kCountNull,
+    /// The minimum non-null value of the target, or null if there is none
+    kMin,
+    /// The maximum non-null value of the target, or null if there is none
+    kMax,
+  };
+
+  Kind kind;
+  /// The field to aggregate, ignored for kCountAll
+  FieldRef target;
+};
+
+/// \brief The aggregates of a fragment which were computed from its metadata
+struct ARROW_DS_EXPORT MetadataAggregation {
+  /// The partial aggregates, with a column per MetadataAggregate and a row per part of
+  /// the fragment (e.g. a Parquet row group) answered from metadata. Counts are int64,
+  /// minimums and maximums have the type of their target in the dataset schema.
+  std::shared_ptr<RecordBatch> partial_aggregates;
+  /// A fragment with the rows which must still be scanned, or null if there are none
+  std::shared_ptr<Fragment> remaining;
+};
+
 /// \brief A granular piece of a Dataset, such as an individual file.
 ///
 /// A Fragment can be read/scanned separately from other fragments. It yields a
@@ -190,6 +220,17 @@ class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
   virtual Future<std::optional<int64_t>> CountRows(
       compute::Expression predicate, const std::shared_ptr<ScanOptions>& options);
 
+  /// \brief Compute aggregates of the rows in this fragment matching the filter using
+  /// metadata only.
+  ///
+  /// The fragment may answer only part of its rows from metadata (e.g. the Parquet row
+  /// groups whose statistics are exact and which the filter includes entirely), and
+  /// return the other rows as a fragment to scan. If no rows can be answered from
+  /// metadata, resolve with an empty optional.
+  virtual Future<std::optional<MetadataAggregation>> AggregateMetadata(
+      const std::vector<MetadataAggregate>& aggregates, compute::Expression predicate,
+      const std::shared_ptr<ScanOptions>& options);
+
   /// \brief Clear any metadata that may have been cached by this object.
   ///
   /// A fragment may typically cache metadata to speed up repeated accesses.
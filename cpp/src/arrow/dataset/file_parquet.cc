@@ -24,6 +24,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_base.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -104,6 +105,8 @@ parquet::ReaderProperties MakeReaderProperties(
   properties.set_page_checksum_verification(
       parquet_scan_options->reader_properties->page_checksum_verification());
 
+  properties.set_lazy_metadata(parquet_scan_options->reader_properties->lazy_metadata());
+
   return properties;
 }
 
@@ -184,6 +187,57 @@ std::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
                                                              *statistics);
 }
 
+// Whether the Parquet statistics of a column of this type hold its exact minimum and
+// maximum. Floating point statistics ignore NaNs, and binary statistics may have
+// been truncated by the writer.
+bool HasExactMinMaxStatistics(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::BOOL || is_decimal(type.id()) ||
+         is_temporal(type.id());
+}
+
+// Compute the partial aggregates of a row group from its statistics, or return an
+// empty vector if they can't answer all of the aggregates.
+ScalarVector RowGroupStatisticsAggregates(
+    const std::vector<MetadataAggregate>& aggregates,
+    const std::vector<const SchemaField*>& schema_fields,
+    const std::vector<std::shared_ptr<DataType>>& types,
+    const parquet::RowGroupMetaData& metadata) {
+  ScalarVector partials(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    if (aggregates[i].kind == MetadataAggregate::kCountAll) {
+      partials[i] = std::make_shared<Int64Scalar>(metadata.num_rows());
+      continue;
+    }
+    auto statistics = metadata.ColumnChunk(schema_fields[i]->column_index)->statistics();
+    if (statistics == nullptr || !statistics->HasNullCount()) {
+      return {};
+    }
+    switch (aggregates[i].kind) {
+      case MetadataAggregate::kCountValid:
+        partials[i] = std::make_shared<Int64Scalar>(statistics->num_values());
+        break;
+      case MetadataAggregate::kCountNull:
+        partials[i] = std::make_shared<Int64Scalar>(statistics->null_count());
+        break;
+      default: {
+        if (!statistics->HasMinMax()) {
+          // Only a column chunk without non-null values has no minimum and maximum
+          if (statistics->num_values() > 0) return {};
+          partials[i] = MakeNullScalar(types[i]);
+          break;
+        }
+        std::shared_ptr<Scalar> min, max;
+        if (!StatisticsAsScalars(*statistics, &min, &max).ok()) return {};
+        auto maybe_value =
+            Cast(aggregates[i].kind == MetadataAggregate::kMin ? min : max, types[i]);
+        if (!maybe_value.ok()) return {};
+        partials[i] = maybe_value.MoveValueUnsafe().scalar();
+      }
+    }
+  }
+  return partials;
+}
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -994,6 +1048,104 @@ Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
   return metadata()->num_rows();
 }
 
+Result<std::optional<MetadataAggregation>> ParquetFileFragment::TryAggregateMetadata(
+    const std::vector<MetadataAggregate>& aggregates, compute::Expression predicate,
+    const Schema& dataset_schema) {
+  DCHECK_NE(metadata_, nullptr);
+  // Resolve the column of each aggregate, and the type of its partial aggregates
+  std::vector<const SchemaField*> schema_fields(aggregates.size(), nullptr);
+  std::vector<std::shared_ptr<DataType>> types(aggregates.size(), int64());
+  {
+    auto lock = physical_schema_mutex_.Lock();
+    for (size_t i = 0; i < aggregates.size(); ++i) {
+      const MetadataAggregate& aggregate = aggregates[i];
+      if (aggregate.kind == MetadataAggregate::kCountAll) continue;
+
+      ARROW_ASSIGN_OR_RAISE(auto match,
+                            aggregate.target.FindOneOrNone(*physical_schema_));
+      // Only the statistics of top-level leaf columns describe one value per row
+      if (match.indices().size() != 1) return std::nullopt;
+      const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+      if (!schema_field->is_leaf()) return std::nullopt;
+      schema_fields[i] = schema_field;
+
+      if (aggregate.kind == MetadataAggregate::kMin ||
+          aggregate.kind == MetadataAggregate::kMax) {
+        ARROW_ASSIGN_OR_RAISE(auto field, aggregate.target.GetOneOrNone(dataset_schema));
+        if (field == nullptr || !HasExactMinMaxStatistics(*field->type())) {
+          return std::nullopt;
+        }
+        types[i] = field->type();
+      }
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(std::move(predicate)));
+
+  std::vector<ScalarVector> partials(aggregates.size());
+  int64_t num_answered = 0;
+  std::vector<int> remaining;
+  DCHECK(expressions.empty() || (expressions.size() == row_groups_->size()));
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    // Row groups entirely excluded by the predicate don't contribute
+    if (!expressions[i].IsSatisfiable()) continue;
+    const int row_group = (*row_groups_)[i];
+    // Unless the row group is entirely included, it must be scanned
+    ScalarVector row_group_partials;
+    if (expressions[i] == compute::literal(true)) {
+      row_group_partials = RowGroupStatisticsAggregates(aggregates, schema_fields, types,
+                                                        *metadata_->RowGroup(row_group));
+    }
+    if (row_group_partials.empty()) {
+      remaining.push_back(row_group);
+      continue;
+    }
+    for (size_t j = 0; j < aggregates.size(); ++j) {
+      partials[j].push_back(std::move(row_group_partials[j]));
+    }
+    ++num_answered;
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  if (num_answered == 0 && !remaining.empty()) return std::nullopt;
+
+  MetadataAggregation aggregation;
+  FieldVector fields(aggregates.size());
+  ArrayVector columns(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    fields[i] = field(std::to_string(i), types[i]);
+    ARROW_ASSIGN_OR_RAISE(auto builder, MakeBuilder(types[i]));
+    RETURN_NOT_OK(builder->AppendScalars(partials[i]));
+    ARROW_ASSIGN_OR_RAISE(columns[i], builder->Finish());
+  }
+  aggregation.partial_aggregates =
+      RecordBatch::Make(schema(std::move(fields)), num_answered, std::move(columns));
+  if (!remaining.empty()) {
+    ARROW_ASSIGN_OR_RAISE(aggregation.remaining, Subset(std::move(remaining)));
+  }
+  return aggregation;
+}
+
+Future<std::optional<MetadataAggregation>> ParquetFileFragment::AggregateMetadata(
+    const std::vector<MetadataAggregate>& aggregates, compute::Expression predicate,
+    const std::shared_ptr<ScanOptions>& options) {
+  ARROW_ASSIGN_OR_RAISE(predicate, compute::SimplifyWithGuarantee(std::move(predicate),
+                                                                  partition_expression_));
+  if (metadata()) {
+    return Future<std::optional<MetadataAggregation>>::MakeFinished(
+        TryAggregateMetadata(aggregates, std::move(predicate), *options->dataset_schema));
+  }
+  auto self = checked_pointer_cast<ParquetFileFragment>(shared_from_this());
+  return DeferNotOk(options->io_context.executor()->Submit(
+      [self, aggregates, predicate,
+       options]() -> Result<std::optional<MetadataAggregation>> {
+        RETURN_NOT_OK(self->EnsureCompleteMetadata());
+        return self->TryAggregateMetadata(aggregates, predicate,
+                                          *options->dataset_schema);
+      }));
+}
+
 //
 // ParquetFragmentScanOptions
 //
@@ -175,6 +175,18 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
 
   Status ClearCachedMetadata() override;
 
+  /// \brief Answer aggregates from the statistics of the RowGroups.
+  ///
+  /// A RowGroup is answered from its statistics if the predicate is entirely
+  /// satisfied by it, and its statistics are exact for all aggregates. Minimums and
+  /// maximums are only answered for integer, boolean, decimal and temporal columns,
+  /// since the statistics of floating point and binary columns ignore NaNs or may be
+  /// truncated. The other RowGroups matching the predicate are returned as a subset
+  /// fragment.
+  Future<std::optional<MetadataAggregation>> AggregateMetadata(
+      const std::vector<MetadataAggregate>& aggregates, compute::Expression predicate,
+      const std::shared_ptr<ScanOptions>& options) override;
+
   /// \brief Return fragment which selects a filtered subset of this fragment's RowGroups.
   Result<std::shared_ptr<Fragment>> Subset(compute::Expression predicate);
   Result<std::shared_ptr<Fragment>> Subset(std::vector<int> row_group_ids);
@@ -210,6 +222,11 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
   Result<std::optional<int64_t>> TryCountRows(compute::Expression predicate);
+  /// Try to compute aggregates of the rows matching the predicate using
+  /// metadata. Same expectations as TryCountRows.
+  Result<std::optional<MetadataAggregation>> TryAggregateMetadata(
+      const std::vector<MetadataAggregate>& aggregates, compute::Expression predicate,
+      const Schema& dataset_schema);
 
   ParquetFileFormat& parquet_format_;
 
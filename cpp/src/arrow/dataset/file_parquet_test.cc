@@ -305,6 +305,107 @@ TEST_F(TestParquetFileFormat, CountRowsPredicatePushdown) {
   }
 }
 
+TEST_F(TestParquetFileFormat, AggregateMetadata) {
+  // One row group per batch
+  auto dataset_schema = schema({field("i64", int64()), field("f64", float64())});
+  auto null_batch = RecordBatchFromJSON(dataset_schema, R"([
+[null, 1.5],
+[null, 2.5],
+[null, null]
+])");
+  auto batch = RecordBatchFromJSON(dataset_schema, R"([
+[1, 0.5],
+[2, 3.5]
+])");
+  auto batch2 = RecordBatchFromJSON(dataset_schema, R"([
+[4, null],
+[4, 4.5]
+])");
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({null_batch, batch, batch2},
+                                                            dataset_schema));
+  auto source = GetFileSource(reader.get());
+  auto fragment = MakeFragment(*source);
+  auto options = std::make_shared<ScanOptions>();
+  options->dataset_schema = dataset_schema;
+
+  std::vector<MetadataAggregate> aggregates = {
+      {MetadataAggregate::kCountAll, FieldRef()},
+      {MetadataAggregate::kCountValid, FieldRef("i64")},
+      {MetadataAggregate::kCountNull, FieldRef("i64")},
+      {MetadataAggregate::kMin, FieldRef("i64")},
+      {MetadataAggregate::kMax, FieldRef("i64")},
+  };
+  auto partial_schema =
+      schema({field("0", int64()), field("1", int64()), field("2", int64()),
+              field("3", int64()), field("4", int64())});
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto aggregation,
+                                fragment->AggregateMetadata(aggregates, literal(true),
+                                                            options));
+  ASSERT_TRUE(aggregation.has_value());
+  AssertBatchesEqual(*RecordBatchFromJSON(partial_schema, R"([
+[3, 0, 3, null, null],
+[2, 2, 0, 1, 2],
+[2, 2, 0, 4, 4]
+])"),
+                     *aggregation->partial_aggregates);
+  ASSERT_EQ(aggregation->remaining, nullptr);
+
+  // The row group which the predicate only partially includes must be scanned
+  ASSERT_OK_AND_ASSIGN(auto predicate,
+                       greater_equal(field_ref("i64"), literal(2)).Bind(*dataset_schema));
+  ASSERT_FINISHES_OK_AND_ASSIGN(aggregation,
+                                fragment->AggregateMetadata(aggregates, predicate,
+                                                            options));
+  ASSERT_TRUE(aggregation.has_value());
+  AssertBatchesEqual(*RecordBatchFromJSON(partial_schema, R"([[2, 2, 0, 4, 4]])"),
+                     *aggregation->partial_aggregates);
+  ASSERT_NE(aggregation->remaining, nullptr);
+  const auto& remaining =
+      checked_cast<const ParquetFileFragment&>(*aggregation->remaining);
+  ASSERT_EQ(remaining.row_groups(), std::vector<int>{1});
+
+  // The statistics of floating point columns don't give exact minimums
+  ASSERT_FINISHES_OK_AND_EQ(
+      std::nullopt,
+      fragment->AggregateMetadata({{MetadataAggregate::kMin, FieldRef("f64")}},
+                                  literal(true), options));
+
+  // Scanner::Aggregate combines the aggregates from metadata with the scanned rows
+  auto dataset =
+      std::make_shared<FragmentDataset>(dataset_schema, FragmentVector{fragment});
+  for (bool pushdown : {true, false}) {
+    SCOPED_TRACE(pushdown);
+    ScannerBuilder builder(dataset);
+    ASSERT_OK(builder.Filter(greater_equal(field_ref("i64"), literal(2))));
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    std::vector<compute::Aggregate> scan_aggregates = {
+        {"count_all", "count"},
+        {"count",
+         std::make_shared<compute::CountOptions>(compute::CountOptions::ONLY_NULL),
+         FieldRef("f64"), "null_f64"},
+        {"min", FieldRef("i64"), "min_i64"},
+        {"max", FieldRef("i64"), "max_i64"},
+    };
+    if (!pushdown) {
+      // The mean can't be computed from partial aggregates
+      scan_aggregates.push_back({"mean", FieldRef("i64"), "mean_i64"});
+    }
+    ASSERT_OK_AND_ASSIGN(auto table, scanner->Aggregate(scan_aggregates));
+    auto expected = TableFromJSON(
+        schema({field("count", int64()), field("null_f64", int64()),
+                field("min_i64", int64()), field("max_i64", int64())}),
+        {R"([[3, 1, 2, 4]])"});
+    if (!pushdown) {
+      ASSERT_OK_AND_ASSIGN(
+          expected,
+          expected->AddColumn(4, field("mean_i64", float64()),
+                              ChunkedArrayFromJSON(float64(), {"[3.3333333333333335]"})));
+    }
+    AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST_F(TestParquetFileFormat, CachedMetadata) {
   // Create a test file
   auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
@@ -34,6 +34,7 @@
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/expression_internal.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/plan.h"
@@ -276,6 +277,10 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
   Result<std::shared_ptr<Table>> ToTable() override;
   Result<int64_t> CountRows() override;
   Future<int64_t> CountRowsAsync() override;
+  Result<std::shared_ptr<Table>> Aggregate(std::vector<compute::Aggregate> aggregates,
+                                           std::vector<FieldRef> keys) override;
+  Future<std::shared_ptr<Table>> AggregateAsync(
+      std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys) override;
   Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader() override;
   const std::shared_ptr<Dataset>& dataset() const override;
 
@@ -286,6 +291,9 @@ class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncSc
       Executor* executor, bool sequence_fragments, bool use_legacy_batching = false);
   Future<std::shared_ptr<Table>> ToTableAsync(Executor* executor);
   Future<int64_t> CountRowsAsync(Executor* executor);
+  Future<std::shared_ptr<Table>> AggregateAsync(
+      std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys,
+      Executor* executor);
 
   Result<FragmentGenerator> GetFragments() const;
 
@@ -792,6 +800,264 @@ Result<int64_t> AsyncScanner::CountRows() {
       scan_options_->use_threads);
 }
 
+// An aggregate computed by combining partial aggregates, which fragments may compute
+// from their metadata for groups of rows
+struct PartialAggregate {
+  // The partial aggregate of groups of rows
+  MetadataAggregate metadata_aggregate;
+  // The partial aggregate of a single scanned row
+  compute::Expression row_partial;
+  // The type of the partial aggregates
+  std::shared_ptr<DataType> type;
+  // Combines the partial aggregates into the result of the aggregate
+  compute::Aggregate combine;
+};
+
+std::optional<PartialAggregate> MakePartialAggregate(const compute::Aggregate& aggregate,
+                                                     const Schema& dataset_schema,
+                                                     const std::string& partial_name,
+                                                     bool grouped) {
+  std::string_view function = aggregate.function;
+  const std::string prefix = grouped ? "hash_" : "";
+  if (grouped) {
+    if (function.substr(0, prefix.size()) != prefix) return std::nullopt;
+    function.remove_prefix(prefix.size());
+  }
+
+  // Counts are combined by summing them, which must give 0 rather than null when
+  // there are no partial counts
+  auto combine_counts = [&]() {
+    return compute::Aggregate{
+        prefix + "sum",
+        std::make_shared<compute::ScalarAggregateOptions>(/*skip_nulls=*/true,
+                                                          /*min_count=*/0),
+        FieldRef(partial_name), aggregate.name};
+  };
+  auto count_all = [&]() {
+    return PartialAggregate{{MetadataAggregate::kCountAll, FieldRef()},
+                            compute::literal(int64_t{1}),
+                            int64(),
+                            combine_counts()};
+  };
+
+  if (function == "count_all") return count_all();
+  if (aggregate.target.size() != 1) return std::nullopt;
+  const FieldRef& target = aggregate.target[0];
+  auto maybe_field = target.GetOneOrNone(dataset_schema);
+  if (!maybe_field.ok() || *maybe_field == nullptr) return std::nullopt;
+  const std::shared_ptr<DataType>& type = (*maybe_field)->type();
+
+  if (function == "count") {
+    auto mode = aggregate.options
+                    ? checked_cast<const compute::CountOptions&>(*aggregate.options).mode
+                    : compute::CountOptions::ONLY_VALID;
+    auto count_if = [&](MetadataAggregate::Kind kind, std::string predicate) {
+      return PartialAggregate{
+          {kind, target},
+          compute::call("cast", {compute::call(predicate, {compute::field_ref(target)})},
+                        compute::CastOptions::Safe(int64())),
+          int64(),
+          combine_counts()};
+    };
+    switch (mode) {
+      case compute::CountOptions::ONLY_VALID:
+        return count_if(MetadataAggregate::kCountValid, "is_valid");
+      case compute::CountOptions::ONLY_NULL:
+        return count_if(MetadataAggregate::kCountNull, "is_null");
+      case compute::CountOptions::ALL:
+        return count_all();
+    }
+  }
+
+  if (function == "min" || function == "max") {
+    auto options = aggregate.options
+                       ? checked_cast<const compute::ScalarAggregateOptions&>(
+                             *aggregate.options)
+                       : compute::ScalarAggregateOptions::Defaults();
+    // The partial aggregates only keep track of non-null values
+    if (!options.skip_nulls || options.min_count > 1) return std::nullopt;
+    return PartialAggregate{
+        {function == "min" ? MetadataAggregate::kMin : MetadataAggregate::kMax, target},
+        compute::field_ref(target),
+        type,
+        compute::Aggregate{prefix + std::string(function), aggregate.options,
+                           FieldRef(partial_name), aggregate.name}};
+  }
+  return std::nullopt;
+}
+
+Future<std::shared_ptr<Table>> AsyncScanner::AggregateAsync(
+    std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys,
+    Executor* executor) {
+  compute::ExecContext exec_context(scan_options_->pool, executor);
+  const Schema& dataset_schema = *scan_options_->dataset_schema;
+
+  // Only materialize the aggregated fields and the keys
+  const auto options = std::make_shared<ScanOptions>(*scan_options_);
+  std::vector<compute::Expression> exprs;
+  std::vector<std::string> names;
+  for (const compute::Aggregate& aggregate : aggregates) {
+    for (const FieldRef& target : aggregate.target) {
+      exprs.push_back(compute::field_ref(target));
+      names.push_back(target.ToString());
+    }
+  }
+  for (const FieldRef& key : keys) {
+    exprs.push_back(compute::field_ref(key));
+    names.push_back(key.ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto projection, ProjectionDescr::FromExpressions(
+                                             std::move(exprs), names, dataset_schema));
+  SetProjection(options.get(), std::move(projection));
+
+  auto scan_and_filter = [options](std::shared_ptr<Dataset> dataset) {
+    return acero::Declaration::Sequence(
+        {{"scan", ScanNodeOptions{std::move(dataset), options}},
+         {"filter", acero::FilterNodeOptions{options->filter}}});
+  };
+
+  // Each aggregate must be computable from partial aggregates, and the keys must be
+  // top-level fields, to be answered from metadata
+  std::vector<PartialAggregate> partials;
+  FieldVector partial_fields;
+  for (const compute::Aggregate& aggregate : aggregates) {
+    std::string partial_name = std::to_string(partials.size());
+    auto partial = MakePartialAggregate(aggregate, dataset_schema, partial_name,
+                                        /*grouped=*/!keys.empty());
+    if (!partial) break;
+    partial_fields.push_back(field(std::move(partial_name), partial->type));
+    partials.push_back(std::move(*partial));
+  }
+  for (const FieldRef& key : keys) {
+    if (key.name() == nullptr || dataset_schema.GetFieldByName(*key.name()) == nullptr) {
+      break;
+    }
+    partial_fields.push_back(dataset_schema.GetFieldByName(*key.name()));
+  }
+  if (partials.size() != aggregates.size() ||
+      partial_fields.size() != partials.size() + keys.size()) {
+    acero::Declaration plan = scan_and_filter(dataset_);
+    plan = acero::Declaration::Sequence(
+        {std::move(plan),
+         {"aggregate", acero::AggregateNodeOptions{std::move(aggregates), keys}}});
+    return acero::DeclarationToTableAsync(std::move(plan), exec_context);
+  }
+
+  std::vector<MetadataAggregate> metadata_aggregates;
+  for (const PartialAggregate& partial : partials) {
+    metadata_aggregates.push_back(partial.metadata_aggregate);
+  }
+  auto partial_schema = schema(std::move(partial_fields));
+
+  ARROW_ASSIGN_OR_RAISE(auto fragment_gen, GetFragments());
+  auto fragments_fut = CollectAsyncGenerator(std::move(fragment_gen));
+
+  return fragments_fut
+      .Then([options, metadata_aggregates](const FragmentVector& fragments) {
+        std::vector<Future<std::optional<MetadataAggregation>>> aggregations;
+        for (const auto& fragment : fragments) {
+          aggregations.push_back(
+              fragment->AggregateMetadata(metadata_aggregates, options->filter, options));
+        }
+        return All(std::move(aggregations))
+            .Then([fragments](
+                      const std::vector<Result<std::optional<MetadataAggregation>>>&
+                          aggregations) {
+              return std::make_pair(fragments, aggregations);
+            });
+      })
+      .Then([=](const std::pair<FragmentVector,
+                                std::vector<Result<std::optional<MetadataAggregation>>>>&
+                    fragments_and_aggregations) -> Future<std::shared_ptr<Table>> {
+        const auto& [fragments, aggregations] = fragments_and_aggregations;
+        // The fragments, or parts of fragments, which must be scanned
+        FragmentVector remaining;
+        RecordBatchVector partial_batches;
+        for (size_t i = 0; i < fragments.size(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(auto aggregation, aggregations[i]);
+          if (!aggregation) {
+            remaining.push_back(fragments[i]);
+            continue;
+          }
+          // The keys of the rows answered from metadata are partition fields
+          ArrayVector columns = aggregation->partial_aggregates->columns();
+          const int64_t num_rows = aggregation->partial_aggregates->num_rows();
+          ARROW_ASSIGN_OR_RAISE(
+              auto known_values,
+              compute::ExtractKnownFieldValues(fragments[i]->partition_expression()));
+          for (const FieldRef& key : keys) {
+            auto it = known_values.map.find(key);
+            if (it == known_values.map.end() || !it->second.is_scalar()) break;
+            const auto& key_field =
+                partial_schema->field(static_cast<int>(columns.size()));
+            if (!it->second.type()->Equals(*key_field->type())) break;
+            ARROW_ASSIGN_OR_RAISE(auto column,
+                                  MakeArrayFromScalar(*it->second.scalar(), num_rows,
+                                                      options->pool));
+            columns.push_back(std::move(column));
+          }
+          if (columns.size() != static_cast<size_t>(partial_schema->num_fields())) {
+            remaining.push_back(fragments[i]);
+            continue;
+          }
+          partial_batches.push_back(
+              RecordBatch::Make(partial_schema, num_rows, std::move(columns)));
+          if (aggregation->remaining) {
+            remaining.push_back(std::move(aggregation->remaining));
+          }
+        }
+
+        // Scan the remaining rows into partial aggregates, and combine them with the
+        // partial aggregates from metadata
+        std::vector<compute::Expression> row_partials;
+        std::vector<std::string> partial_names;
+        std::vector<compute::Aggregate> combine;
+        for (int i = 0; i < partial_schema->num_fields(); ++i) {
+          partial_names.push_back(partial_schema->field(i)->name());
+        }
+        for (const PartialAggregate& partial : partials) {
+          row_partials.push_back(partial.row_partial);
+          combine.push_back(partial.combine);
+        }
+        for (const FieldRef& key : keys) {
+          row_partials.push_back(compute::field_ref(key));
+        }
+        acero::Declaration scanned = acero::Declaration::Sequence(
+            {scan_and_filter(std::make_shared<FragmentDataset>(
+                 options->dataset_schema, std::move(remaining))),
+             {"project", acero::ProjectNodeOptions{std::move(row_partials),
+                                                   std::move(partial_names)}}});
+        ARROW_ASSIGN_OR_RAISE(
+            auto from_metadata,
+            Table::FromRecordBatches(partial_schema, std::move(partial_batches)));
+        acero::Declaration plan{
+            "union",
+            {std::move(scanned),
+             acero::Declaration{"table_source",
+                                acero::TableSourceNodeOptions{std::move(from_metadata)}}},
+            acero::ExecNodeOptions{}};
+        plan = acero::Declaration::Sequence(
+            {std::move(plan),
+             {"aggregate", acero::AggregateNodeOptions{std::move(combine), keys}}});
+        return acero::DeclarationToTableAsync(std::move(plan), exec_context);
+      });
+}
+
+Future<std::shared_ptr<Table>> AsyncScanner::AggregateAsync(
+    std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys) {
+  return AggregateAsync(std::move(aggregates), std::move(keys),
+                        ::arrow::internal::GetCpuThreadPool());
+}
+
+Result<std::shared_ptr<Table>> AsyncScanner::Aggregate(
+    std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys) {
+  return ::arrow::internal::RunSynchronously<Future<std::shared_ptr<Table>>>(
+      [&](Executor* executor) {
+        return AggregateAsync(std::move(aggregates), std::move(keys), executor);
+      },
+      scan_options_->use_threads);
+}
+
 Result<std::shared_ptr<RecordBatchReader>> AsyncScanner::ToRecordBatchReader() {
   ARROW_ASSIGN_OR_RAISE(auto it, ScanBatches());
   return std::make_shared<ScannerRecordBatchReader>(options()->projected_schema,
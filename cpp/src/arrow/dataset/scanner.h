@@ -442,6 +442,17 @@ class ARROW_DS_EXPORT Scanner {
   /// metadata if possible.
   virtual Result<int64_t> CountRows() = 0;
   virtual Future<int64_t> CountRowsAsync() = 0;
+  /// \brief Compute aggregates over the rows matching the filter.
+  ///
+  /// This is equivalent to aggregating the filtered rows with an "aggregate" node,
+  /// but "count_all", "count", "min" and "max" aggregates (or their "hash_" versions
+  /// when grouping by keys) are computed from fragment metadata where possible (see
+  /// Fragment::AggregateMetadata), so that only the other rows are decoded. Grouped
+  /// aggregates are only computed from metadata when the keys are partition fields.
+  virtual Result<std::shared_ptr<Table>> Aggregate(
+      std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys = {}) = 0;
+  virtual Future<std::shared_ptr<Table>> AggregateAsync(
+      std::vector<compute::Aggregate> aggregates, std::vector<FieldRef> keys = {}) = 0;
   /// \brief Convert the Scanner to a RecordBatchReader so it can be
   /// easily used with APIs that expect a reader.
   virtual Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader() = 0;
@@ -99,6 +99,21 @@ bool EqualBinaryView(BinaryViewType::c_type l, BinaryViewType::c_type r,
                 l.size() - BinaryViewType::kPrefixSize) == 0;
 }
 
+/// \brief Three-way comparison of the values of two binary views
+///
+/// The inline prefixes are compared first, which decides most comparisons of
+/// differing values without dereferencing the data buffers.  This relies on
+/// the padding of inline views shorter than the prefix being zeroed, so that
+/// they compare before longer values starting with the same bytes.
+template <typename BufferPtr>
+int CompareBinaryView(const BinaryViewType::c_type& l, const BinaryViewType::c_type& r,
+                      const BufferPtr* l_buffers, const BufferPtr* r_buffers) {
+  const int prefix_cmp =
+      memcmp(l.inline_data(), r.inline_data(), BinaryViewType::kPrefixSize);
+  if (prefix_cmp != 0) return prefix_cmp;
+  return FromBinaryView(l, l_buffers).compare(FromBinaryView(r, r_buffers));
+}
+
 /// \brief Compute the total size of a list of binary views including null
 /// views.
 ///
@@ -97,6 +97,24 @@ class LruCache {
     }
   }
 
+  // Remove all items whose value satisfies the predicate, return how many were removed
+  template <typename Predicate>
+  int32_t EraseIf(Predicate&& pred) {
+    int32_t num_erased = 0;
+    for (auto list_it = items_.begin(); list_it != items_.end();) {
+      if (pred(static_cast<const Value&>(list_it->value))) {
+        const bool erased = map_.erase(*list_it->key);
+        ARROW_DCHECK(erased);
+        ARROW_UNUSED(erased);
+        list_it = items_.erase(list_it);
+        ++num_erased;
+      } else {
+        ++list_it;
+      }
+    }
+    return num_erased;
+  }
+
  private:
   struct Item {
     // Pointer to the key inside the unordered_map
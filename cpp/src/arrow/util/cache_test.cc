@@ -173,6 +173,36 @@ TEST_F(TestLruCache, Eviction) {
   ASSERT_EQ(Find(102), nullptr);
 }
 
+TEST_F(TestLruCache, EraseIf) {
+  Cache cache(5);
+
+  using namespace std::placeholders;  // NOLINT [build/namespaces]
+  auto Replace = std::bind(&TestLruCache::Replace, this, &cache, _1, _2);
+  auto Find = std::bind(&TestLruCache::Find, this, &cache, _1);
+
+  for (int i = 100; i < 105; ++i) {
+    ASSERT_TRUE(Replace(i, i));
+  }
+  auto is_odd = [](const V& value) { return value.value() % 2 != 0; };
+  ASSERT_EQ(cache.EraseIf(is_odd), 2);
+  ASSERT_EQ(cache.size(), 3);
+  ASSERT_EQ(Find(101), nullptr);
+  ASSERT_EQ(Find(103), nullptr);
+  ASSERT_EQ(cache.EraseIf(is_odd), 0);
+
+  // The freed slots are reused before evicting anything
+  // MRU = [104, 102, 100]
+  ASSERT_TRUE(Replace(105, 105));
+  ASSERT_TRUE(Replace(106, 106));
+  for (int i : {100, 102, 104, 105, 106}) {
+    ASSERT_EQ(*Find(i), V{i});
+  }
+  // MRU = [106, 105, 104, 102, 100]
+  ASSERT_TRUE(Replace(107, 107));
+  ASSERT_EQ(Find(100), nullptr);
+  ASSERT_EQ(cache.size(), 5);
+}
+
 struct Callable {
   std::atomic<int> num_calls{0};
 
@@ -29,6 +29,7 @@
 #include <string>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/decimal_internal.h"
 #include "arrow/util/endian.h"
@@ -783,8 +784,18 @@ inline bool StartsExponent(char c) { return c == 'e' || c == 'E'; }
 
 inline size_t ParseDigitsRun(const char* s, size_t start, size_t size,
                              std::string_view* out) {
-  size_t pos;
-  for (pos = start; pos < size; ++pos) {
+  size_t pos = start;
+  // Skip digits eight at a time, the lowest non-digit byte gives the end of the run
+  for (; pos + 8 <= size; pos += 8) {
+    const uint64_t non_digits =
+        internal::detail::NonDigitMask(internal::detail::LoadEightChars(s + pos));
+    if (non_digits != 0) {
+      pos += bit_util::CountTrailingZeros(non_digits) / 8;
+      *out = std::string_view(s + start, pos - start);
+      return pos;
+    }
+  }
+  for (; pos < size; ++pos) {
     if (!IsDigit(s[pos])) {
       break;
     }
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/util/delta_prefix_sum_internal.h"
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#  include "arrow/util/delta_prefix_sum_avx2.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <typename U>
+void DeltaPrefixSumDefault(U* values, int64_t length, U min_delta, U* last_value) {
+  U value = *last_value;
+  for (int64_t i = 0; i < length; ++i) {
+    value += min_delta + values[i];
+    values[i] = value;
+  }
+  *last_value = value;
+}
+
+struct DeltaPrefixSum32DynamicFunction {
+  using FunctionType = decltype(&DeltaPrefixSum32);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, DeltaPrefixSumDefault<uint32_t>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, DeltaPrefixSum32Avx2}
+#endif
+    };
+  }
+};
+
+struct DeltaPrefixSum64DynamicFunction {
+  using FunctionType = decltype(&DeltaPrefixSum64);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, DeltaPrefixSumDefault<uint64_t>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, DeltaPrefixSum64Avx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+void DeltaPrefixSum32(uint32_t* values, int64_t length, uint32_t min_delta,
+                      uint32_t* last_value) {
+  static DynamicDispatch<DeltaPrefixSum32DynamicFunction> dispatch;
+  dispatch.func(values, length, min_delta, last_value);
+}
+
+void DeltaPrefixSum64(uint64_t* values, int64_t length, uint64_t min_delta,
+                      uint64_t* last_value) {
+  static DynamicDispatch<DeltaPrefixSum64DynamicFunction> dispatch;
+  dispatch.func(values, length, min_delta, last_value);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/util/delta_prefix_sum_avx2.h"
+
+#include <immintrin.h>
+
+namespace arrow {
+namespace internal {
+
+// Each iteration scans one register: the in-lane running sums are built with
+// byte shifts, then the sum of the low 128-bit lane is carried into the high
+// one, and finally the last value of the previous register is added.
+
+void DeltaPrefixSum32Avx2(uint32_t* values, int64_t length, uint32_t min_delta,
+                          uint32_t* last_value) {
+  const __m256i min_deltas = _mm256_set1_epi32(static_cast<int32_t>(min_delta));
+  __m256i carry = _mm256_set1_epi32(static_cast<int32_t>(*last_value));
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    auto* out = reinterpret_cast<__m256i*>(values + i);
+    __m256i sums = _mm256_add_epi32(_mm256_loadu_si256(out), min_deltas);
+    sums = _mm256_add_epi32(sums, _mm256_slli_si256(sums, 4));
+    sums = _mm256_add_epi32(sums, _mm256_slli_si256(sums, 8));
+    const __m256i low_sum = _mm256_shuffle_epi32(sums, 0xFF);
+    sums = _mm256_add_epi32(sums, _mm256_permute2x128_si256(low_sum, low_sum, 0x08));
+    sums = _mm256_add_epi32(sums, carry);
+    _mm256_storeu_si256(out, sums);
+    carry = _mm256_permutevar8x32_epi32(sums, _mm256_set1_epi32(7));
+  }
+  uint32_t value = i > 0 ? values[i - 1] : *last_value;
+  for (; i < length; ++i) {
+    value += min_delta + values[i];
+    values[i] = value;
+  }
+  *last_value = value;
+}
+
+void DeltaPrefixSum64Avx2(uint64_t* values, int64_t length, uint64_t min_delta,
+                          uint64_t* last_value) {
+  const __m256i min_deltas = _mm256_set1_epi64x(static_cast<int64_t>(min_delta));
+  __m256i carry = _mm256_set1_epi64x(static_cast<int64_t>(*last_value));
+  int64_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    auto* out = reinterpret_cast<__m256i*>(values + i);
+    __m256i sums = _mm256_add_epi64(_mm256_loadu_si256(out), min_deltas);
+    sums = _mm256_add_epi64(sums, _mm256_slli_si256(sums, 8));
+    const __m256i low_sum = _mm256_permute4x64_epi64(sums, 0x55);
+    sums = _mm256_add_epi64(
+        sums, _mm256_blend_epi32(_mm256_setzero_si256(), low_sum, 0xF0));
+    sums = _mm256_add_epi64(sums, carry);
+    _mm256_storeu_si256(out, sums);
+    carry = _mm256_permute4x64_epi64(sums, 0xFF);
+  }
+  uint64_t value = i > 0 ? values[i - 1] : *last_value;
+  for (; i < length; ++i) {
+    value += min_delta + values[i];
+    values[i] = value;
+  }
+  *last_value = value;
+}
+
+}  // namespace internal
+}  // namespace arrow
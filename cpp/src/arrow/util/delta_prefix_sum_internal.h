@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Decode 4-byte deltas in place, such that
+/// `values[i] = values[i - 1] + min_delta + values[i]`
+///
+/// The value before the first one is read from `*last_value`, which is then
+/// updated to the last decoded value. Arithmetic wraps around.
+ARROW_EXPORT
+void DeltaPrefixSum32(uint32_t* values, int64_t length, uint32_t min_delta,
+                      uint32_t* last_value);
+
+/// \brief Like DeltaPrefixSum32, for 8-byte deltas
+ARROW_EXPORT
+void DeltaPrefixSum64(uint64_t* values, int64_t length, uint64_t min_delta,
+                      uint64_t* last_value);
+
+/// \brief Decode deltas in place, such that
+/// `values[i] = values[i - 1] + min_delta + values[i]`
+///
+/// The value before the first one is read from `*last_value`, which is then
+/// updated to the last decoded value. Arithmetic wraps around, as for unsigned
+/// integers. The running sums are computed with SIMD scans where the CPU
+/// supports them.
+template <typename T>
+void DeltaPrefixSum(T* values, int64_t length, T min_delta, T* last_value) {
+  static_assert(std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8),
+                "DeltaPrefixSum requires 4- or 8-byte integers");
+  using U = std::make_unsigned_t<T>;
+  if constexpr (sizeof(T) == 4) {
+    DeltaPrefixSum32(reinterpret_cast<U*>(values), length, static_cast<U>(min_delta),
+                     reinterpret_cast<U*>(last_value));
+  } else {
+    DeltaPrefixSum64(reinterpret_cast<U*>(values), length, static_cast<U>(min_delta),
+                     reinterpret_cast<U*>(last_value));
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/delta_prefix_sum_internal.h"
+
+namespace arrow {
+namespace internal {
+
+template <typename T>
+class TestDeltaPrefixSum : public ::testing::Test {};
+
+using DeltaPrefixSumTypes = ::testing::Types<int32_t, int64_t>;
+TYPED_TEST_SUITE(TestDeltaPrefixSum, DeltaPrefixSumTypes);
+
+TYPED_TEST(TestDeltaPrefixSum, MatchesScalar) {
+  using T = TypeParam;
+  using U = std::make_unsigned_t<T>;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<U> dist;
+
+  // Cover lengths around the SIMD register widths, and values which wrap around
+  for (int64_t length = 0; length <= 70; ++length) {
+    std::vector<T> values(length);
+    for (auto& value : values) {
+      value = static_cast<T>(dist(gen));
+    }
+    const T min_delta = static_cast<T>(dist(gen));
+    const T first_value = static_cast<T>(dist(gen));
+
+    std::vector<T> expected(length);
+    U previous = static_cast<U>(first_value);
+    for (int64_t i = 0; i < length; ++i) {
+      previous += static_cast<U>(min_delta) + static_cast<U>(values[i]);
+      expected[i] = static_cast<T>(previous);
+    }
+
+    T last_value = first_value;
+    DeltaPrefixSum(values.data(), length, min_delta, &last_value);
+    ASSERT_EQ(values, expected) << "length = " << length;
+    ASSERT_EQ(last_value, static_cast<T>(previous)) << "length = " << length;
+  }
+}
+
+TYPED_TEST(TestDeltaPrefixSum, NegativeMinDelta) {
+  using T = TypeParam;
+  std::vector<T> values = {0, 1, 0, 2, 0, 0, 0, 3, 0, 1};
+  T last_value = 100;
+  DeltaPrefixSum(values.data(), static_cast<int64_t>(values.size()), T{-2}, &last_value);
+  std::vector<T> expected = {98, 97, 95, 95, 93, 91, 89, 90, 88, 87};
+  ASSERT_EQ(values, expected);
+  ASSERT_EQ(last_value, 87);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/dict_gather_internal.h"
+
+#include <utility>
+#include <vector>
+
+#include "arrow/util/dispatch.h"
+#include "arrow/util/ubsan.h"
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#  include "arrow/util/dict_gather_avx2.h"
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+template <typename Word>
+bool GatherDictionaryValuesDefault(const int32_t* indices, int64_t length,
+                                   const void* dictionary, int32_t dictionary_length,
+                                   void* out) {
+  // Check all indices upfront, so that the lookup loop has no branches.
+  // Negative indices compare greater than any dictionary length as unsigned.
+  uint32_t max_index = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    max_index = std::max(max_index, static_cast<uint32_t>(indices[i]));
+  }
+  if (length > 0 && max_index >= static_cast<uint32_t>(dictionary_length)) {
+    return false;
+  }
+  const auto* dictionary_bytes = static_cast<const uint8_t*>(dictionary);
+  auto* out_bytes = static_cast<uint8_t*>(out);
+  for (int64_t i = 0; i < length; ++i) {
+    util::SafeStore(out_bytes + i * sizeof(Word),
+                    util::SafeLoadAs<Word>(dictionary_bytes + indices[i] * sizeof(Word)));
+  }
+  return true;
+}
+
+struct Gather32DynamicFunction {
+  using FunctionType = decltype(&GatherDictionaryValues32);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, GatherDictionaryValuesDefault<uint32_t>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, GatherDictionaryValues32Avx2}
+#endif
+    };
+  }
+};
+
+struct Gather64DynamicFunction {
+  using FunctionType = decltype(&GatherDictionaryValues64);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, GatherDictionaryValuesDefault<uint64_t>}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, GatherDictionaryValues64Avx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+bool GatherDictionaryValues32(const int32_t* indices, int64_t length,
+                              const void* dictionary, int32_t dictionary_length,
+                              void* out) {
+  static DynamicDispatch<Gather32DynamicFunction> dispatch;
+  return dispatch.func(indices, length, dictionary, dictionary_length, out);
+}
+
+bool GatherDictionaryValues64(const int32_t* indices, int64_t length,
+                              const void* dictionary, int32_t dictionary_length,
+                              void* out) {
+  static DynamicDispatch<Gather64DynamicFunction> dispatch;
+  return dispatch.func(indices, length, dictionary, dictionary_length, out);
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/dict_gather_avx2.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Returns whether all indices are in [0, dictionary_length). Negative indices
+// compare greater than any dictionary length as unsigned.
+bool IndicesInBounds(const int32_t* indices, int64_t length, int32_t dictionary_length) {
+  if (length == 0) {
+    return true;
+  }
+  __m256i max_index = _mm256_setzero_si256();
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const __m256i index =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+    max_index = _mm256_max_epu32(max_index, index);
+  }
+  uint32_t lanes[8];
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), max_index);
+  uint32_t result = *std::max_element(lanes, lanes + 8);
+  for (; i < length; ++i) {
+    result = std::max(result, static_cast<uint32_t>(indices[i]));
+  }
+  return result < static_cast<uint32_t>(dictionary_length);
+}
+
+}  // namespace
+
+bool GatherDictionaryValues32Avx2(const int32_t* indices, int64_t length,
+                                  const void* dictionary, int32_t dictionary_length,
+                                  void* out) {
+  if (!IndicesInBounds(indices, length, dictionary_length)) {
+    return false;
+  }
+  const auto* dict = static_cast<const int32_t*>(dictionary);
+  auto* out_values = static_cast<int32_t*>(out);
+  int64_t i = 0;
+  if (dictionary_length <= 8) {
+    // The whole dictionary fits in a register: permute instead of gathering
+    int32_t padded_dict[8] = {};
+    std::memcpy(padded_dict, dict, dictionary_length * sizeof(int32_t));
+    const __m256i dict_values =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(padded_dict));
+    for (; i + 8 <= length; i += 8) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_values + i),
+                          _mm256_permutevar8x32_epi32(dict_values, index));
+    }
+  } else {
+    for (; i + 8 <= length; i += 8) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_values + i),
+                          _mm256_i32gather_epi32(dict, index, 4));
+    }
+  }
+  for (; i < length; ++i) {
+    std::memcpy(out_values + i, dict + indices[i], sizeof(int32_t));
+  }
+  return true;
+}
+
+bool GatherDictionaryValues64Avx2(const int32_t* indices, int64_t length,
+                                  const void* dictionary, int32_t dictionary_length,
+                                  void* out) {
+  if (!IndicesInBounds(indices, length, dictionary_length)) {
+    return false;
+  }
+  const auto* dict = static_cast<const long long*>(dictionary);  // NOLINT
+  auto* out_values = static_cast<int64_t*>(out);
+  int64_t i = 0;
+  if (dictionary_length <= 4) {
+    // The whole dictionary fits in a register: permute its 32-bit halves
+    // (2 * index and 2 * index + 1) instead of gathering
+    int64_t padded_dict[4] = {};
+    std::memcpy(padded_dict, dict, dictionary_length * sizeof(int64_t));
+    const __m256i dict_values =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(padded_dict));
+    const __m256i one = _mm256_set1_epi64x(1);
+    for (; i + 4 <= length; i += 4) {
+      const __m256i index = _mm256_cvtepu32_epi64(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i)));
+      const __m256i low_half = _mm256_slli_epi64(index, 1);
+      const __m256i high_half = _mm256_add_epi64(low_half, one);
+      const __m256i permutation =
+          _mm256_or_si256(low_half, _mm256_slli_epi64(high_half, 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_values + i),
+                          _mm256_permutevar8x32_epi32(dict_values, permutation));
+    }
+  } else {
+    for (; i + 4 <= length; i += 4) {
+      const __m128i index =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out_values + i),
+                          _mm256_i32gather_epi64(dict, index, 8));
+    }
+  }
+  for (; i < length; ++i) {
+    std::memcpy(out_values + i, dict + indices[i], sizeof(int64_t));
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace arrow
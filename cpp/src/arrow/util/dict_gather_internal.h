@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Look up `out[i] = dictionary[indices[i]]` for `length` indices of
+/// 4-byte dictionary values
+///
+/// All indices are checked against `dictionary_length` before any value is
+/// looked up. Returns false if an index is out of bounds, in which case
+/// nothing is written to `out`.
+ARROW_EXPORT
+bool GatherDictionaryValues32(const int32_t* indices, int64_t length,
+                              const void* dictionary, int32_t dictionary_length,
+                              void* out);
+
+/// \brief Like GatherDictionaryValues32, for 8-byte dictionary values
+ARROW_EXPORT
+bool GatherDictionaryValues64(const int32_t* indices, int64_t length,
+                              const void* dictionary, int32_t dictionary_length,
+                              void* out);
+
+/// \brief Look up `out[i] = dictionary[indices[i]]` for `length` indices
+///
+/// Values of 4 or 8 bytes are looked up with SIMD gathers where the CPU
+/// supports them. Returns false if an index is out of bounds, in which case
+/// nothing is written to `out`.
+template <typename T>
+bool GatherDictionaryValues(const int32_t* indices, int64_t length, const T* dictionary,
+                            int32_t dictionary_length, T* out) {
+  if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) == 4) {
+    return GatherDictionaryValues32(indices, length, dictionary, dictionary_length, out);
+  } else if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) == 8) {
+    return GatherDictionaryValues64(indices, length, dictionary, dictionary_length, out);
+  } else {
+    // Negative indices compare greater than any dictionary length as unsigned
+    uint32_t max_index = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      max_index = std::max(max_index, static_cast<uint32_t>(indices[i]));
+    }
+    if (length > 0 && max_index >= static_cast<uint32_t>(dictionary_length)) {
+      return false;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = dictionary[indices[i]];
+    }
+    return true;
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
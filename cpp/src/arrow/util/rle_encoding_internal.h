@@ -29,6 +29,7 @@
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils_internal.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dict_gather_internal.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -532,9 +533,11 @@ struct DictionaryConverter {
   inline void FillZero(T* begin, T* end) { std::fill(begin, end, kZero); }
 
   inline void Copy(T* out, const int32_t* values, int length) const {
-    for (int x = 0; x < length; x++) {
-      out[x] = dictionary[values[x]];
-    }
+    // The indices are validated by IsValid() already
+    const bool in_bounds = ::arrow::internal::GatherDictionaryValues(
+        values, length, dictionary, dictionary_length, out);
+    ARROW_DCHECK(in_bounds);
+    ARROW_UNUSED(in_bounds);
   }
 };
 
@@ -544,9 +547,6 @@ inline int RleDecoder::GetBatchWithDict(const T* dictionary, int32_t dictionary_
   // Per https://github.com/apache/parquet-format/blob/master/Encodings.md,
   // the maximum dictionary index width in Parquet is 32 bits.
   using IndexType = int32_t;
-  DictionaryConverter<T> converter;
-  converter.dictionary = dictionary;
-  converter.dictionary_length = dictionary_length;
 
   ARROW_DCHECK_GE(bit_width_, 0);
   int values_read = 0;
@@ -581,10 +581,12 @@ inline int RleDecoder::GetBatchWithDict(const T* dictionary, int32_t dictionary_
       if (ARROW_PREDICT_FALSE(actual_read != literal_batch)) {
         return values_read;
       }
-      if (ARROW_PREDICT_FALSE(!converter.IsValid(indices, /*length=*/literal_batch))) {
+      // Checks the indices and looks up the values in one go, with SIMD gathers
+      // where available
+      if (ARROW_PREDICT_FALSE(!::arrow::internal::GatherDictionaryValues(
+              indices, literal_batch, dictionary, dictionary_length, out))) {
         return values_read;
       }
-      converter.Copy(out, indices, literal_batch);
 
       /* Upkeep counters */
       literal_count_ -= literal_batch;
@@ -30,6 +30,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils_internal.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dict_gather_internal.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/rle_encoding_internal.h"
 
@@ -617,5 +618,90 @@ TEST(RleDecoder, GetBatchSpaced) {
   }
 }
 
+template <typename T>
+void CheckGetBatchWithDict(int32_t dictionary_length) {
+  ARROW_SCOPED_TRACE("dictionary_length = ", dictionary_length);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int32_t> index_dist(0, dictionary_length - 1);
+
+  std::vector<T> dictionary(dictionary_length);
+  for (int32_t i = 0; i < dictionary_length; ++i) {
+    dictionary[i] = static_cast<T>(i * 3 + 1);
+  }
+  // Literal runs of random indices, with repeated runs in between
+  std::vector<int32_t> indices;
+  for (int run = 0; run < 20; ++run) {
+    for (int i = 0; i < 100 + run; ++i) {
+      indices.push_back(index_dist(gen));
+    }
+    indices.insert(indices.end(), 50, index_dist(gen));
+  }
+  const int num_values = static_cast<int>(indices.size());
+  const int bit_width = bit_util::NumRequiredBits(dictionary_length);
+
+  auto Decode = [&](int* num_decoded) {
+    int buffer_size = RleEncoder::MaxBufferSize(bit_width, num_values);
+    std::vector<uint8_t> buffer(buffer_size);
+    RleEncoder encoder(buffer.data(), buffer_size, bit_width);
+    for (int32_t index : indices) {
+      ASSERT_TRUE(encoder.Put(static_cast<uint64_t>(index)));
+    }
+    int encoded_size = encoder.Flush();
+
+    RleDecoder decoder(buffer.data(), encoded_size, bit_width);
+    std::vector<T> values(num_values);
+    *num_decoded = decoder.GetBatchWithDict(dictionary.data(), dictionary_length,
+                                            values.data(), num_values);
+    for (int i = 0; i < *num_decoded; ++i) {
+      ASSERT_EQ(values[i], dictionary[indices[i]]) << "at index " << i;
+    }
+  };
+  int num_decoded;
+  ASSERT_NO_FATAL_FAILURE(Decode(&num_decoded));
+  ASSERT_EQ(num_decoded, num_values);
+
+  // Decoding stops before the literal run with an out of bounds index, which
+  // follows the first repeated run
+  indices[155] = dictionary_length;
+  ASSERT_NO_FATAL_FAILURE(Decode(&num_decoded));
+  ASSERT_GE(num_decoded, 100);
+  ASSERT_LE(num_decoded, 155);
+}
+
+TEST(RleDecoder, GetBatchWithDict) {
+  for (int32_t dictionary_length : {3, 4, 8, 9, 100, 5000}) {
+    CheckGetBatchWithDict<int32_t>(dictionary_length);
+    CheckGetBatchWithDict<int64_t>(dictionary_length);
+    CheckGetBatchWithDict<float>(dictionary_length);
+    CheckGetBatchWithDict<double>(dictionary_length);
+  }
+}
+
+TEST(GatherDictionaryValues, OutOfBounds) {
+  using ::arrow::internal::GatherDictionaryValues;
+
+  const std::vector<int64_t> dictionary = {10, 20, 30};
+  std::vector<int32_t> indices(37, 2);
+  std::vector<int64_t> out(indices.size(), 0);
+  ASSERT_TRUE(GatherDictionaryValues(indices.data(), 37, dictionary.data(), 3,
+                                     out.data()));
+  ASSERT_EQ(out, std::vector<int64_t>(37, 30));
+
+  for (int32_t bad_index : {-1, 3, 1 << 30}) {
+    for (int position : {0, 17, 36}) {
+      indices[position] = bad_index;
+      std::fill(out.begin(), out.end(), 0);
+      ASSERT_FALSE(GatherDictionaryValues(indices.data(), 37, dictionary.data(), 3,
+                                          out.data()));
+      // Nothing was written
+      ASSERT_EQ(out, std::vector<int64_t>(37, 0));
+      indices[position] = 0;
+    }
+  }
+  // No indices to check
+  ASSERT_TRUE(GatherDictionaryValues(indices.data(), 0, dictionary.data(), 0,
+                                     out.data()));
+}
+
 }  // namespace util
 }  // namespace arrow
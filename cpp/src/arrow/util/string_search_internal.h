@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#  include <xsimd/xsimd.hpp>
+#endif
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace internal {
+
+// Substring search filtering candidate positions on the first and last byte of
+// the needle (see http://0x80.pl/articles/simd-strfind.html).  Comparing two
+// bytes that are far apart rejects most candidates, even for needles made of
+// common characters, so the full comparison rarely runs.
+
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+static inline int64_t FindSubstringSimd(const uint8_t* data, int64_t length,
+                                        const uint8_t* needle, int64_t needle_length,
+                                        int64_t* pos) {
+  using simd_batch = xsimd::make_sized_batch_t<uint8_t, 16>;
+
+  const simd_batch first(needle[0]);
+  const simd_batch last(needle[needle_length - 1]);
+  // Test 16 candidate positions at a time while the last byte of the farthest
+  // candidate is still in bounds
+  for (; *pos + 16 + needle_length - 1 <= length; *pos += 16) {
+    const auto block_first = simd_batch::load_unaligned(data + *pos);
+    const auto block_last = simd_batch::load_unaligned(data + *pos + needle_length - 1);
+    uint64_t candidates = ((block_first == first) & (block_last == last)).mask();
+    while (candidates != 0) {
+      const int64_t candidate = *pos + bit_util::CountTrailingZeros(candidates);
+      if (std::memcmp(data + candidate + 1, needle + 1, needle_length - 2) == 0) {
+        return candidate;
+      }
+      candidates &= candidates - 1;
+    }
+  }
+  return -1;
+}
+#endif  // ARROW_HAVE_NEON || ARROW_HAVE_SSE4_2
+
+/// \brief Return the offset of the first occurrence of `needle` in `haystack`,
+/// or -1 if there is none
+static inline int64_t FindSubstring(std::string_view haystack, std::string_view needle) {
+  const auto data = reinterpret_cast<const uint8_t*>(haystack.data());
+  const auto length = static_cast<int64_t>(haystack.size());
+  const auto needle_data = reinterpret_cast<const uint8_t*>(needle.data());
+  const auto needle_length = static_cast<int64_t>(needle.size());
+
+  if (needle_length == 0) return 0;
+  if (needle_length > length) return -1;
+  if (needle_length == 1) {
+    const void* found = std::memchr(data, needle_data[0], length);
+    return found ? static_cast<const uint8_t*>(found) - data : -1;
+  }
+
+  int64_t pos = 0;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  const int64_t found = FindSubstringSimd(data, length, needle_data, needle_length, &pos);
+  if (found >= 0) return found;
+#endif
+  // Remaining candidates are located with memchr, which is vectorized by most
+  // C libraries
+  const int64_t last_candidate = length - needle_length;
+  while (pos <= last_candidate) {
+    const void* candidate =
+        std::memchr(data + pos, needle_data[0], last_candidate - pos + 1);
+    if (candidate == nullptr) break;
+    pos = static_cast<const uint8_t*>(candidate) - data;
+    if (data[pos + needle_length - 1] == needle_data[needle_length - 1] &&
+        std::memcmp(data + pos + 1, needle_data + 1, needle_length - 2) == 0) {
+      return pos;
+    }
+    ++pos;
+  }
+  return -1;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
@@ -30,10 +31,14 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
 #include "arrow/vendored/strptime.h"
@@ -184,6 +189,74 @@ struct StringConverter<HalfFloatType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+namespace detail {
+
+// SWAR ("SIMD within a register") helpers working on eight characters at a
+// time.  The characters are loaded so that the first one is in the least
+// significant byte, whatever the platform endianness.
+
+constexpr uint64_t kEightZeroChars = 0x3030303030303030ULL;
+
+inline uint64_t LoadEightChars(const char* s) {
+  return bit_util::FromLittleEndian(util::SafeLoadAs<uint64_t>(
+      reinterpret_cast<const uint8_t*>(s)));
+}
+
+// Return a mask with the high bit set in each byte of `chars` that is not an
+// ASCII decimal digit.  A byte >= 0xFA may carry into the next byte, so only
+// the lowest flagged byte is reliable.
+inline uint64_t NonDigitMask(uint64_t chars) {
+  const uint64_t high_nibbles = chars & 0xF0F0F0F0F0F0F0F0ULL;
+  const uint64_t shifted_high_nibbles =
+      (chars + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL;
+  // Both are 0x30 for each digit byte
+  const uint64_t diff = (high_nibbles ^ kEightZeroChars) |
+                        (shifted_high_nibbles ^ kEightZeroChars);
+  // Fold any non-zero bit of each byte into its high bit
+  return ((diff | ((diff & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL)) &
+          0x8080808080808080ULL);
+}
+
+inline bool IsEightDigits(uint64_t chars) { return NonDigitMask(chars) == 0; }
+
+// Convert eight validated digit characters to their integer value
+inline uint32_t ParseEightDigits(uint64_t chars) {
+  uint64_t val = chars - kEightZeroChars;
+  // Combine pairs of digits into 2-digit values in every other byte...
+  val = (val * 10) + (val >> 8);
+  // ... then pairs of 2-digit values into a single 8-digit value
+  val = (((val & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+         (((val >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >>
+        32;
+  return static_cast<uint32_t>(val);
+}
+
+// Parse a run of 8 to 19 decimal digits, which cannot overflow a uint64_t
+inline bool ParseUnsignedEightOrMoreDigits(const char* s, size_t length,
+                                           uint64_t* out) {
+  uint64_t result = 0;
+  // Leading digits that do not make up a full group of eight
+  const char* end = s + length % 8;
+  for (; s < end; ++s) {
+    const uint8_t digit = ParseDecimalDigit(*s);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  for (end = s + length - length % 8; s < end; s += 8) {
+    const uint64_t chars = LoadEightChars(s);
+    if (ARROW_PREDICT_FALSE(!IsEightDigits(chars))) {
+      return false;
+    }
+    result = result * 100000000U + ParseEightDigits(chars);
+  }
+  *out = result;
+  return true;
+}
+
+}  // namespace detail
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -248,6 +321,16 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length >= 8 && length <= 9) {
+    // At most 9 digits, no overflow possible
+    uint64_t result = 0;
+    if (ARROW_PREDICT_FALSE(
+            !detail::ParseUnsignedEightOrMoreDigits(s, length, &result))) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(result);
+    return true;
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -268,6 +351,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8 && length <= 19) {
+    // At most 19 digits, no overflow possible
+    return detail::ParseUnsignedEightOrMoreDigits(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -460,6 +547,27 @@ namespace detail {
 
 using ts_type = TimestampType::c_type;
 
+// Load eight characters made of decimal digits, except for the bytes selected
+// by `separator_mask` which must be equal to those of `separators`.  On success,
+// `*out` holds the value of each digit in the corresponding byte.
+inline bool LoadDigitsAndSeparators(const char* s, uint64_t separators,
+                                    uint64_t separator_mask, uint64_t* out) {
+  const uint64_t chars = LoadEightChars(s);
+  if (ARROW_PREDICT_FALSE((chars & separator_mask) != separators)) {
+    return false;
+  }
+  const uint64_t digits = (chars & ~separator_mask) | (kEightZeroChars & separator_mask);
+  if (ARROW_PREDICT_FALSE(!IsEightDigits(digits))) {
+    return false;
+  }
+  *out = digits - kEightZeroChars;
+  return true;
+}
+
+inline uint32_t DigitAt(uint64_t digits, int i) {
+  return static_cast<uint32_t>((digits >> (8 * i)) & 0xFF);
+}
+
 template <typename Duration>
 static inline bool ParseHH(const char* s, Duration* out) {
   uint8_t hours = 0;
@@ -520,21 +628,15 @@ static inline bool ParseHHMM(const char* s, Duration* out) {
 
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
-  uint8_t hours = 0;
-  uint8_t minutes = 0;
-  uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  // "hh:mm:ss" is validated as a whole
+  uint64_t digits = 0;
+  if (ARROW_PREDICT_FALSE(!LoadDigitsAndSeparators(s, 0x00003A00003A0000ULL,
+                                                   0x0000FF0000FF0000ULL, &digits))) {
     return false;
   }
+  const uint32_t hours = DigitAt(digits, 0) * 10 + DigitAt(digits, 1);
+  const uint32_t minutes = DigitAt(digits, 3) * 10 + DigitAt(digits, 4);
+  const uint32_t seconds = DigitAt(digits, 6) * 10 + DigitAt(digits, 7);
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
     return false;
   }
@@ -633,21 +735,20 @@ static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
-  uint8_t month = 0;
+  // "YYYY-MM-" is validated as a whole, the day separately
+  uint64_t digits = 0;
   uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  if (ARROW_PREDICT_FALSE(!detail::LoadDigitsAndSeparators(
+          s, 0x2D00002D00000000ULL, 0xFF0000FF00000000ULL, &digits))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
     return false;
   }
+  const int year = static_cast<int>(
+      detail::DigitAt(digits, 0) * 1000 + detail::DigitAt(digits, 1) * 100 +
+      detail::DigitAt(digits, 2) * 10 + detail::DigitAt(digits, 3));
+  const uint32_t month = detail::DigitAt(digits, 5) * 10 + detail::DigitAt(digits, 6);
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -941,5 +1042,67 @@ enable_if_parameter_free<T, bool> ParseValue(
   return StringConverter<T>{}.Convert(type, s, length, out);
 }
 
+/// \brief Parse the values of a binary-like array laid out as offsets and data buffers.
+///
+/// `parse` is called as `parse(const char* s, size_t length, ValueType* out)` for each
+/// non-null value and returns whether it succeeded.  Null slots, according to
+/// `validity` (which may be null), are set to `ValueType{}`.  Parsing stops at the
+/// first failure.
+///
+/// \return the index of the first value that failed to parse, or `length`
+template <typename OffsetType, typename ValueType, typename ParseFunc>
+int64_t ParseBinaryValues(const OffsetType* offsets, const uint8_t* data,
+                          const uint8_t* validity, int64_t validity_offset,
+                          int64_t length, ValueType* out, ParseFunc&& parse) {
+  const char* chars = reinterpret_cast<const char*>(data);
+  auto parse_at = [&](int64_t i) {
+    return parse(chars + offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i]),
+                 out + i);
+  };
+  OptionalBitBlockCounter bit_counter(validity, validity_offset, length);
+  int64_t position = 0;
+  while (position < length) {
+    const BitBlockCount block = bit_counter.NextBlock();
+    const int64_t block_end = position + block.length;
+    if (block.AllSet()) {
+      for (int64_t i = position; i < block_end; ++i) {
+        if (ARROW_PREDICT_FALSE(!parse_at(i))) {
+          return i;
+        }
+      }
+    } else if (block.NoneSet()) {
+      std::fill(out + position, out + block_end, ValueType{});
+    } else {
+      for (int64_t i = position; i < block_end; ++i) {
+        if (bit_util::GetBit(validity, validity_offset + i)) {
+          if (ARROW_PREDICT_FALSE(!parse_at(i))) {
+            return i;
+          }
+        } else {
+          out[i] = ValueType{};
+        }
+      }
+    }
+    position = block_end;
+  }
+  return length;
+}
+
+/// \brief Parse the values of a binary-like array with StringConverter<T>
+///
+/// \see ParseBinaryValues
+template <typename T, typename OffsetType>
+int64_t ParseValues(const T& type, const OffsetType* offsets, const uint8_t* data,
+                    const uint8_t* validity, int64_t validity_offset, int64_t length,
+                    typename StringConverter<T>::value_type* out) {
+  StringConverter<T> converter;
+  return ParseBinaryValues(
+      offsets, data, validity, validity_offset, length, out,
+      [&](const char* s, size_t value_length,
+          typename StringConverter<T>::value_type* value_out) {
+        return converter.Convert(type, s, value_length, value_out);
+      });
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -28,10 +28,13 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/array_binary.h"
+#include "arrow/array/builder_binary.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/formatting.h"
 #include "arrow/util/value_parsing.h"
 
@@ -143,6 +146,40 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+static std::shared_ptr<StringArray> MakeStringArray(
+    const std::vector<std::string>& strings) {
+  StringBuilder builder;
+  ABORT_NOT_OK(builder.AppendValues(strings));
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return checked_pointer_cast<StringArray>(out);
+}
+
+// Parse the offsets and data buffers of a StringArray in one call, as the
+// cast kernels do
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void BenchParsingBatch(benchmark::State& state, const ARROW_TYPE& type,
+                              const std::vector<std::string>& strings) {
+  auto array = MakeStringArray(strings);
+  std::vector<C_TYPE> values(array->length());
+
+  for (auto _ : state) {
+    if (ParseValues(type, array->raw_value_offsets(), array->value_data()->data(),
+                    /*validity=*/nullptr, /*validity_offset=*/0, array->length(),
+                    values.data()) != array->length()) {
+      std::cerr << "Batch conversion failed";
+      std::abort();
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * array->length());
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void IntegerParsingBatch(benchmark::State& state) {  // NOLINT non-const reference
+  BenchParsingBatch(state, ARROW_TYPE{}, MakeIntStrings<C_TYPE>(1000));
+}
+
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
 static void HexParsing(benchmark::State& state) {  // NOLINT non-const reference
   auto strings = MakeHexStrings<C_TYPE>(1000);
@@ -217,6 +254,12 @@ static void TimestampParsingStrptime(
   BenchTimestampParsing(state, UNIT, *parser);
 }
 
+template <TimeUnit::type UNIT>
+static void TimestampParsingISO8601Batch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchParsingBatch(state, TimestampType(UNIT), MakeTimestampStrings(1000));
+}
+
 struct DummyAppender {
   Status operator()(std::string_view v) {
     if (pos_ >= static_cast<int32_t>(v.size())) {
@@ -269,6 +312,12 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt16Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt32Type);
 BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
+BENCHMARK_TEMPLATE(IntegerParsingBatch, Int8Type);
+BENCHMARK_TEMPLATE(IntegerParsingBatch, Int32Type);
+BENCHMARK_TEMPLATE(IntegerParsingBatch, Int64Type);
+BENCHMARK_TEMPLATE(IntegerParsingBatch, UInt32Type);
+BENCHMARK_TEMPLATE(IntegerParsingBatch, UInt64Type);
+
 BENCHMARK_TEMPLATE(HexParsing, Int8Type);
 BENCHMARK_TEMPLATE(HexParsing, Int16Type);
 BENCHMARK_TEMPLATE(HexParsing, Int32Type);
@@ -285,6 +334,8 @@ BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MILLI);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::NANO);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Batch, TimeUnit::SECOND);
+BENCHMARK_TEMPLATE(TimestampParsingISO8601Batch, TimeUnit::NANO);
 BENCHMARK_TEMPLATE(TimestampParsingStrptime, TimeUnit::MILLI);
 
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 #include "arrow/util/float16.h"
@@ -438,6 +439,33 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("0x23512ak");
 }
 
+TEST(StringConversion, ToIntegerEveryDigitCount) {
+  // Longer runs of digits are parsed eight at a time, check all alignments
+  // of the leading digits and of an invalid character
+  uint64_t value = 0;
+  for (int num_digits = 1; num_digits <= 19; ++num_digits) {
+    ARROW_SCOPED_TRACE("num_digits = ", num_digits);
+    value = value * 10 + (num_digits % 9) + 1;
+    const std::string digits = std::to_string(value);
+    AssertConversion<UInt64Type>(digits, value);
+    AssertConversion<Int64Type>(digits, static_cast<int64_t>(value));
+    AssertConversion<Int64Type>("-" + digits, -static_cast<int64_t>(value));
+    AssertConversion<UInt64Type>("000" + digits, value);
+    if (num_digits <= 9) {
+      AssertConversion<UInt32Type>(digits, static_cast<uint32_t>(value));
+    }
+    for (size_t i = 0; i < digits.size(); ++i) {
+      for (char c : {'/', ':', 'a', ' ', '\xff'}) {
+        std::string invalid = digits;
+        invalid[i] = c;
+        AssertConversionFails<UInt64Type>(invalid);
+        AssertConversionFails<Int64Type>(invalid);
+        AssertConversionFails<UInt32Type>(invalid);
+      }
+    }
+  }
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
@@ -794,6 +822,47 @@ TEST(StringConversion, ToTimestampDateTime_ISO8601) {
     // Invalid subseconds
     AssertConversionFails(type, "1900-02-28 12:34:56.1234567890");
   }
+  {
+    // A wrong character anywhere in the date and time is rejected ('-' is
+    // left out as it can turn the end of the string into a valid zone offset)
+    TimestampType type{TimeUnit::SECOND};
+    const std::string valid = "2018-11-13 17:11:10";
+    AssertConversion(type, valid, 1542129070);
+    for (size_t i = 0; i < valid.size(); ++i) {
+      for (char c : {':', 'a', '\xff'}) {
+        std::string invalid = valid;
+        if (invalid[i] == c) continue;
+        invalid[i] = c;
+        AssertConversionFails(type, invalid);
+      }
+    }
+    AssertConversionFails(type, "2018-13-13 17:11:10");
+    AssertConversionFails(type, "2018-11-31 17:11:10");
+    AssertConversionFails(type, "2018-11-13 24:11:10");
+    AssertConversionFails(type, "2018-11-13 17:60:10");
+    AssertConversionFails(type, "2018-11-13 17:11:60");
+  }
+}
+
+TEST(StringConversion, ParseValues) {
+  auto array = ArrayFromJSON(
+      utf8(), R"(["0", "12", null, "123456789012", "-5", null, "x", "7", "y"])");
+  std::vector<int64_t> out(array->length(), -1);
+  auto parse = [&](const std::shared_ptr<Array>& values) {
+    const auto& strings = checked_cast<const StringArray&>(*values);
+    return ParseValues(Int64Type{}, strings.raw_value_offsets(),
+                       strings.value_data()->data(), strings.null_bitmap_data(),
+                       strings.offset(), strings.length(), out.data());
+  };
+
+  ASSERT_EQ(parse(array->Slice(1, 5)), 5);
+  ASSERT_EQ(std::vector<int64_t>(out.begin(), out.begin() + 5),
+            (std::vector<int64_t>{12, 0, 123456789012, -5, 0}));
+
+  // Parsing stops at the first invalid value
+  ASSERT_EQ(parse(array), 6);
+  ASSERT_EQ(parse(array->Slice(7)), 1);
+  ASSERT_EQ(out[0], 7);
 }
 
 TEST(TimestampParser, StrptimeParser) {
@@ -47,6 +47,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"  // for ARROW_CSV definition
 #include "arrow/util/decimal.h"
@@ -1481,6 +1482,119 @@ TEST_F(TestJsonParquetIO, JsonExtension) {
   this->RoundTripSingleColumn(json_large_array, json_large_array, writer_properties);
 }
 
+TEST(TestArrowReadWrite, ReadBinaryAsView) {
+  auto schema = ::arrow::schema(
+      {::arrow::field("s", ::arrow::utf8()), ::arrow::field("b", ::arrow::binary())});
+  auto table = ::arrow::TableFromJSON(schema, {R"([
+    ["inline", "a value longer than twelve bytes"],
+    [null, "short"],
+    ["a string longer than twelve bytes", null],
+    ["", ""],
+    ["a string longer than twelve bytes", "a value longer than twelve bytes"],
+    ["another long string value", "x"]
+  ])"});
+  auto view_schema = ::arrow::schema({::arrow::field("s", ::arrow::utf8_view()),
+                                      ::arrow::field("b", ::arrow::binary_view())});
+  ASSERT_OK_AND_ASSIGN(auto expected_s,
+                       ::arrow::compute::Cast(table->column(0), ::arrow::utf8_view()));
+  ASSERT_OK_AND_ASSIGN(auto expected_b,
+                       ::arrow::compute::Cast(table->column(1), ::arrow::binary_view()));
+  auto expected_table =
+      Table::Make(view_schema, {expected_s.chunked_array(), expected_b.chunked_array()});
+
+  // Compressed pages are decoded from the page reader's decompression buffers
+  std::vector<Compression::type> compressions = {Compression::UNCOMPRESSED};
+#ifdef ARROW_WITH_SNAPPY
+  compressions.push_back(Compression::SNAPPY);
+#endif
+
+  ArrowReaderProperties reader_properties;
+  reader_properties.set_binary_type(::arrow::Type::BINARY_VIEW);
+  for (bool enable_dictionary : {false, true}) {
+    for (auto compression : compressions) {
+      ARROW_SCOPED_TRACE("enable_dictionary = ", enable_dictionary,
+                         ", compression = ", compression);
+      WriterProperties::Builder builder;
+      builder.compression(compression);
+      if (!enable_dictionary) builder.disable_dictionary();
+      std::shared_ptr<Table> result;
+      ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, /*row_group_size=*/4, &result,
+                                          builder.build(),
+                                          default_arrow_writer_properties(),
+                                          reader_properties));
+      ASSERT_OK(result->ValidateFull());
+      ::arrow::AssertSchemaEqual(*view_schema, *result->schema(),
+                                 /*check_metadata=*/false);
+      ::arrow::AssertTablesEqual(*expected_table, *result, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ReadBinaryAsViewMultiplePages) {
+  // Mix inline and out-of-line values, and nulls
+  constexpr int64_t kNumRows = 2000;
+  ::arrow::StringBuilder builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    if (i % 7 == 0) {
+      ASSERT_OK(builder.AppendNull());
+    } else if (i % 3 == 0) {
+      ASSERT_OK(builder.Append("s" + std::to_string(i)));
+    } else {
+      ASSERT_OK(builder.Append("a value longer than twelve bytes " + std::to_string(i)));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+  auto table = Table::Make(::arrow::schema({::arrow::field("s", ::arrow::utf8())}),
+                           {values});
+  ASSERT_OK_AND_ASSIGN(auto expected_values,
+                       ::arrow::compute::Cast(values, ::arrow::utf8_view()));
+
+  std::vector<Compression::type> compressions = {Compression::UNCOMPRESSED};
+#ifdef ARROW_WITH_SNAPPY
+  compressions.push_back(Compression::SNAPPY);
+#endif
+
+  ArrowReaderProperties reader_properties;
+  reader_properties.set_binary_type(::arrow::Type::BINARY_VIEW);
+  for (bool enable_dictionary : {false, true}) {
+    for (auto compression : compressions) {
+      ARROW_SCOPED_TRACE("enable_dictionary = ", enable_dictionary,
+                         ", compression = ", compression);
+      // Small pages, so that the single row group spans many of them
+      WriterProperties::Builder builder;
+      builder.compression(compression)->data_pagesize(1024)->write_batch_size(64);
+      if (!enable_dictionary) builder.disable_dictionary();
+      auto sink = CreateOutputStream();
+      ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                    /*row_group_size=*/kNumRows, builder.build()));
+      ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+      auto parquet_reader =
+          ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+      ASSERT_EQ(1, parquet_reader->metadata()->num_row_groups());
+      auto page_reader = parquet_reader->RowGroup(0)->GetColumnPageReader(0);
+      int num_data_pages = 0;
+      while (auto page = page_reader->NextPage()) {
+        if (page->type() != PageType::DICTIONARY_PAGE) ++num_data_pages;
+      }
+      ASSERT_GT(num_data_pages, 1);
+
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder reader_builder;
+      ASSERT_OK_NO_THROW(reader_builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK_NO_THROW(reader_builder.properties(reader_properties)->Build(&reader));
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+      ASSERT_OK(result->ValidateFull());
+
+      // All pages are decoded into a single array
+      ASSERT_EQ(1, result->column(0)->num_chunks());
+      ::arrow::AssertArraysEqual(*expected_values.make_array(),
+                                 *result->column(0)->chunk(0), /*verbose=*/true);
+    }
+  }
+}
+
 using TestNullParquetIO = TestParquetIO<::arrow::NullType>;
 
 TEST_F(TestNullParquetIO, NullColumn) {
@@ -2420,6 +2534,62 @@ TEST(TestArrowReadWrite, NoneCoalescedReads) {
   TestGetRecordBatchReader(arrow_properties);
 }
 
+// Same as the test above, but only pre-buffering a few row groups ahead.
+TEST(TestArrowReadWrite, ReadaheadCoalescedReads) {
+  ArrowReaderProperties arrow_properties = default_arrow_reader_properties();
+  arrow_properties.set_pre_buffer_readahead_row_groups(1);
+  TestGetRecordBatchReader(arrow_properties);
+}
+
+TEST(TestArrowReadWrite, ReadaheadCoalescedReadsSmallRowGroups) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+  const int row_group_size = 70;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (int64_t readahead_bytes : {0, 1}) {
+    ARROW_SCOPED_TRACE("readahead_bytes = ", readahead_bytes);
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_batch_size(batch_size);
+    properties.set_pre_buffer_readahead_row_groups(3);
+    properties.set_pre_buffer_readahead_bytes(readahead_bytes);
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    const int num_row_groups = reader->num_row_groups();
+    ASSERT_EQ(num_row_groups, (num_rows + row_group_size - 1) / row_group_size);
+
+    ASSERT_OK_AND_ASSIGN(auto rb_reader,
+                         reader->GetRecordBatchReader(Iota(num_row_groups)));
+    std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+    ::arrow::TableBatchReader table_reader(*table);
+    table_reader.set_chunksize(batch_size);
+
+    for (int i = 0; i < num_rows / batch_size; ++i) {
+      ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+      ASSERT_OK(table_reader.ReadNext(&expected_batch));
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+    }
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_EQ(nullptr, actual_batch);
+
+    // Row groups are released once decoded
+    ASSERT_RAISES(Invalid, reader->parquet_reader()->WhenBuffered({0}, {0}).status());
+    ASSERT_OK(
+        reader->parquet_reader()->WhenBuffered({num_row_groups - 1}, {0}).status());
+  }
+}
+
 // Use coalesced reads, and explicitly wait for I/O to complete.
 TEST(TestArrowReadWrite, WaitCoalescedReads) {
   ArrowReaderProperties properties = default_arrow_reader_properties();
@@ -5541,6 +5711,98 @@ TEST(TestArrowReadWrite, WriteRecordBatchNotProduceEmptyRowGroup) {
   }
 }
 
+TEST(TestArrowReadWrite, WriteByteSizedRowGroupsAndPages) {
+  constexpr int64_t kMaxRowGroupBytes = 256 * 1024;
+  constexpr int64_t kPageSize = 16 * 1024;
+  auto schema = ::arrow::schema({::arrow::field("s", ::arrow::utf8())});
+
+  // 1000 values of 1000 bytes per batch, so that a batch spans several row
+  // groups and write_batch_size values several pages. Half of each value is
+  // repeated, so that compression about halves its size.
+  auto gen = ::arrow::random::RandomArrayGenerator(/*seed=*/42);
+  ::arrow::RecordBatchVector batches;
+  for (int i = 0; i < 4; ++i) {
+    auto random_halves = std::static_pointer_cast<::arrow::StringArray>(
+        gen.String(1000, /*min_length=*/500, /*max_length=*/500));
+    ::arrow::StringBuilder builder;
+    for (int64_t j = 0; j < random_halves->length(); ++j) {
+      ASSERT_OK(builder.Append(random_halves->GetString(j) + std::string(500, 'x')));
+    }
+    ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+    batches.push_back(::arrow::RecordBatch::Make(schema, 1000, {values}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, batches));
+  ASSERT_OK_AND_ASSIGN(const int64_t table_bytes,
+                       ::arrow::util::ReferencedBufferSize(*table));
+
+  std::vector<Compression::type> compressions = {Compression::UNCOMPRESSED};
+#ifdef ARROW_WITH_SNAPPY
+  compressions.push_back(Compression::SNAPPY);
+#endif
+
+  for (auto compression : compressions) {
+    ARROW_SCOPED_TRACE("compression = ", compression);
+    auto writer_properties = WriterProperties::Builder()
+                                 .max_row_group_bytes(kMaxRowGroupBytes)
+                                 ->data_pagesize(kPageSize)
+                                 ->disable_dictionary()
+                                 ->compression(compression)
+                                 ->build();
+
+    auto CheckPages = [&](ParquetFileReader* reader, int row_group) {
+      auto page_reader = reader->RowGroup(row_group)->GetColumnPageReader(0);
+      while (auto page = page_reader->NextPage()) {
+        EXPECT_LE(page->size(), 2 * kPageSize);
+      }
+    };
+
+    // Row groups are continued across WriteRecordBatch calls, and are sized by
+    // their compressed size
+    auto sink = CreateOutputStream();
+    ASSERT_OK_AND_ASSIGN(auto writer,
+                         FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                          writer_properties));
+    for (const auto& batch : batches) {
+      ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK_NO_THROW(writer->Close());
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+    auto metadata = reader->metadata();
+    ASSERT_GT(metadata->num_row_groups(), 4);
+    int64_t num_rows = 0;
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+      auto row_group = metadata->RowGroup(i);
+      num_rows += row_group->num_rows();
+      EXPECT_LE(row_group->total_compressed_size(), kMaxRowGroupBytes * 11 / 10);
+      if (i < metadata->num_row_groups() - 1) {
+        EXPECT_GE(row_group->total_compressed_size(), kMaxRowGroupBytes * 9 / 10);
+      }
+      CheckPages(reader.get(), i);
+    }
+    ASSERT_EQ(num_rows, table->num_rows());
+
+    // WriteTable sizes row groups upfront from the in-memory size of the table,
+    // so compressed row groups come out smaller than the target
+    sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  /*chunk_size=*/table->num_rows(), writer_properties));
+    ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+    reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+    metadata = reader->metadata();
+    ASSERT_GT(metadata->num_row_groups(), 4);
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+      auto row_group = metadata->RowGroup(i);
+      EXPECT_LE(row_group->num_rows(),
+                kMaxRowGroupBytes * table->num_rows() / table_bytes);
+      if (compression != Compression::UNCOMPRESSED) {
+        EXPECT_LE(row_group->total_compressed_size(), kMaxRowGroupBytes * 3 / 4);
+      }
+      CheckPages(reader.get(), i);
+    }
+  }
+}
+
 TEST(TestArrowReadWrite, MultithreadedWrite) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -451,8 +451,11 @@ class LeafReader : public ColumnReaderImpl {
         field_(std::move(field)),
         input_(std::move(input)),
         descr_(input_->descr()) {
+    const auto type_id = field_->type()->id();
     record_reader_ = RecordReader::Make(
-        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+        descr_, leaf_info, ctx_->pool, type_id == ::arrow::Type::DICTIONARY,
+        /*read_dense_for_nullable=*/false,
+        type_id == ::arrow::Type::BINARY_VIEW || type_id == ::arrow::Type::STRING_VIEW);
     NextRowGroup();
   }
 
@@ -983,18 +986,132 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
   return GetReader(field, field.field, ctx, out);
 }
 
+// Keeps the column chunks of a bounded window of row groups pre-buffered ahead of
+// the ones being decoded, so that their I/O overlaps with decoding without holding
+// the whole selection in memory.
+class RowGroupReadahead {
+ public:
+  RowGroupReadahead(ParquetReader* reader, std::vector<int> row_groups,
+                    std::vector<int> column_indices,
+                    const ArrowReaderProperties& properties)
+      : reader_(reader),
+        row_groups_(std::move(row_groups)),
+        column_indices_(std::move(column_indices)),
+        properties_(properties) {
+    auto metadata = reader_->metadata();
+    row_group_offsets_.reserve(row_groups_.size() + 1);
+    row_group_bytes_.reserve(row_groups_.size());
+    int64_t offset = 0;
+    for (int row_group : row_groups_) {
+      auto row_group_metadata = metadata->RowGroup(row_group);
+      row_group_offsets_.push_back(offset);
+      offset += row_group_metadata->num_rows();
+      int64_t bytes = 0;
+      for (int column : column_indices_) {
+        bytes += row_group_metadata->ColumnChunk(column)->total_compressed_size();
+      }
+      row_group_bytes_.push_back(bytes);
+    }
+    row_group_offsets_.push_back(offset);
+  }
+
+  // Make sure the row groups holding rows [offset, offset + length) of the selection
+  // are buffered along with the readahead after them, and release the ones before.
+  Status Advance(int64_t offset, int64_t length) {
+    if (row_groups_.empty()) return Status::OK();
+    const size_t first = RowGroupOf(offset);
+    const size_t last = length > 0 ? RowGroupOf(offset + length - 1) : first;
+
+    std::vector<int> released;
+    for (; begin_ < std::min(first, end_); ++begin_) {
+      released.push_back(row_groups_[begin_]);
+    }
+    begin_ = std::max(begin_, first);
+    end_ = std::max(end_, begin_);
+
+    const size_t needed_end = std::min(last + 1, row_groups_.size());
+    int64_t readahead_bytes = 0;
+    for (size_t i = needed_end; i < end_; ++i) {
+      readahead_bytes += row_group_bytes_[i];
+    }
+    const auto readahead =
+        static_cast<size_t>(properties_.pre_buffer_readahead_row_groups());
+    const int64_t readahead_limit = properties_.pre_buffer_readahead_bytes();
+    std::vector<int> buffered;
+    for (; end_ < row_groups_.size(); ++end_) {
+      if (end_ >= needed_end) {
+        if (end_ - needed_end >= readahead) break;
+        if (end_ > needed_end && readahead_limit > 0 &&
+            readahead_bytes + row_group_bytes_[end_] > readahead_limit) {
+          break;
+        }
+        readahead_bytes += row_group_bytes_[end_];
+      }
+      buffered.push_back(row_groups_[end_]);
+    }
+
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->ReleaseBuffered(released);
+    if (!buffered.empty()) {
+      reader_->ExtendPreBuffer(buffered, column_indices_, properties_.io_context(),
+                               properties_.cache_options());
+      // A lazy cache only issues I/O once a range is waited for or read, so
+      // request the new row groups right away for them to arrive while decoding.
+      // Errors are reported when the data is read.
+      (void)reader_->WhenBuffered(buffered, column_indices_);
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    return Status::OK();
+  }
+
+ private:
+  // Index in row_groups_ of the row group holding the given row of the selection
+  size_t RowGroupOf(int64_t row) const {
+    auto it = std::upper_bound(row_group_offsets_.begin(), row_group_offsets_.end() - 1,
+                               row);
+    return static_cast<size_t>(it - row_group_offsets_.begin()) - 1;
+  }
+
+  ParquetReader* reader_;
+  const std::vector<int> row_groups_;
+  const std::vector<int> column_indices_;
+  const ArrowReaderProperties properties_;
+  // Offset of the first row of each row group in the selection, followed by the
+  // total number of rows
+  std::vector<int64_t> row_group_offsets_;
+  // Compressed size of the selected column chunks of each row group
+  std::vector<int64_t> row_group_bytes_;
+  // Range of indices in row_groups_ that are currently buffered
+  size_t begin_ = 0;
+  size_t end_ = 0;
+};
+
 }  // namespace
 
 Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
     const std::vector<int>& row_groups, const std::vector<int>& column_indices) {
   RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
 
+  int64_t num_rows = 0;
+  for (int row_group : row_groups) {
+    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+  }
+
+  std::shared_ptr<RowGroupReadahead> readahead;
   if (reader_properties_.pre_buffer()) {
-    // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
-    BEGIN_PARQUET_CATCH_EXCEPTIONS
-    reader_->PreBuffer(row_groups, column_indices, reader_properties_.io_context(),
-                       reader_properties_.cache_options());
-    END_PARQUET_CATCH_EXCEPTIONS
+    if (reader_properties_.pre_buffer_readahead_row_groups() > 0) {
+      // Only buffer a window of row groups, starting with the first batch, which
+      // the column readers open as soon as they are created
+      readahead = std::make_shared<RowGroupReadahead>(reader_.get(), row_groups,
+                                                      column_indices, reader_properties_);
+      RETURN_NOT_OK(readahead->Advance(0, std::min(properties().batch_size(), num_rows)));
+    } else {
+      // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      reader_->PreBuffer(row_groups, column_indices, reader_properties_.io_context(),
+                         reader_properties_.cache_options());
+      END_PARQUET_CATCH_EXCEPTIONS
+    }
   }
 
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
@@ -1024,11 +1141,6 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
         ::arrow::MakeVectorIterator(std::move(batches)), std::move(batch_schema));
   }
 
-  int64_t num_rows = 0;
-  for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
-  }
-
   using ::arrow::RecordBatchIterator;
 
   // NB: This lambda will be invoked outside the scope of this call to
@@ -1036,7 +1148,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
   // `this` is a non-owning pointer so we are relying on the parent FileReader outliving
   // this RecordBatchReader.
   ::arrow::Iterator<RecordBatchIterator> batches = ::arrow::MakeFunctionIterator(
-      [readers, batch_schema, num_rows,
+      [readers, batch_schema, num_rows, readahead, offset = int64_t{0},
        this]() mutable -> ::arrow::Result<RecordBatchIterator> {
         ::arrow::ChunkedArrayVector columns(readers.size());
 
@@ -1044,6 +1156,11 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
         int64_t batch_size = std::min(properties().batch_size(), num_rows);
         num_rows -= batch_size;
 
+        if (readahead) {
+          RETURN_NOT_OK(readahead->Advance(offset, batch_size));
+        }
+        offset += batch_size;
+
         RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
             reader_properties_.use_threads(), static_cast<int>(readers.size()),
             [&](int i) { return readers[i]->NextBatch(batch_size, &columns[i]); }));
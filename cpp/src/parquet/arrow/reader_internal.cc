@@ -884,7 +884,9 @@ Status TransferColumnData(RecordReader* reader,
     case ::arrow::Type::BINARY:
     case ::arrow::Type::STRING:
     case ::arrow::Type::LARGE_BINARY:
-    case ::arrow::Type::LARGE_STRING: {
+    case ::arrow::Type::LARGE_STRING:
+    case ::arrow::Type::BINARY_VIEW:
+    case ::arrow::Type::STRING_VIEW: {
       RETURN_NOT_OK(TransferBinary(reader, pool, value_field, &chunked_result));
       result = chunked_result;
     } break;
@@ -1028,6 +1028,15 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
     modified = true;
   }
 
+  if ((origin_type->id() == ::arrow::Type::BINARY_VIEW &&
+       inferred_type->id() == ::arrow::Type::BINARY) ||
+      (origin_type->id() == ::arrow::Type::STRING_VIEW &&
+       inferred_type->id() == ::arrow::Type::STRING)) {
+    // Read back binary-like arrays as views if they were written from views.
+    inferred->field = inferred->field->WithType(origin_type);
+    modified = true;
+  }
+
   if (origin_type->id() == ::arrow::Type::DECIMAL256 &&
       inferred_type->id() == ::arrow::Type::DECIMAL128) {
     inferred->field = inferred->field->WithType(origin_type);
@@ -110,24 +110,58 @@ Result<std::shared_ptr<ArrowType>> MakeArrowTimestamp(const LogicalType& logical
   }
 }
 
+Result<std::shared_ptr<ArrowType>> MakeArrowBinary(
+    const ArrowReaderProperties& reader_properties) {
+  const auto binary_type = reader_properties.binary_type();
+  switch (binary_type) {
+    case ::arrow::Type::BINARY:
+      return ::arrow::binary();
+    case ::arrow::Type::LARGE_BINARY:
+      return ::arrow::large_binary();
+    case ::arrow::Type::BINARY_VIEW:
+      return ::arrow::binary_view();
+    default:
+      return Status::Invalid("Unsupported binary type for reading BYTE_ARRAY: ",
+                             ::arrow::internal::ToString(binary_type));
+  }
+}
+
+Result<std::shared_ptr<ArrowType>> MakeArrowString(
+    const ArrowReaderProperties& reader_properties) {
+  const auto binary_type = reader_properties.binary_type();
+  switch (binary_type) {
+    case ::arrow::Type::BINARY:
+      return ::arrow::utf8();
+    case ::arrow::Type::LARGE_BINARY:
+      return ::arrow::large_utf8();
+    case ::arrow::Type::BINARY_VIEW:
+      return ::arrow::utf8_view();
+    default:
+      return Status::Invalid("Unsupported binary type for reading BYTE_ARRAY: ",
+                             ::arrow::internal::ToString(binary_type));
+  }
+}
+
 Result<std::shared_ptr<ArrowType>> FromByteArray(
     const LogicalType& logical_type, const ArrowReaderProperties& reader_properties) {
   switch (logical_type.type()) {
     case LogicalType::Type::STRING:
-      return ::arrow::utf8();
+      return MakeArrowString(reader_properties);
     case LogicalType::Type::DECIMAL:
       return MakeArrowDecimal(logical_type);
     case LogicalType::Type::NONE:
     case LogicalType::Type::ENUM:
     case LogicalType::Type::BSON:
-      return ::arrow::binary();
-    case LogicalType::Type::JSON:
+      return MakeArrowBinary(reader_properties);
+    case LogicalType::Type::JSON: {
+      ARROW_ASSIGN_OR_RAISE(auto string_type, MakeArrowString(reader_properties));
       if (reader_properties.get_arrow_extensions_enabled()) {
-        return ::arrow::extension::json(::arrow::utf8());
+        return ::arrow::extension::json(std::move(string_type));
       }
       // When the original Arrow schema isn't stored and Arrow extensions are disabled,
-      // LogicalType::JSON is read as utf8().
-      return ::arrow::utf8();
+      // LogicalType::JSON is read as a string type.
+      return string_type;
+    }
     default:
       return Status::NotImplemented("Unhandled logical logical_type ",
                                     logical_type.ToString(), " for binary array");
@@ -32,6 +32,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
@@ -273,6 +274,14 @@ class ArrowColumnWriterV2 {
   RowGroupWriter* row_group_writer_;
 };
 
+// In-memory size of the data, which serves as an estimate of its encoded size
+// until some of it is written
+template <typename T>
+int64_t EstimateDataBytes(const T& data) {
+  auto maybe_bytes = ::arrow::util::ReferencedBufferSize(data);
+  return maybe_bytes.ok() ? *maybe_bytes : ::arrow::util::TotalBufferSize(data);
+}
+
 }  // namespace
 
 // ----------------------------------------------------------------------
@@ -378,6 +387,17 @@ class FileWriterImpl : public FileWriter {
       chunk_size = this->properties().max_row_group_length();
     }
 
+    // Row groups are written column by column, so their size must be known
+    // upfront: estimate it from the in-memory size of the table
+    const int64_t table_bytes = EstimateDataBytes(table);
+    if (table_bytes > this->properties().max_row_group_bytes()) {
+      const double row_bytes = static_cast<double>(table_bytes) / table.num_rows();
+      chunk_size = std::min(
+          chunk_size, std::max<int64_t>(1, static_cast<int64_t>(
+                                               this->properties().max_row_group_bytes() /
+                                               row_bytes)));
+    }
+
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
       RETURN_NOT_OK(NewRowGroup());
       for (int i = 0; i < table.num_columns(); i++) {
@@ -416,15 +436,44 @@ class FileWriterImpl : public FileWriter {
       return Status::OK();
     }
 
-    // Max number of rows allowed in a row group.
+    // Max number of rows allowed in a row group, and its target size.
     const int64_t max_row_group_length = this->properties().max_row_group_length();
+    const int64_t max_row_group_bytes = this->properties().max_row_group_bytes();
+
+    auto RowGroupFull = [&]() {
+      return row_group_writer_->num_rows() >= max_row_group_length ||
+             row_group_writer_->estimated_total_compressed_bytes() >= max_row_group_bytes;
+    };
 
     // Initialize a new buffered row group writer if necessary.
     if (row_group_writer_ == nullptr || !row_group_writer_->buffered() ||
-        row_group_writer_->num_rows() >= max_row_group_length) {
+        RowGroupFull()) {
       RETURN_NOT_OK(NewBufferedRowGroup());
     }
 
+    // The number of rows of the batch that fit in the current row group. The size of
+    // a row is estimated from the rows already in the row group, if any.
+    const double batch_row_bytes =
+        static_cast<double>(EstimateDataBytes(batch)) / batch.num_rows();
+    auto RowsToWrite = [&](int64_t offset) {
+      const int64_t num_rows = row_group_writer_->num_rows();
+      const int64_t max_rows =
+          std::min(max_row_group_length - num_rows, batch.num_rows() - offset);
+      const int64_t row_group_bytes =
+          row_group_writer_->estimated_total_compressed_bytes();
+      const double row_bytes = num_rows > 0
+                                   ? static_cast<double>(row_group_bytes) / num_rows
+                                   : batch_row_bytes;
+      if (row_bytes <= 0) {
+        return max_rows;
+      }
+      const double rows_fit = (max_row_group_bytes - row_group_bytes) / row_bytes;
+      if (rows_fit >= static_cast<double>(max_rows)) {
+        return max_rows;
+      }
+      return std::max<int64_t>(1, static_cast<int64_t>(rows_fit));
+    };
+
     auto WriteBatch = [&](int64_t offset, int64_t size) {
       std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
       int column_index_start = 0;
@@ -456,15 +505,12 @@ class FileWriterImpl : public FileWriter {
 
     int64_t offset = 0;
     while (offset < batch.num_rows()) {
-      const int64_t batch_size =
-          std::min(max_row_group_length - row_group_writer_->num_rows(),
-                   batch.num_rows() - offset);
+      const int64_t batch_size = RowsToWrite(offset);
       RETURN_NOT_OK(WriteBatch(offset, batch_size));
       offset += batch_size;
 
       // Flush current row group writer and create a new writer if it is full.
-      if (row_group_writer_->num_rows() >= max_row_group_length &&
-          offset < batch.num_rows()) {
+      if (offset < batch.num_rows() && RowGroupFull()) {
         RETURN_NOT_OK(NewBufferedRowGroup());
       }
     }
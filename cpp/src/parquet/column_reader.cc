@@ -18,10 +18,14 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -36,14 +40,17 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/chunked_array.h"
 #include "arrow/type.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_stream_utils_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/crc32.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/unreachable.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -234,6 +241,127 @@ void CheckNumValuesInHeader(int num_values) {
   }
 }
 
+// Decompresses the values of a page into `out`. The levels of a DataPageV2,
+// which are not compressed, are copied as-is.
+void DecompressPage(::arrow::util::Codec* codec, const Buffer& page_buffer,
+                    int compressed_len, int uncompressed_len, int levels_byte_len,
+                    ResizableBuffer* out) {
+  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
+    throw ParquetException("Invalid page header");
+  }
+
+  // Grow the uncompressed buffer if we need to.
+  PARQUET_THROW_NOT_OK(out->Resize(uncompressed_len, /*shrink_to_fit=*/false));
+
+  if (levels_byte_len > 0) {
+    // First copy the levels as-is
+    uint8_t* decompressed = out->mutable_data();
+    memcpy(decompressed, page_buffer.data(), levels_byte_len);
+  }
+
+  // GH-31992: DataPageV2 may store only levels and no values when all
+  // values are null. In this case, Parquet java is known to produce a
+  // 0-len compressed area (which is invalid compressed input).
+  // See https://github.com/apache/parquet-java/issues/3122
+  int64_t decompressed_len = 0;
+  if (uncompressed_len - levels_byte_len != 0) {
+    // Decompress the values
+    PARQUET_ASSIGN_OR_THROW(
+        decompressed_len,
+        codec->Decompress(compressed_len - levels_byte_len,
+                          page_buffer.data() + levels_byte_len,
+                          uncompressed_len - levels_byte_len,
+                          out->mutable_data() + levels_byte_len));
+  }
+
+  if (decompressed_len != uncompressed_len - levels_byte_len) {
+    throw ParquetException("Page didn't decompress to expected size, expected: " +
+                           std::to_string(uncompressed_len - levels_byte_len) +
+                           ", but got:" + std::to_string(decompressed_len));
+  }
+}
+
+// A page which was read from the stream, but not decrypted nor decompressed yet
+struct CompressedPage {
+  std::shared_ptr<Buffer> buffer;
+  int compressed_len = 0;
+  int uncompressed_len = 0;
+  int levels_byte_len = 0;
+  bool is_compressed = true;
+  // The decryptor and AAD for the page, if it is encrypted
+  const Decryptor* decryptor = nullptr;
+  std::string aad;
+  // Creates the page from its decompressed buffer
+  std::function<std::shared_ptr<Page>(std::shared_ptr<Buffer>)> make_page;
+
+  // Decrypts the page into `out`, if it is encrypted
+  void Decrypt(std::shared_ptr<ResizableBuffer> out) {
+    if (decryptor == nullptr) {
+      return;
+    }
+    PARQUET_THROW_NOT_OK(out->Resize(decryptor->PlaintextLength(compressed_len),
+                                     /*shrink_to_fit=*/false));
+    compressed_len = decryptor->Decrypt(buffer->span_as<uint8_t>(),
+                                        out->mutable_span_as<uint8_t>(), aad);
+    buffer = std::move(out);
+  }
+};
+
+// A page decrypted and decompressed ahead of decoding. It is processed by
+// whichever comes first of a CPU thread pool task and the reader asking for it,
+// so that the reader never waits for a task which has not started running.
+class PendingPage {
+ public:
+  PendingPage(CompressedPage page, ::arrow::util::Codec* codec, MemoryPool* pool)
+      : page_(std::move(page)),
+        codec_(codec),
+        pool_(pool),
+        result_(::arrow::Future<std::shared_ptr<Page>>::Make()) {}
+
+  // Decrypt and decompress the page, unless another thread already started
+  // doing so
+  void Decompress() {
+    if (started_.exchange(true)) {
+      return;
+    }
+    result_.MarkFinished(DoDecompress());
+  }
+
+  ::arrow::Result<std::shared_ptr<Page>> Wait() {
+    Decompress();
+    return result_.result();
+  }
+
+  // Make sure the codec is not used anymore, without decompressing the page if
+  // that did not start yet
+  void Abandon() {
+    if (started_.exchange(true)) {
+      result_.Wait();
+    }
+  }
+
+ private:
+  ::arrow::Result<std::shared_ptr<Page>> DoDecompress() {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    page_.Decrypt(AllocateBuffer(pool_, 0));
+    std::shared_ptr<Buffer> buffer = std::move(page_.buffer);
+    if (codec_ != nullptr && page_.is_compressed) {
+      std::shared_ptr<ResizableBuffer> decompressed = AllocateBuffer(pool_, 0);
+      DecompressPage(codec_, *buffer, page_.compressed_len, page_.uncompressed_len,
+                     page_.levels_byte_len, decompressed.get());
+      buffer = std::move(decompressed);
+    }
+    return page_.make_page(std::move(buffer));
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  CompressedPage page_;
+  ::arrow::util::Codec* codec_;
+  MemoryPool* pool_;
+  std::atomic<bool> started_{false};
+  ::arrow::Future<std::shared_ptr<Page>> result_;
+};
+
 // ----------------------------------------------------------------------
 // SerializedPageReader deserializes Thrift metadata and pages that have been
 // assembled in a serialized stream for storing in a Parquet files
@@ -258,8 +386,21 @@ class SerializedPageReader : public PageReader {
       InitDecryption();
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
+    codec_type_ = codec;
     decompressor_ = GetCodec(codec);
     always_compressed_ = always_compressed;
+    if (readahead_enabled()) {
+      // Pages processed ahead must stay valid until they are decoded
+      reuse_buffers_ = false;
+    }
+  }
+
+  ~SerializedPageReader() override {
+    // Pages being processed on the thread pool use the codecs and decryptor of
+    // this reader
+    for (const auto& pending : pending_pages_) {
+      pending->Abandon();
+    }
   }
 
   // Implement the PageReader interface
@@ -267,16 +408,36 @@ class SerializedPageReader : public PageReader {
   // The returned Page contains references that aren't guaranteed to live
   // beyond the next call to NextPage(). SerializedPageReader reuses the
   // decryption and decompression buffers internally, so if NextPage() is
-  // called then the content of previous page might be invalidated.
+  // called then the content of previous page might be invalidated. This is
+  // not the case when pages are decompressed ahead of decoding.
   std::shared_ptr<Page> NextPage() override;
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  bool DisableBufferReuse() override {
+    reuse_buffers_ = false;
+    return true;
+  }
+
  private:
   void UpdateDecryption(Decryptor* decryptor, int8_t module_type, std::string* page_aad);
 
   void InitDecryption();
 
+  // Reads the next page from the stream. Returns false if there are no more
+  // pages.
+  bool ReadCompressedPage(CompressedPage* page);
+
+  // Whether pages are decrypted and decompressed ahead of decoding
+  bool readahead_enabled() const {
+    return properties_.page_decompression_readahead() > 0 &&
+           (decompressor_ != nullptr || data_decryptor_ != nullptr);
+  }
+
+  // Returns the next page, decrypting and decompressing the following ones on
+  // the CPU thread pool
+  std::shared_ptr<Page> NextPageReadahead();
+
   std::shared_ptr<Buffer> DecompressIfNeeded(std::shared_ptr<Buffer> page_buffer,
                                              int compressed_len, int uncompressed_len,
                                              int levels_byte_len = 0);
@@ -292,11 +453,22 @@ class SerializedPageReader : public PageReader {
   format::PageHeader current_page_header_;
 
   // Compression codec to use.
+  Compression::type codec_type_;
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
+  // Pages being processed ahead of decoding, in order. As codecs may not be
+  // used concurrently, each of them gets its own codec from readahead_codecs_.
+  std::deque<std::shared_ptr<PendingPage>> pending_pages_;
+  std::vector<std::unique_ptr<::arrow::util::Codec>> readahead_codecs_;
+  int64_t num_readahead_pages_ = 0;
+  bool pages_exhausted_ = false;
+
   bool always_compressed_;
 
+  // Whether the decompression and decryption buffers are reused across pages
+  bool reuse_buffers_ = true;
+
   // The fields below are used for calculation of AAD (additional authenticated data)
   // suffix which is part of the Parquet Modular Encryption.
   // The AAD suffix for a parquet module is built internally by
@@ -417,6 +589,61 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (readahead_enabled()) {
+    return NextPageReadahead();
+  }
+  CompressedPage page;
+  if (!ReadCompressedPage(&page)) {
+    return nullptr;
+  }
+  if (page.decryptor != nullptr) {
+    if (!reuse_buffers_) {
+      decryption_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
+    }
+    page.Decrypt(decryption_buffer_);
+  }
+  std::shared_ptr<Buffer> page_buffer = std::move(page.buffer);
+  if (page.is_compressed) {
+    page_buffer = DecompressIfNeeded(std::move(page_buffer), page.compressed_len,
+                                     page.uncompressed_len, page.levels_byte_len);
+  }
+  return page.make_page(std::move(page_buffer));
+}
+
+std::shared_ptr<Page> SerializedPageReader::NextPageReadahead() {
+  const int32_t readahead = properties_.page_decompression_readahead();
+  if (readahead_codecs_.empty()) {
+    readahead_codecs_.resize(readahead);
+  }
+  // Keep the next pages decrypting and decompressing on the CPU thread pool.
+  // The codec of a page is reused only once that page was handed out.
+  while (!pages_exhausted_ && static_cast<int32_t>(pending_pages_.size()) < readahead) {
+    CompressedPage page;
+    if (!ReadCompressedPage(&page)) {
+      pages_exhausted_ = true;
+      break;
+    }
+    auto& codec = readahead_codecs_[num_readahead_pages_++ % readahead];
+    if (codec == nullptr && decompressor_ != nullptr) {
+      codec = GetCodec(codec_type_);
+    }
+    auto pending = std::make_shared<PendingPage>(std::move(page), codec.get(),
+                                                 properties_.memory_pool());
+    // If the task cannot be spawned, the page is decompressed when it is needed
+    PARQUET_IGNORE_NOT_OK(::arrow::internal::GetCpuThreadPool()->Spawn(
+        [pending] { pending->Decompress(); }));
+    pending_pages_.push_back(std::move(pending));
+  }
+  if (pending_pages_.empty()) {
+    return nullptr;
+  }
+  std::shared_ptr<PendingPage> pending = std::move(pending_pages_.front());
+  pending_pages_.pop_front();
+  PARQUET_ASSIGN_OR_THROW(auto page, pending->Wait());
+  return page;
+}
+
+bool SerializedPageReader::ReadCompressedPage(CompressedPage* page) {
   ThriftDeserializer deserializer(properties_);
 
   // Loop here because there may be unhandled page types that we skip until
@@ -430,7 +657,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     // until a maximum allowed header limit
     while (true) {
       PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
-      if (view.size() == 0) return nullptr;
+      if (view.size() == 0) return false;
 
       // This gets used, then set by DeserializeThriftMsg
       header_size = static_cast<uint32_t>(view.size());
@@ -500,41 +727,50 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       }
     }
 
-    // Decrypt it if we need to
+    // The page is decrypted along with decompression, which may happen on
+    // another thread
     if (data_decryptor_ != nullptr) {
-      PARQUET_THROW_NOT_OK(
-          decryption_buffer_->Resize(data_decryptor_->PlaintextLength(compressed_len),
-                                     /*shrink_to_fit=*/false));
-      compressed_len =
-          data_decryptor_->Decrypt(page_buffer->span_as<uint8_t>(),
-                                   decryption_buffer_->mutable_span_as<uint8_t>());
-
-      page_buffer = decryption_buffer_;
+      page->decryptor = data_decryptor_.get();
+      page->aad = data_decryptor_->aad();
     }
 
+    page->buffer = std::move(page_buffer);
+    page->compressed_len = compressed_len;
+    page->uncompressed_len = uncompressed_len;
+
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
       const format::DictionaryPageHeader& dict_header =
           current_page_header_.dictionary_page_header;
       bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
-
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
+      const int32_t num_values = dict_header.num_values;
+      const Encoding::type encoding = LoadEnumSafe(&dict_header.encoding);
+
+      page->make_page = [num_values, encoding, is_sorted](
+                            std::shared_ptr<Buffer> buffer) -> std::shared_ptr<Page> {
+        return std::make_shared<DictionaryPage>(std::move(buffer), num_values, encoding,
+                                                is_sorted);
+      };
+      return true;
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DataPageV1>(
-          page_buffer, header.num_values, LoadEnumSafe(&header.encoding),
-          LoadEnumSafe(&header.definition_level_encoding),
-          LoadEnumSafe(&header.repetition_level_encoding), uncompressed_len,
-          std::move(data_page_statistics));
+      const int32_t num_values = header.num_values;
+      const Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      const Encoding::type definition_level_encoding =
+          LoadEnumSafe(&header.definition_level_encoding);
+      const Encoding::type repetition_level_encoding =
+          LoadEnumSafe(&header.repetition_level_encoding);
+
+      page->make_page = [num_values, encoding, definition_level_encoding,
+                         repetition_level_encoding, uncompressed_len,
+                         statistics = std::move(data_page_statistics)](
+                            std::shared_ptr<Buffer> buffer) -> std::shared_ptr<Page> {
+        return std::make_shared<DataPageV1>(
+            std::move(buffer), num_values, encoding, definition_level_encoding,
+            repetition_level_encoding, uncompressed_len, statistics);
+      };
+      return true;
     } else if (page_type == PageType::DATA_PAGE_V2) {
       ++page_ordinal_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
@@ -552,22 +788,33 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       }
       // DecompressIfNeeded doesn't take `is_compressed` into account as
       // it's page type-agnostic.
-      if (is_compressed) {
-        page_buffer = DecompressIfNeeded(std::move(page_buffer), compressed_len,
-                                         uncompressed_len, levels_byte_len);
-      }
-
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          std::move(data_page_statistics));
+      page->is_compressed = is_compressed;
+      page->levels_byte_len = levels_byte_len;
+
+      const int32_t num_values = header.num_values;
+      const int32_t num_nulls = header.num_nulls;
+      const int32_t num_rows = header.num_rows;
+      const Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      const int32_t definition_levels_byte_length = header.definition_levels_byte_length;
+      const int32_t repetition_levels_byte_length = header.repetition_levels_byte_length;
+
+      page->make_page = [num_values, num_nulls, num_rows, encoding,
+                         definition_levels_byte_length, repetition_levels_byte_length,
+                         uncompressed_len, is_compressed,
+                         statistics = std::move(data_page_statistics)](
+                            std::shared_ptr<Buffer> buffer) -> std::shared_ptr<Page> {
+        return std::make_shared<DataPageV2>(
+            std::move(buffer), num_values, num_nulls, num_rows, encoding,
+            definition_levels_byte_length, repetition_levels_byte_length,
+            uncompressed_len, is_compressed, statistics);
+      };
+      return true;
     } else {
       throw ParquetException(
           "Internal error, we have already skipped non-data pages in ShouldSkipPage()");
     }
   }
-  return std::shared_ptr<Page>(nullptr);
+  return false;
 }
 
 std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
@@ -576,41 +823,11 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   if (decompressor_ == nullptr) {
     return page_buffer;
   }
-  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
-    throw ParquetException("Invalid page header");
-  }
-
-  // Grow the uncompressed buffer if we need to.
-  PARQUET_THROW_NOT_OK(
-      decompression_buffer_->Resize(uncompressed_len, /*shrink_to_fit=*/false));
-
-  if (levels_byte_len > 0) {
-    // First copy the levels as-is
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
-    memcpy(decompressed, page_buffer->data(), levels_byte_len);
+  if (!reuse_buffers_) {
+    decompression_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
   }
-
-  // GH-31992: DataPageV2 may store only levels and no values when all
-  // values are null. In this case, Parquet java is known to produce a
-  // 0-len compressed area (which is invalid compressed input).
-  // See https://github.com/apache/parquet-java/issues/3122
-  int64_t decompressed_len = 0;
-  if (uncompressed_len - levels_byte_len != 0) {
-    // Decompress the values
-    PARQUET_ASSIGN_OR_THROW(
-        decompressed_len,
-        decompressor_->Decompress(
-            compressed_len - levels_byte_len, page_buffer->data() + levels_byte_len,
-            uncompressed_len - levels_byte_len,
-            decompression_buffer_->mutable_data() + levels_byte_len));
-  }
-
-  if (decompressed_len != uncompressed_len - levels_byte_len) {
-    throw ParquetException("Page didn't decompress to expected size, expected: " +
-                           std::to_string(uncompressed_len - levels_byte_len) +
-                           ", but got:" + std::to_string(decompressed_len));
-  }
-
+  DecompressPage(decompressor_.get(), *page_buffer, compressed_len, uncompressed_len,
+                 levels_byte_len, decompression_buffer_.get());
   return decompression_buffer_;
 }
 
@@ -2192,6 +2409,184 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
+/// ByteArrayViewRecordReader reads variable length byte array values into
+/// ::arrow::binary_view.
+///
+/// Values that do not fit inline reference the memory they were decoded from
+/// whenever it outlives the decoder: the data page (for PLAIN and
+/// DELTA_LENGTH_BYTE_ARRAY pages, if the page reader does not reuse its buffers)
+/// or the dictionary. Those buffers become variadic buffers of the output. Other
+/// values are copied.
+class ByteArrayViewRecordReader final : public TypedRecordReader<ByteArrayType>,
+                                        virtual public BinaryRecordReader {
+ public:
+  ByteArrayViewRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                            ::arrow::MemoryPool* pool, bool read_dense_for_nullable)
+      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool, read_dense_for_nullable),
+        null_bitmap_builder_(pool),
+        views_builder_(pool),
+        heap_builder_(pool) {
+    ARROW_DCHECK_EQ(descr_->physical_type(), Type::BYTE_ARRAY);
+  }
+
+  void SetPageReader(std::unique_ptr<PageReader> reader) override {
+    stable_page_buffers_ = reader != nullptr && reader->DisableBufferReuse();
+    TypedRecordReader<ByteArrayType>::SetPageReader(std::move(reader));
+  }
+
+  ::arrow::ArrayVector GetBuilderChunks() override {
+    FinishHeap();
+    const int64_t null_count = null_bitmap_builder_.false_count();
+    const int64_t length = null_bitmap_builder_.length();
+    ARROW_DCHECK_EQ(length, views_builder_.length());
+    PARQUET_ASSIGN_OR_THROW(auto views, views_builder_.Finish());
+    PARQUET_ASSIGN_OR_THROW(auto null_bitmap, null_bitmap_builder_.Finish());
+
+    std::vector<std::shared_ptr<Buffer>> buffers = {std::move(null_bitmap),
+                                                    std::move(views)};
+    buffers.insert(buffers.end(), std::make_move_iterator(data_buffers_.begin()),
+                   std::make_move_iterator(data_buffers_.end()));
+    data_buffers_.clear();
+    page_ = {};
+    dictionary_ = {};
+
+    auto chunk = ::arrow::MakeArray(::arrow::ArrayData::Make(
+        ::arrow::binary_view(), length, std::move(buffers), null_count));
+    return ::arrow::ArrayVector({std::move(chunk)});
+  }
+
+  void ReadValuesDense(int64_t values_to_read) override {
+    auto values = DecodeBuffer(values_to_read);
+    int64_t num_decoded =
+        this->current_decoder_->Decode(values, static_cast<int>(values_to_read));
+    CheckNumberDecoded(num_decoded, values_to_read);
+
+    PARQUET_THROW_NOT_OK(null_bitmap_builder_.Reserve(num_decoded));
+    PARQUET_THROW_NOT_OK(views_builder_.Reserve(num_decoded));
+    null_bitmap_builder_.UnsafeAppend(num_decoded, /*value=*/true);
+    UpdateSourceBuffers();
+    for (int64_t i = 0; i < num_decoded; i++) {
+      views_builder_.UnsafeAppend(MakeView(values[i]));
+    }
+    ResetValues();
+  }
+
+  void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
+    uint8_t* valid_bits = valid_bits_->mutable_data();
+    const int64_t valid_bits_offset = values_written_;
+    auto values = DecodeBuffer(values_to_read);
+
+    int64_t num_decoded = this->current_decoder_->DecodeSpaced(
+        values, static_cast<int>(values_to_read), static_cast<int>(null_count),
+        valid_bits, valid_bits_offset);
+    ARROW_DCHECK_EQ(num_decoded, values_to_read);
+
+    PARQUET_THROW_NOT_OK(null_bitmap_builder_.Reserve(num_decoded));
+    PARQUET_THROW_NOT_OK(views_builder_.Reserve(num_decoded));
+    null_bitmap_builder_.UnsafeAppend(valid_bits, valid_bits_offset, num_decoded);
+    UpdateSourceBuffers();
+    for (int64_t i = 0; i < num_decoded; i++) {
+      if (null_count == 0 ||
+          ::arrow::bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+        views_builder_.UnsafeAppend(MakeView(values[i]));
+      } else {
+        views_builder_.UnsafeAppend(::arrow::BinaryViewType::c_type{});
+      }
+    }
+    ResetValues();
+  }
+
+ private:
+  // A buffer decoded values may point into, and its index among the variadic
+  // buffers of the current chunk (-1 until a value references it)
+  struct SourceBuffer {
+    std::shared_ptr<Buffer> buffer;
+    int32_t index = -1;
+
+    bool Contains(const ByteArray& value) const {
+      return buffer != nullptr && value.ptr >= buffer->data() &&
+             value.ptr + value.len <= buffer->data() + buffer->size();
+    }
+  };
+
+  ByteArray* DecodeBuffer(int64_t num_values) {
+    if (decode_buffer_.size() < static_cast<size_t>(num_values)) {
+      decode_buffer_.resize(static_cast<size_t>(num_values));
+    }
+    return decode_buffer_.data();
+  }
+
+  // Track the buffers the current decoder produces values from
+  void UpdateSourceBuffers() {
+    std::shared_ptr<Buffer> page_buffer;
+    if (stable_page_buffers_ && this->current_page_ != nullptr) {
+      page_buffer = this->current_page_->buffer();
+    }
+    if (page_buffer != page_.buffer) {
+      page_ = {std::move(page_buffer)};
+    }
+
+    std::shared_ptr<Buffer> dictionary_buffer;
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
+      dictionary_buffer = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_)
+                              ->GetDictionaryData();
+    }
+    if (dictionary_buffer != dictionary_.buffer) {
+      dictionary_ = {std::move(dictionary_buffer)};
+    }
+  }
+
+  ::arrow::BinaryViewType::c_type MakeView(const ByteArray& value) {
+    const auto length = static_cast<int32_t>(value.len);
+    if (length <= ::arrow::BinaryViewType::kInlineSize) {
+      return ::arrow::util::ToInlineBinaryView(value.ptr, length);
+    }
+    for (SourceBuffer* source : {&page_, &dictionary_}) {
+      if (source->Contains(value)) {
+        if (source->index < 0) {
+          source->index = static_cast<int32_t>(data_buffers_.size());
+          data_buffers_.push_back(source->buffer);
+        }
+        return ::arrow::util::ToNonInlineBinaryView(
+            value.ptr, length, source->index,
+            static_cast<int32_t>(value.ptr - source->buffer->data()));
+      }
+    }
+    // The value lives in memory owned by the decoder, copy it
+    if (heap_index_ < 0 ||
+        heap_builder_.length() + length > std::numeric_limits<int32_t>::max()) {
+      FinishHeap();
+      heap_index_ = static_cast<int32_t>(data_buffers_.size());
+      // Filled in by FinishHeap()
+      data_buffers_.emplace_back();
+    }
+    const auto offset = static_cast<int32_t>(heap_builder_.length());
+    PARQUET_THROW_NOT_OK(heap_builder_.Append(value.ptr, length));
+    return ::arrow::util::ToNonInlineBinaryView(value.ptr, length, heap_index_, offset);
+  }
+
+  void FinishHeap() {
+    if (heap_index_ >= 0) {
+      PARQUET_ASSIGN_OR_THROW(data_buffers_[heap_index_], heap_builder_.Finish());
+      heap_index_ = -1;
+    }
+  }
+
+  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+
+  bool stable_page_buffers_ = false;
+  std::vector<ByteArray> decode_buffer_;
+  ::arrow::TypedBufferBuilder<bool> null_bitmap_builder_;
+  ::arrow::TypedBufferBuilder<::arrow::BinaryViewType::c_type> views_builder_;
+  // Variadic buffers of the current chunk
+  std::vector<std::shared_ptr<Buffer>> data_buffers_;
+  SourceBuffer page_;
+  SourceBuffer dictionary_;
+  // Holds the values that had to be copied, at index heap_index_ of data_buffers_
+  ::arrow::BufferBuilder heap_builder_;
+  int32_t heap_index_ = -1;
+};
+
 // TODO(wesm): Implement these to some satisfaction
 template <>
 void TypedRecordReader<Int96Type>::DebugPrintState() {}
@@ -2206,8 +2601,12 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         LevelInfo leaf_info,
                                                         ::arrow::MemoryPool* pool,
                                                         bool read_dictionary,
-                                                        bool read_dense_for_nullable) {
-  if (read_dictionary) {
+                                                        bool read_dense_for_nullable,
+                                                        bool read_binary_view) {
+  if (read_binary_view) {
+    return std::make_shared<ByteArrayViewRecordReader>(descr, leaf_info, pool,
+                                                       read_dense_for_nullable);
+  } else if (read_dictionary) {
     return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool,
                                                              read_dense_for_nullable);
   } else {
@@ -2221,7 +2620,8 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  LevelInfo leaf_info, MemoryPool* pool,
                                                  bool read_dictionary,
-                                                 bool read_dense_for_nullable) {
+                                                 bool read_dense_for_nullable,
+                                                 bool read_binary_view) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool,
@@ -2243,7 +2643,7 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                              read_dense_for_nullable);
     case Type::BYTE_ARRAY: {
       return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary,
-                                       read_dense_for_nullable);
+                                       read_dense_for_nullable, read_binary_view);
     }
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, leaf_info, pool,
@@ -150,6 +150,16 @@ class PARQUET_EXPORT PageReader {
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
 
+  /// \brief Allocate fresh memory for each page instead of reusing it, so
+  /// that the buffer of a page remains valid after the next call to NextPage().
+  ///
+  /// This lets decoded values reference page memory instead of copying it.
+  ///
+  /// \return false if not supported, in which case page buffers must not be
+  /// retained
+  /// \note API EXPERIMENTAL
+  virtual bool DisableBufferReuse() { return false; }
+
  protected:
   // Callback that decides if we should skip a page or not.
   DataPageFilter data_page_filter_;
@@ -267,10 +277,14 @@ class PARQUET_EXPORT RecordReader {
   /// @param read_dictionary True if reading directly as Arrow dictionary-encoded
   /// @param read_dense_for_nullable True if reading dense and not leaving space for null
   /// values
+  /// @param read_binary_view True if reading BYTE_ARRAY values as Arrow binary_view,
+  /// referencing page and dictionary memory where possible. Takes precedence over
+  /// read_dictionary.
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr, LevelInfo leaf_info,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      bool read_dictionary = false, bool read_dense_for_nullable = false);
+      bool read_dictionary = false, bool read_dense_for_nullable = false,
+      bool read_binary_view = false);
 
   virtual ~RecordReader() = default;
 
@@ -1089,6 +1089,11 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
 int64_t ColumnWriterImpl::Close() {
   if (!closed_) {
     closed_ = true;
+    // Write all outstanding data to a new page first: with adaptive encoding,
+    // this may be the page that decides whether the dictionary is used.
+    if (num_buffered_values_ > 0) {
+      AddDataPage();
+    }
     if (has_dictionary_ && !fallback_) {
       WriteDictionaryPage();
     }
@@ -1189,6 +1194,34 @@ inline void DoInBatches(const int16_t* def_levels, const int16_t* rep_levels,
   }
 }
 
+// Number of levels to write between page size checks for a binary array. Batches
+// of write_batch_size large values could make pages far larger than the data page
+// size, so the batches hold about a page of values at most.
+int64_t ByteArrayWriteBatchSize(const ::arrow::Array& array, int64_t num_levels,
+                                const WriterProperties& properties) {
+  int64_t values_length;
+  switch (array.type_id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+      values_length =
+          checked_cast<const ::arrow::BinaryArray&>(array).total_values_length();
+      break;
+    case ::arrow::Type::LARGE_BINARY:
+    case ::arrow::Type::LARGE_STRING:
+      values_length =
+          checked_cast<const ::arrow::LargeBinaryArray&>(array).total_values_length();
+      break;
+    default:
+      return properties.write_batch_size();
+  }
+  if (num_levels == 0 || values_length <= properties.data_pagesize()) {
+    return properties.write_batch_size();
+  }
+  const int64_t level_bytes = bit_util::CeilDiv(values_length, num_levels);
+  return std::clamp<int64_t>(properties.data_pagesize() / level_bytes, 1,
+                             properties.write_batch_size());
+}
+
 bool DictionaryDirectWriteSupported(const ::arrow::Array& array) {
   DCHECK_EQ(array.type_id(), ::arrow::Type::DICTIONARY);
   const ::arrow::DictionaryType& dict_type =
@@ -1209,6 +1242,52 @@ Status ConvertDictionaryToDense(const ::arrow::Array& array, MemoryPool* pool,
   return Status::OK();
 }
 
+// Non-dictionary encodings tried by adaptive encoding for the given column
+std::vector<Encoding::type> AdaptiveEncodingCandidates(
+    const ColumnDescriptor* descr, const WriterProperties* properties) {
+  if (properties->version() == ParquetVersion::PARQUET_1_0) {
+    return {Encoding::PLAIN};
+  }
+  switch (descr->physical_type()) {
+    case Type::BOOLEAN:
+      return {Encoding::PLAIN, Encoding::RLE};
+    case Type::INT32:
+    case Type::INT64:
+      return {Encoding::PLAIN, Encoding::DELTA_BINARY_PACKED,
+              Encoding::BYTE_STREAM_SPLIT};
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      return {Encoding::PLAIN, Encoding::BYTE_STREAM_SPLIT};
+    case Type::BYTE_ARRAY:
+      return {Encoding::PLAIN, Encoding::DELTA_LENGTH_BYTE_ARRAY,
+              Encoding::DELTA_BYTE_ARRAY};
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return {Encoding::PLAIN, Encoding::DELTA_BYTE_ARRAY, Encoding::BYTE_STREAM_SPLIT};
+    default:
+      return {Encoding::PLAIN};
+  }
+}
+
+// Relative cost of decoding values with the given encoding, used by
+// AdaptiveEncodingPolicy::FastestDecode
+int AdaptiveEncodingDecodeCost(Encoding::type encoding) {
+  switch (encoding) {
+    case Encoding::PLAIN:
+      return 0;
+    case Encoding::BYTE_STREAM_SPLIT:
+      return 1;
+    case Encoding::RLE:
+    case Encoding::PLAIN_DICTIONARY:
+    case Encoding::RLE_DICTIONARY:
+      return 2;
+    case Encoding::DELTA_BINARY_PACKED:
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      return 3;
+    default:
+      return 4;
+  }
+}
+
 template <typename ParquetType>
 class TypedColumnWriterImpl : public ColumnWriterImpl,
                               public TypedColumnWriter<ParquetType> {
@@ -1230,6 +1309,16 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     current_dict_encoder_ =
         dynamic_cast<DictEncoder<ParquetType>*>(current_encoder_.get());
 
+    if (properties->adaptive_encoding_enabled(descr_->path())) {
+      for (Encoding::type candidate : AdaptiveEncodingCandidates(descr_, properties)) {
+        if (candidate == current_encoder_->encoding()) continue;
+        auto encoder = MakeEncoder(ParquetType::type_num, candidate,
+                                   /*use_dictionary=*/false, descr_, allocator_);
+        auto value_encoder = dynamic_cast<ValueEncoderType*>(encoder.get());
+        encoding_candidates_.push_back({std::move(encoder), value_encoder});
+      }
+    }
+
     if (properties->statistics_enabled(descr_->path()) &&
         (SortOrder::UNKNOWN != descr_->sort_order())) {
       page_statistics_ = MakeStatistics<ParquetType>(descr_, allocator_);
@@ -1353,6 +1442,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
  protected:
   std::shared_ptr<Buffer> GetValuesBuffer() override {
+    if (!encoding_candidates_.empty()) {
+      return ChooseEncoding();
+    }
     return current_encoder_->FlushValues();
   }
 
@@ -1490,6 +1582,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   // to virtual inheritance.
   ValueEncoderType* current_value_encoder_;
   DictEncoder<ParquetType>* current_dict_encoder_;
+
+  // With adaptive encoding, the encoders trying the other candidate encodings
+  // on the first data page of the column chunk
+  struct EncodingCandidate {
+    std::unique_ptr<Encoder> encoder;
+    ValueEncoderType* value_encoder;
+  };
+  std::vector<EncodingCandidate> encoding_candidates_;
+
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
   std::unique_ptr<SizeStatistics> page_size_statistics_;
@@ -1680,7 +1781,98 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     }
   }
 
+  // Replace the current encoder with a candidate encoder, which has been fed
+  // the same values
+  void UseEncoder(std::unique_ptr<Encoder> encoder) {
+    if constexpr (std::is_same_v<T, ByteArray>) {
+      // Already accounted for by the previous encoder
+      encoder->ReportUnencodedDataBytes();
+    }
+    current_encoder_ = std::move(encoder);
+    current_value_encoder_ = dynamic_cast<ValueEncoderType*>(current_encoder_.get());
+    current_dict_encoder_ =
+        dynamic_cast<DictEncoder<ParquetType>*>(current_encoder_.get());
+    if (current_dict_encoder_ == nullptr) {
+      has_dictionary_ = false;
+    }
+    encoding_ = current_encoder_->encoding();
+  }
+
+  // Called when the first data page is complete while trying out candidate
+  // encodings. Keeps the encoder preferred by the adaptive encoding policy and
+  // returns the page values it encoded.
+  std::shared_ptr<Buffer> ChooseEncoding() {
+    std::vector<std::unique_ptr<Encoder>> encoders;
+    encoders.push_back(std::move(current_encoder_));
+    for (auto& candidate : encoding_candidates_) {
+      encoders.push_back(std::move(candidate.encoder));
+    }
+    encoding_candidates_.clear();
+
+    auto stored_size = [&](const Buffer& buffer) -> int64_t {
+      if (!pager_->has_compressor() || buffer.size() == 0) {
+        return buffer.size();
+      }
+      pager_->Compress(buffer, compressor_temp_buffer_.get());
+      return compressor_temp_buffer_->size();
+    };
+
+    std::vector<std::shared_ptr<Buffer>> values(encoders.size());
+    std::vector<int64_t> sizes(encoders.size());
+    for (size_t i = 0; i < encoders.size(); ++i) {
+      values[i] = encoders[i]->FlushValues();
+      sizes[i] = stored_size(*values[i]);
+      auto dict_encoder = dynamic_cast<DictEncoder<ParquetType>*>(encoders[i].get());
+      if (dict_encoder != nullptr) {
+        // The dictionary page is written once per column chunk, but is
+        // usually filled in by the first pages
+        std::shared_ptr<ResizableBuffer> dictionary =
+            AllocateBuffer(allocator_, dict_encoder->dict_encoded_size());
+        dict_encoder->WriteDict(dictionary->mutable_data());
+        sizes[i] += stored_size(*dictionary);
+      }
+    }
+
+    const int64_t smallest_size = *std::min_element(sizes.begin(), sizes.end());
+    size_t chosen = 0;
+    for (size_t i = 1; i < encoders.size(); ++i) {
+      if (properties_->adaptive_encoding_policy() ==
+          AdaptiveEncodingPolicy::FastestDecode) {
+        const int64_t max_size = smallest_size + smallest_size / 10;
+        const int cost = AdaptiveEncodingDecodeCost(encoders[i]->encoding());
+        const int chosen_cost = AdaptiveEncodingDecodeCost(encoders[chosen]->encoding());
+        if (sizes[i] <= max_size &&
+            (sizes[chosen] > max_size || cost < chosen_cost ||
+             (cost == chosen_cost && sizes[i] < sizes[chosen]))) {
+          chosen = i;
+        }
+      } else if (sizes[i] < sizes[chosen]) {
+        chosen = i;
+      }
+    }
+    if (chosen != 0) {
+      UseEncoder(std::move(encoders[chosen]));
+    } else {
+      current_encoder_ = std::move(encoders[0]);
+    }
+    return values[chosen];
+  }
+
   void FallbackToPlainEncoding() {
+    if (IsDictionaryIndexEncoding(current_encoder_->encoding()) &&
+        !encoding_candidates_.empty()) {
+      // Still trying out encodings on the first data page: no page refers to the
+      // dictionary yet, so it can be dropped for the PLAIN candidate.
+      auto it = std::find_if(encoding_candidates_.begin(), encoding_candidates_.end(),
+                             [](const EncodingCandidate& candidate) {
+                               return candidate.encoder->encoding() == Encoding::PLAIN;
+                             });
+      DCHECK(it != encoding_candidates_.end());
+      std::unique_ptr<Encoder> plain_encoder = std::move(it->encoder);
+      encoding_candidates_.erase(it);
+      UseEncoder(std::move(plain_encoder));
+      return;
+    }
     if (IsDictionaryIndexEncoding(current_encoder_->encoding())) {
       WriteDictionaryPage();
       // Serialize the buffered Dictionary Indices
@@ -1716,6 +1908,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
     current_value_encoder_->Put(values, static_cast<int>(num_values));
+    for (auto& candidate : encoding_candidates_) {
+      candidate.value_encoder->Put(values, static_cast<int>(num_values));
+    }
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
@@ -1741,8 +1936,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     if (num_values != num_spaced_values) {
       current_value_encoder_->PutSpaced(values, static_cast<int>(num_spaced_values),
                                         valid_bits, valid_bits_offset);
+      for (auto& candidate : encoding_candidates_) {
+        candidate.value_encoder->PutSpaced(values, static_cast<int>(num_spaced_values),
+                                           valid_bits, valid_bits_offset);
+      }
     } else {
       current_value_encoder_->Put(values, static_cast<int>(num_values));
+      for (auto& candidate : encoding_candidates_) {
+        candidate.value_encoder->Put(values, static_cast<int>(num_values));
+      }
     }
     if (page_statistics_ != nullptr) {
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset,
@@ -1855,6 +2057,9 @@ Status TypedColumnWriterImpl<ParquetType>::WriteArrowDictionary(
     value_offset += batch_num_spaced_values;
   };
 
+  // Dictionary-encoded input is written as is, stop trying out other encodings
+  encoding_candidates_.clear();
+
   // Handle seeing dictionary for the first time
   if (!preserved_dictionary_) {
     // It's a new dictionary. Call PutDictionary and keep track of it
@@ -2298,6 +2503,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
         data_slice, MaybeReplaceValidity(data_slice, null_count, ctx->memory_pool));
 
     current_encoder_->Put(*data_slice);
+    for (auto& candidate : encoding_candidates_) {
+      candidate.encoder->Put(*data_slice);
+    }
     // Null values in ancestors count as nulls.
     const int64_t non_null = data_slice->length() - data_slice->null_count();
     if (page_statistics_ != nullptr) {
@@ -2312,9 +2520,10 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     value_offset += batch_num_spaced_values;
   };
 
-  PARQUET_CATCH_NOT_OK(DoInBatches(def_levels, rep_levels, num_levels,
-                                   properties_->write_batch_size(), WriteChunk,
-                                   pages_change_on_record_boundaries()));
+  PARQUET_CATCH_NOT_OK(
+      DoInBatches(def_levels, rep_levels, num_levels,
+                  ByteArrayWriteBatchSize(array, num_levels, *properties_), WriteChunk,
+                  pages_change_on_record_boundaries()));
   return Status::OK();
 }
 
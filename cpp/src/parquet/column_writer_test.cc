@@ -120,6 +120,9 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
       wp_builder.disable_dictionary();
       wp_builder.encoding(column_properties.encoding());
     }
+    if (column_properties.adaptive_encoding_enabled()) {
+      wp_builder.enable_adaptive_encoding();
+    }
     if (enable_checksum) {
       wp_builder.enable_page_checksum();
     }
@@ -271,6 +274,39 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
     }
   }
 
+  // Write values_ with adaptive encoding and return the encodings of the data pages
+  std::set<Encoding::type> WriteAdaptiveEncoding(
+      ParquetDataPageVersion data_page_version = ParquetDataPageVersion::V1) {
+    ColumnProperties column_properties;
+    column_properties.set_encoding(Encoding::RLE_DICTIONARY);
+    column_properties.set_adaptive_encoding_enabled(true);
+    auto writer =
+        this->BuildWriter(static_cast<int64_t>(this->values_.size()), column_properties,
+                          ParquetVersion::PARQUET_2_6, data_page_version);
+    writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+    writer->Close();
+
+    std::set<Encoding::type> data_encodings;
+    for (const auto& stats : this->metadata_encoding_stats()) {
+      if (stats.page_type != PageType::DICTIONARY_PAGE) {
+        data_encodings.insert(stats.encoding);
+      }
+    }
+    return data_encodings;
+  }
+
+  void TestAdaptiveEncoding(int64_t num_rows, ParquetDataPageVersion data_page_version) {
+    this->GenerateData(num_rows);
+    std::set<Encoding::type> data_encodings = WriteAdaptiveEncoding(data_page_version);
+    // A single encoding is chosen for all data pages
+    ASSERT_EQ(1U, data_encodings.size());
+
+    this->SetupValuesOut(num_rows);
+    this->ReadColumnFully();
+    ASSERT_EQ(num_rows, this->values_read_);
+    ASSERT_EQ(this->values_, this->values_out_);
+  }
+
   void WriteRequiredWithSettings(Encoding::type encoding, Compression::type compression,
                                  bool enable_dictionary, bool enable_statistics,
                                  int compression_level, int64_t num_rows,
@@ -749,6 +785,33 @@ TYPED_TEST(TestPrimitiveWriter, DictionaryFallbackVersion2_0) {
                                        ParquetDataPageVersion::V2);
 }
 
+TYPED_TEST(TestPrimitiveWriter, AdaptiveEncoding) {
+  for (auto data_page_version :
+       {ParquetDataPageVersion::V1, ParquetDataPageVersion::V2}) {
+    this->TestAdaptiveEncoding(SMALL_SIZE, data_page_version);
+    // The dictionary of random values outgrows its limit on the first page
+    this->TestAdaptiveEncoding(VERY_LARGE_SIZE, data_page_version);
+  }
+}
+
+TEST_F(TestValuesWriterInt64Type, AdaptiveEncodingChoosesSmallest) {
+  // Increasing values, all distinct
+  this->values_.resize(LARGE_SIZE);
+  for (int i = 0; i < LARGE_SIZE; i++) {
+    this->values_[i] = 1000000007LL * 1000 + i * 3;
+  }
+  this->values_ptr_ = this->values_.data();
+  EXPECT_EQ(this->WriteAdaptiveEncoding(),
+            std::set<Encoding::type>{Encoding::DELTA_BINARY_PACKED});
+
+  // Few distinct values
+  for (int i = 0; i < LARGE_SIZE; i++) {
+    this->values_[i] = (i % 5) * 1000000007LL;
+  }
+  EXPECT_EQ(this->WriteAdaptiveEncoding(),
+            std::set<Encoding::type>{Encoding::RLE_DICTIONARY});
+}
+
 TEST(TestWriter, NullValuesBuffer) {
   std::shared_ptr<::arrow::io::BufferOutputStream> sink = CreateOutputStream();
 
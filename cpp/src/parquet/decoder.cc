@@ -38,6 +38,7 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/byte_stream_split_internal.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/delta_prefix_sum_internal.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/rle_encoding_internal.h"
@@ -822,16 +823,9 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       ParquetException::EofException();
     }
 
-    // XXX(wesm): Cannot append "valid bits" directly to the builder
-    std::vector<uint8_t> valid_bytes(num_values, 0);
-    size_t i = 0;
-    VisitNullBitmapInline(
-        valid_bits, valid_bits_offset, num_values, null_count,
-        [&]() { valid_bytes[i++] = 1; }, [&]() { ++i; });
-
     auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values,
+                                                       valid_bits, valid_bits_offset));
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -868,6 +862,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     *dictionary = dictionary_->mutable_data_as<T>();
   }
 
+  std::shared_ptr<Buffer> GetDictionaryData() override { return byte_array_data_; }
+
  protected:
   Status IndexInBounds(int32_t index) const {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
@@ -876,6 +872,21 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     return Status::Invalid("Index not in dictionary bounds");
   }
 
+  // Decode values into the scratch space, null entries included. Runs of
+  // repeated indices are filled, and literal runs gathered at once.
+  const T* DecodeSpacedToScratch(int num_values, int null_count,
+                                 const uint8_t* valid_bits, int64_t valid_bits_offset) {
+    PARQUET_THROW_NOT_OK(
+        indices_scratch_space_->TypedResize<T>(num_values, /*shrink_to_fit=*/false));
+    auto* values = indices_scratch_space_->mutable_data_as<T>();
+    if (num_values != idx_decoder_.GetBatchWithDictSpaced(
+                          dictionary_->data_as<T>(), dictionary_length_, values,
+                          num_values, null_count, valid_bits, valid_bits_offset)) {
+      ParquetException::EofException();
+    }
+    return values;
+  }
+
   inline void DecodeDict(TypedDecoder<Type>* dictionary) {
     dictionary_length_ = static_cast<int32_t>(dictionary->values_left());
     PARQUET_THROW_NOT_OK(dictionary_->Resize(dictionary_length_ * sizeof(T),
@@ -900,7 +911,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   std::shared_ptr<ResizableBuffer> byte_array_offsets_;
 
   // Reusable buffer for decoding dictionary indices to be appended to a
-  // BinaryDictionary32Builder
+  // BinaryDictionary32Builder, or values to be appended to other builders
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   ::arrow::util::RleDecoder idx_decoder_;
@@ -996,19 +1007,16 @@ int DictDecoderImpl<DType>::DecodeArrow(
     typename EncodingTraits<DType>::DictAccumulator* builder) {
   PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
 
-  const auto* dict_values = dictionary_->data_as<typename DType::c_type>();
-
+  const auto* values = DecodeSpacedToScratch(num_values, null_count, valid_bits,
+                                             valid_bits_offset);
+  int64_t i = 0;
   VisitNullBitmapInline(
       valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() { PARQUET_THROW_NOT_OK(builder->Append(values[i++])); },
       [&]() {
-        int32_t index;
-        if (ARROW_PREDICT_FALSE(!idx_decoder_.Get(&index))) {
-          throw ParquetException("");
-        }
-        PARQUET_THROW_NOT_OK(IndexInBounds(index));
-        PARQUET_THROW_NOT_OK(builder->Append(dict_values[index]));
-      },
-      [&]() { PARQUET_THROW_NOT_OK(builder->AppendNull()); });
+        ++i;
+        PARQUET_THROW_NOT_OK(builder->AppendNull());
+      });
 
   return num_values - null_count;
 }
@@ -1086,23 +1094,14 @@ template <typename Type>
 int DictDecoderImpl<Type>::DecodeArrow(
     int num_values, int null_count, const uint8_t* valid_bits, int64_t valid_bits_offset,
     typename EncodingTraits<Type>::Accumulator* builder) {
-  PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
-
-  using value_type = typename Type::c_type;
-  const auto* dict_values = dictionary_->data_as<value_type>();
-
-  VisitNullBitmapInline(
-      valid_bits, valid_bits_offset, num_values, null_count,
-      [&]() {
-        int32_t index;
-        if (ARROW_PREDICT_FALSE(!idx_decoder_.Get(&index))) {
-          throw ParquetException("");
-        }
-        PARQUET_THROW_NOT_OK(IndexInBounds(index));
-        builder->UnsafeAppend(dict_values[index]);
-      },
-      [&]() { builder->UnsafeAppendNull(); });
-
+  const auto* values = DecodeSpacedToScratch(num_values, null_count, valid_bits,
+                                             valid_bits_offset);
+  if (null_count == 0) {
+    PARQUET_THROW_NOT_OK(builder->AppendValues(values, num_values));
+  } else {
+    PARQUET_THROW_NOT_OK(
+        builder->AppendValues(values, num_values, valid_bits, valid_bits_offset));
+  }
   return num_values - null_count;
 }
 
@@ -1348,7 +1347,6 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, public TypedDecoderImpl<DType> {
  public:
   typedef typename DType::c_type T;
-  using UT = std::make_unsigned_t<T>;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
@@ -1531,17 +1529,18 @@ class DeltaBitPackDecoder : public DecoderImpl, public TypedDecoderImpl<DType> {
 
       int values_decode = std::min(values_remaining_current_mini_block_,
                                    static_cast<uint32_t>(max_values - i));
-      if (decoder_->GetBatch(delta_bit_width_, buffer + i, values_decode) !=
-          values_decode) {
+      if (delta_bit_width_ == 0) {
+        // All deltas are equal to min_delta (e.g. sequential ids or regularly spaced
+        // timestamps), so there is nothing to unpack
+        std::fill(buffer + i, buffer + i + values_decode, T{0});
+      } else if (decoder_->GetBatch(delta_bit_width_, buffer + i, values_decode) !=
+                 values_decode) {
         ParquetException::EofException();
       }
-      for (int j = 0; j < values_decode; ++j) {
-        // Addition between min_delta, packed int and last_value should be treated as
-        // unsigned addition. Overflow is as expected.
-        buffer[i + j] = static_cast<UT>(min_delta_) + static_cast<UT>(buffer[i + j]) +
-                        static_cast<UT>(last_value_);
-        last_value_ = buffer[i + j];
-      }
+      // Addition between min_delta, packed int and last_value should be treated as
+      // unsigned addition. Overflow is as expected.
+      ::arrow::internal::DeltaPrefixSum(buffer + i, values_decode, min_delta_,
+                                        &last_value_);
       values_remaining_current_mini_block_ -= values_decode;
       i += values_decode;
     }
@@ -370,6 +370,16 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   ///
   /// \note API EXPERIMENTAL
   virtual void GetDictionary(const T** dictionary, int32_t* dictionary_length) = 0;
+
+  /// \brief Get the buffer holding the bytes the dictionary values of
+  /// BYTE_ARRAY and FIXED_LEN_BYTE_ARRAY types point into.
+  ///
+  /// The buffer is not modified unless SetDict() is called again, so it can be
+  /// retained to reference dictionary values past the lifetime of the decoder.
+  /// Returns null if not supported.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual std::shared_ptr<Buffer> GetDictionaryData() { return NULLPTR; }
 };
 
 // ----------------------------------------------------------------------
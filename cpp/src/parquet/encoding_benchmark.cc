@@ -1092,6 +1092,98 @@ static void BM_DictEncodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictEncodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+template <typename Type>
+static std::vector<typename Type::c_type> RandomDictValues(int64_t num_values,
+                                                           int32_t dictionary_length) {
+  std::default_random_engine gen(1337);
+  std::uniform_int_distribution<int32_t> dist(0, dictionary_length - 1);
+  std::vector<typename Type::c_type> values(num_values);
+  for (auto& value : values) {
+    value = static_cast<typename Type::c_type>(dist(gen));
+  }
+  return values;
+}
+
+static void DictRandomIndicesArgs(benchmark::internal::Benchmark* bench) {
+  // Dictionaries which fit in a SIMD register, and larger ones
+  bench->ArgNames({"num_values", "dict_length"});
+  for (int64_t dictionary_length : {4, 8, 1024}) {
+    bench->Args({MAX_RANGE, dictionary_length});
+  }
+}
+
+// Literal runs of random dictionary indices
+template <typename Type>
+static void BM_DictDecodingRandomIndices(benchmark::State& state) {
+  DecodeDict<Type>(
+      RandomDictValues<Type>(state.range(0), static_cast<int32_t>(state.range(1))),
+      state);
+}
+
+BENCHMARK_TEMPLATE(BM_DictDecodingRandomIndices, Int32Type)
+    ->Apply(DictRandomIndicesArgs);
+BENCHMARK_TEMPLATE(BM_DictDecodingRandomIndices, Int64Type)
+    ->Apply(DictRandomIndicesArgs);
+BENCHMARK_TEMPLATE(BM_DictDecodingRandomIndices, DoubleType)
+    ->Apply(DictRandomIndicesArgs);
+
+// Literal runs of random dictionary indices, decoded to an Arrow array
+// with some nulls
+template <typename Type>
+static void BM_DictDecodingArrowRandomIndices(benchmark::State& state) {
+  using T = typename Type::c_type;
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  const auto values =
+      RandomDictValues<Type>(state.range(0), static_cast<int32_t>(state.range(1)));
+  const int num_values = static_cast<int>(values.size());
+
+  std::shared_ptr<ColumnDescriptor> descr = Int64Schema(Repetition::OPTIONAL);
+  auto base_encoder = MakeEncoder(Type::type_num, Encoding::PLAIN,
+                                  /*use_dictionary=*/true, descr.get());
+  auto encoder =
+      dynamic_cast<typename EncodingTraits<Type>::Encoder*>(base_encoder.get());
+  auto dict_traits = dynamic_cast<DictEncoder<Type>*>(base_encoder.get());
+  encoder->Put(values.data(), num_values);
+  std::shared_ptr<ResizableBuffer> dict_buffer =
+      AllocateBuffer(default_memory_pool(), dict_traits->dict_encoded_size());
+  dict_traits->WriteDict(dict_buffer->mutable_data());
+  std::shared_ptr<Buffer> indices = encoder->FlushValues();
+
+  // Every tenth value is null
+  std::vector<uint8_t> valid_bits(::arrow::bit_util::BytesForBits(num_values));
+  int null_count = 0;
+  for (int i = 0; i < num_values; ++i) {
+    const bool is_valid = (i % 10) != 0;
+    ::arrow::bit_util::SetBitTo(valid_bits.data(), i, is_valid);
+    null_count += !is_valid;
+  }
+
+  for (auto _ : state) {
+    auto dict_decoder = MakeTypedDecoder<Type>(Encoding::PLAIN, descr.get());
+    dict_decoder->SetData(dict_traits->num_entries(), dict_buffer->data(),
+                          static_cast<int>(dict_buffer->size()));
+    auto decoder = MakeDictDecoder<Type>(descr.get());
+    decoder->SetDict(dict_decoder.get());
+    decoder->SetData(num_values, indices->data(), static_cast<int>(indices->size()));
+
+    ::arrow::NumericBuilder<ArrowType> builder;
+    decoder->DecodeArrow(num_values, null_count, valid_bits.data(), 0, &builder);
+    std::shared_ptr<::arrow::Array> result;
+    PARQUET_THROW_NOT_OK(builder.Finish(&result));
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetBytesProcessed(state.iterations() * num_values * sizeof(T));
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+BENCHMARK_TEMPLATE(BM_DictDecodingArrowRandomIndices, Int32Type)
+    ->Apply(DictRandomIndicesArgs);
+BENCHMARK_TEMPLATE(BM_DictDecodingArrowRandomIndices, Int64Type)
+    ->Apply(DictRandomIndicesArgs);
+BENCHMARK_TEMPLATE(BM_DictDecodingArrowRandomIndices, DoubleType)
+    ->Apply(DictRandomIndicesArgs);
+
 static void BM_DictDecodingByteArray(benchmark::State& state) {
   ::arrow::random::RandomArrayGenerator rag(0);
   // Using arrow generator to generate random data.
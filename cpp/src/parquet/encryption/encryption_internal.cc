@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -97,10 +98,41 @@ class AesCryptoContext {
     return ctx;
   }
 
+  // Creates a context initialized with the cipher, but no key or IV yet
+  [[nodiscard]] virtual CipherContext MakeCipherContext() const = 0;
+
+  // Returns a context initialized with the cipher, for the exclusive use of the
+  // caller. Setting up a context costs about as much as processing a page header,
+  // so contexts are reused: once done, callers give them back with
+  // ReleaseCipherContext(), and the next operation only sets a new key and IV.
+  // This also allows using this object from several threads at once.
+  [[nodiscard]] CipherContext AcquireCipherContext() const {
+    {
+      std::lock_guard<std::mutex> lock(cipher_contexts_mutex_);
+      if (!cipher_contexts_.empty()) {
+        CipherContext ctx = std::move(cipher_contexts_.back());
+        cipher_contexts_.pop_back();
+        return ctx;
+      }
+    }
+    return MakeCipherContext();
+  }
+
+  // Gives back a context after a successful operation. Contexts of failed
+  // operations are dropped instead, as they may be in an unexpected state.
+  void ReleaseCipherContext(CipherContext ctx) const {
+    std::lock_guard<std::mutex> lock(cipher_contexts_mutex_);
+    cipher_contexts_.push_back(std::move(ctx));
+  }
+
   int32_t aes_mode_;
   int32_t key_length_;
   int32_t ciphertext_size_delta_;
   int32_t length_buffer_length_;
+
+ private:
+  mutable std::mutex cipher_contexts_mutex_;
+  mutable std::vector<CipherContext> cipher_contexts_;
 };
 
 class AesEncryptor::AesEncryptorImpl : public AesCryptoContext {
@@ -132,7 +164,7 @@ class AesEncryptor::AesEncryptorImpl : public AesCryptoContext {
   }
 
  private:
-  [[nodiscard]] CipherContext MakeCipherContext() const;
+  [[nodiscard]] CipherContext MakeCipherContext() const override;
 
   int32_t GcmEncrypt(span<const uint8_t> plaintext, span<const uint8_t> key,
                      span<const uint8_t> nonce, span<const uint8_t> aad,
@@ -240,7 +272,7 @@ int32_t AesEncryptor::AesEncryptorImpl::GcmEncrypt(span<const uint8_t> plaintext
     throw ParquetException(ss.str());
   }
 
-  auto ctx = MakeCipherContext();
+  auto ctx = AcquireCipherContext();
 
   // Setting key and IV (nonce)
   if (1 != EVP_EncryptInit_ex(ctx.get(), nullptr, nullptr, key.data(), nonce.data())) {
@@ -286,6 +318,7 @@ int32_t AesEncryptor::AesEncryptorImpl::GcmEncrypt(span<const uint8_t> plaintext
       EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_GET_TAG, kGcmTagLength, tag.data())) {
     throw ParquetException("Couldn't get AES-GCM tag");
   }
+  ReleaseCipherContext(std::move(ctx));
 
   // Copying the buffer size, nonce and tag to ciphertext
   int32_t buffer_size = kNonceLength + ciphertext_len + kGcmTagLength;
@@ -324,7 +357,7 @@ int32_t AesEncryptor::AesEncryptorImpl::CtrEncrypt(span<const uint8_t> plaintext
   std::copy(nonce.begin(), nonce.begin() + kNonceLength, iv.begin());
   iv[kCtrIvLength - 1] = 1;
 
-  auto ctx = MakeCipherContext();
+  auto ctx = AcquireCipherContext();
 
   // Setting key and IV
   if (1 != EVP_EncryptInit_ex(ctx.get(), nullptr, nullptr, key.data(), iv.data())) {
@@ -353,6 +386,7 @@ int32_t AesEncryptor::AesEncryptorImpl::CtrEncrypt(span<const uint8_t> plaintext
   }
 
   ciphertext_len += len;
+  ReleaseCipherContext(std::move(ctx));
 
   // Copying the buffer size and nonce to ciphertext
   int32_t buffer_size = kNonceLength + ciphertext_len;
@@ -426,7 +460,7 @@ class AesDecryptor::AesDecryptorImpl : AesCryptoContext {
   }
 
  private:
-  [[nodiscard]] CipherContext MakeCipherContext() const;
+  [[nodiscard]] CipherContext MakeCipherContext() const override;
 
   /// Get the actual ciphertext length, inclusive of the length buffer length,
   /// and validate that the provided buffer size is large enough.
@@ -578,7 +612,7 @@ int32_t AesDecryptor::AesDecryptorImpl::GcmDecrypt(span<const uint8_t> ciphertex
   std::copy(ciphertext.begin() + ciphertext_len - kGcmTagLength,
             ciphertext.begin() + ciphertext_len, tag.begin());
 
-  auto ctx = MakeCipherContext();
+  auto ctx = AcquireCipherContext();
 
   // Setting key and IV
   if (1 != EVP_DecryptInit_ex(ctx.get(), nullptr, nullptr, key.data(), nonce.data())) {
@@ -616,6 +650,7 @@ int32_t AesDecryptor::AesDecryptorImpl::GcmDecrypt(span<const uint8_t> ciphertex
   if (1 != EVP_DecryptFinal_ex(ctx.get(), plaintext.data() + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
+  ReleaseCipherContext(std::move(ctx));
 
   plaintext_len += len;
   return plaintext_len;
@@ -654,7 +689,7 @@ int32_t AesDecryptor::AesDecryptorImpl::CtrDecrypt(span<const uint8_t> ciphertex
   // is set to 1.
   iv[kCtrIvLength - 1] = 1;
 
-  auto ctx = MakeCipherContext();
+  auto ctx = AcquireCipherContext();
 
   // Setting key and IV
   if (1 != EVP_DecryptInit_ex(ctx.get(), nullptr, nullptr, key.data(), iv.data())) {
@@ -675,6 +710,7 @@ int32_t AesDecryptor::AesDecryptorImpl::CtrDecrypt(span<const uint8_t> ciphertex
   if (1 != EVP_DecryptFinal_ex(ctx.get(), plaintext.data() + len, &len)) {
     throw ParquetException("Failed decryption finalization");
   }
+  ReleaseCipherContext(std::move(ctx));
 
   plaintext_len += len;
   return plaintext_len;
@@ -45,6 +45,9 @@ constexpr int8_t kBloomFilterHeader = 8;
 constexpr int8_t kBloomFilterBitset = 9;
 
 /// Performs AES encryption operations with GCM or CTR ciphers.
+///
+/// Cipher contexts are reused across calls. Encrypt() and SignedFooterEncrypt()
+/// may be called concurrently.
 class PARQUET_EXPORT AesEncryptor {
  public:
   /// Can serve one key length only. Possible values: 16, 24, 32 bytes.
@@ -81,6 +84,9 @@ class PARQUET_EXPORT AesEncryptor {
 };
 
 /// Performs AES decryption operations with GCM or CTR ciphers.
+///
+/// Cipher contexts are reused across calls. Decrypt() may be called
+/// concurrently.
 class PARQUET_EXPORT AesDecryptor {
  public:
   /// \brief Construct an AesDecryptor
@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "parquet/encryption/encryption_internal.h"
@@ -104,6 +108,57 @@ class TestAesEncryption : public ::testing::Test {
                  ParquetException);
   }
 
+  // Cipher contexts are reused across calls and threads
+  void ConcurrentRoundTrips(ParquetCipher::type cipher_type) {
+    bool metadata = false;
+    bool write_length = true;
+    constexpr int kNumThreads = 8;
+    constexpr int kNumRoundTrips = 50;
+
+    AesEncryptor encryptor(cipher_type, key_length_, metadata, write_length);
+    AesDecryptor decryptor(cipher_type, key_length_, metadata, write_length);
+
+    std::vector<std::string> errors(kNumThreads);
+    std::vector<std::thread> threads;
+    for (int thread_index = 0; thread_index < kNumThreads; ++thread_index) {
+      threads.emplace_back([&, thread_index] {
+        for (int i = 0; i < kNumRoundTrips; ++i) {
+          std::string plaintext = plain_text_ + std::to_string(thread_index * i);
+          std::string aad = aad_ + std::to_string(i);
+          std::vector<uint8_t> ciphertext(encryptor.CiphertextLength(plaintext.size()));
+          int32_t ciphertext_length = encryptor.Encrypt(
+              str2span(plaintext), str2span(key_), str2span(aad), ciphertext);
+
+          if (cipher_type == ParquetCipher::AES_GCM_V1 && i % 10 == 0) {
+            // A failed decryption doesn't affect the following ones
+            std::vector<uint8_t> decrypted(decryptor.PlaintextLength(ciphertext_length));
+            try {
+              decryptor.Decrypt(ciphertext, str2span(key_), str2span(aad_), decrypted);
+              errors[thread_index] = "decryption with the wrong AAD succeeded";
+              return;
+            } catch (const ParquetException&) {
+            }
+          }
+
+          std::vector<uint8_t> decrypted(decryptor.PlaintextLength(ciphertext_length));
+          int32_t plaintext_length =
+              decryptor.Decrypt(ciphertext, str2span(key_), str2span(aad), decrypted);
+          if (std::string(decrypted.begin(), decrypted.begin() + plaintext_length) !=
+              plaintext) {
+            errors[thread_index] = "round trip mismatch";
+            return;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const auto& error : errors) {
+      ASSERT_EQ("", error);
+    }
+  }
+
  private:
   int32_t key_length_ = 0;
   std::string key_;
@@ -137,4 +192,12 @@ TEST_F(TestAesEncryption, AesGcmCtrDecryptCiphertextBufferTooSmall) {
   DecryptCiphertextBufferTooSmall(ParquetCipher::AES_GCM_CTR_V1);
 }
 
+TEST_F(TestAesEncryption, AesGcmConcurrentRoundTrips) {
+  ConcurrentRoundTrips(ParquetCipher::AES_GCM_V1);
+}
+
+TEST_F(TestAesEncryption, AesGcmCtrConcurrentRoundTrips) {
+  ConcurrentRoundTrips(ParquetCipher::AES_GCM_CTR_V1);
+}
+
 }  // namespace parquet::encryption::test
@@ -49,6 +49,12 @@ int32_t Decryptor::Decrypt(::arrow::util::span<const uint8_t> ciphertext,
   return aes_decryptor_->Decrypt(ciphertext, str2span(key_), str2span(aad_), plaintext);
 }
 
+int32_t Decryptor::Decrypt(::arrow::util::span<const uint8_t> ciphertext,
+                           ::arrow::util::span<uint8_t> plaintext,
+                           const std::string& aad) const {
+  return aes_decryptor_->Decrypt(ciphertext, str2span(key_), str2span(aad), plaintext);
+}
+
 // InternalFileDecryptor
 InternalFileDecryptor::InternalFileDecryptor(
     std::shared_ptr<FileDecryptionProperties> properties, const std::string& file_aad,
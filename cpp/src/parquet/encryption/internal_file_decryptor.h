@@ -36,7 +36,8 @@ class FileDecryptionProperties;
 
 // An object handling decryption using well-known encryption parameters
 //
-// CAUTION: Decryptor objects are not thread-safe.
+// CAUTION: Decryptor objects are not thread-safe, except for the Decrypt()
+// overload taking an explicit AAD, which may be called concurrently.
 class PARQUET_EXPORT Decryptor {
  public:
   Decryptor(std::unique_ptr<encryption::AesDecryptor> decryptor, const std::string& key,
@@ -45,6 +46,7 @@ class PARQUET_EXPORT Decryptor {
   ~Decryptor();
 
   const std::string& file_aad() const { return file_aad_; }
+  const std::string& aad() const { return aad_; }
   void UpdateAad(const std::string& aad) { aad_ = aad; }
   ::arrow::MemoryPool* pool() { return pool_; }
 
@@ -52,6 +54,10 @@ class PARQUET_EXPORT Decryptor {
   [[nodiscard]] int32_t CiphertextLength(int32_t plaintext_len) const;
   int32_t Decrypt(::arrow::util::span<const uint8_t> ciphertext,
                   ::arrow::util::span<uint8_t> plaintext);
+  // Decrypt with the given AAD rather than the current one, e.g. one saved with
+  // aad() for decrypting a page on another thread.
+  int32_t Decrypt(::arrow::util::span<const uint8_t> ciphertext,
+                  ::arrow::util::span<uint8_t> plaintext, const std::string& aad) const;
 
  private:
   std::unique_ptr<encryption::AesDecryptor> aes_decryptor_;
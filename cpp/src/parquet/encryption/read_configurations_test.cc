@@ -19,15 +19,20 @@
 #include <stdio.h>
 
 #include <fstream>
+#include <numeric>
+#include <vector>
 
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/testing/gtest_compat.h"
+#include "arrow/testing/gtest_util.h"
 #include "arrow/util/config.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/encryption/test_encryption_util.h"
 #include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/test_util.h"
 
 /*
@@ -290,4 +295,57 @@ INSTANTIATE_TEST_SUITE_P(
             5, "encrypt_columns_and_footer_disable_aad_storage.parquet.encrypted"),
         std::make_tuple(6, "encrypt_columns_and_footer_ctr.parquet.encrypted")));
 
+// Pages of encrypted column chunks may be decrypted ahead of decoding, on the
+// CPU thread pool
+TEST(TestDecryptionReadahead, ReadEncryptedPagesAhead) {
+  constexpr int64_t kNumValues = 10000;
+  auto schema = std::static_pointer_cast<schema::GroupNode>(schema::GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {schema::PrimitiveNode::Make("int64", Repetition::REQUIRED, Type::INT64)}));
+  std::vector<int64_t> values(kNumValues);
+  std::iota(values.begin(), values.end(), 0);
+
+  for (auto cipher : {ParquetCipher::AES_GCM_V1, ParquetCipher::AES_GCM_CTR_V1}) {
+    ARROW_SCOPED_TRACE("cipher = ", cipher);
+    std::shared_ptr<WriterProperties> writer_properties =
+        WriterProperties::Builder()
+            .disable_dictionary()
+            ->data_pagesize(1024)
+            ->encryption(FileEncryptionProperties::Builder(kFooterEncryptionKey)
+                             .algorithm(cipher)
+                             ->build())
+            ->build();
+    ASSERT_OK_AND_ASSIGN(auto sink, ::arrow::io::BufferOutputStream::Create());
+    auto file_writer = ParquetFileWriter::Open(sink, schema, writer_properties);
+    auto column_writer =
+        static_cast<Int64Writer*>(file_writer->AppendRowGroup()->NextColumn());
+    column_writer->WriteBatch(kNumValues, nullptr, nullptr, values.data());
+    file_writer->Close();
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    for (int32_t readahead : {0, 3}) {
+      ARROW_SCOPED_TRACE("readahead = ", readahead);
+      ReaderProperties reader_properties;
+      reader_properties.set_page_decompression_readahead(readahead);
+      reader_properties.file_decryption_properties(
+          FileDecryptionProperties::Builder().footer_key(kFooterEncryptionKey)->build());
+      auto file_reader = ParquetFileReader::Open(
+          std::make_shared<::arrow::io::BufferReader>(buffer), reader_properties);
+      auto column_reader =
+          std::static_pointer_cast<Int64Reader>(file_reader->RowGroup(0)->Column(0));
+
+      std::vector<int64_t> values_out(kNumValues);
+      int64_t total_read = 0;
+      while (column_reader->HasNext()) {
+        int64_t values_read = 0;
+        column_reader->ReadBatch(kNumValues - total_read, nullptr, nullptr,
+                                 values_out.data() + total_read, &values_read);
+        total_read += values_read;
+      }
+      ASSERT_EQ(kNumValues, total_read);
+      ASSERT_EQ(values, values_out);
+    }
+  }
+}
+
 }  // namespace parquet::encryption::test
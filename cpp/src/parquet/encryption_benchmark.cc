@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/config.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/column_writer.h"
+#include "parquet/encryption/encryption.h"
+#include "parquet/encryption/encryption_internal.h"
+#include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet {
+
+using schema::GroupNode;
+using schema::PrimitiveNode;
+
+namespace benchmarks {
+
+namespace {
+
+const char kFooterKey[] = "0123456789012345";
+const char kAad[] = "benchmark-aad";
+
+}  // namespace
+
+// Decryption of single modules, where the per-call cost of setting up the
+// cipher dominates for page headers and small pages
+template <ParquetCipher::type cipher, bool metadata>
+static void BM_AesDecrypt(::benchmark::State& state) {
+  const int64_t plaintext_len = state.range(0);
+  const std::string key(kFooterKey);
+  const std::string aad(kAad);
+  std::vector<uint8_t> plaintext(plaintext_len, 42);
+
+  encryption::AesEncryptor encryptor(cipher, static_cast<int32_t>(key.size()), metadata);
+  std::vector<uint8_t> ciphertext(encryptor.CiphertextLength(plaintext_len));
+  encryptor.Encrypt(plaintext, str2span(key), str2span(aad), ciphertext);
+
+  encryption::AesDecryptor decryptor(cipher, static_cast<int32_t>(key.size()), metadata);
+  for (auto _ : state) {
+    decryptor.Decrypt(ciphertext, str2span(key), str2span(aad), plaintext);
+    ::benchmark::DoNotOptimize(plaintext.data());
+  }
+  state.SetBytesProcessed(state.iterations() * plaintext_len);
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_AesDecrypt, ParquetCipher::AES_GCM_V1, /*metadata=*/true)
+    ->Arg(64)
+    ->Arg(1024);
+BENCHMARK_TEMPLATE(BM_AesDecrypt, ParquetCipher::AES_GCM_V1, /*metadata=*/false)
+    ->Arg(1024)
+    ->Arg(64 * 1024)
+    ->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(BM_AesDecrypt, ParquetCipher::AES_GCM_CTR_V1, /*metadata=*/false)
+    ->Arg(1024)
+    ->Arg(64 * 1024)
+    ->Arg(1024 * 1024);
+
+// Read a column chunk encrypted with the footer key, with state.range(1) pages
+// decrypted and decompressed ahead of decoding
+static void BM_ReadEncryptedInt64Column(::benchmark::State& state,
+                                        Compression::type codec) {
+  const int64_t num_values = state.range(0);
+  ::arrow::random::RandomArrayGenerator rgen(1337);
+  auto values = rgen.Int64(num_values, 0, 1000000, 0);
+  const auto& int64_values = static_cast<const ::arrow::Int64Array&>(*values);
+
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("int64", Repetition::REQUIRED, Type::INT64)}));
+  std::shared_ptr<WriterProperties> writer_properties =
+      WriterProperties::Builder()
+          .compression(codec)
+          ->disable_dictionary()
+          ->data_pagesize(64 * 1024)
+          ->encryption(FileEncryptionProperties::Builder(kFooterKey).build())
+          ->build();
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, writer_properties);
+  auto column_writer =
+      static_cast<Int64Writer*>(file_writer->AppendRowGroup()->NextColumn());
+  column_writer->WriteBatch(num_values, nullptr, nullptr, int64_values.raw_values());
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  std::vector<int64_t> values_out(1024);
+  for (auto _ : state) {
+    ReaderProperties reader_properties;
+    reader_properties.set_page_decompression_readahead(
+        static_cast<int32_t>(state.range(1)));
+    // Decryption properties with explicit keys can't be shared between files
+    reader_properties.file_decryption_properties(
+        FileDecryptionProperties::Builder().footer_key(kFooterKey)->build());
+    auto file_reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), reader_properties);
+    auto column_reader =
+        std::static_pointer_cast<Int64Reader>(file_reader->RowGroup(0)->Column(0));
+    int64_t values_read = 0;
+    for (int64_t i = 0; i < num_values; i += values_read) {
+      column_reader->ReadBatch(static_cast<int64_t>(values_out.size()), nullptr,
+                               nullptr, values_out.data(), &values_read);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * num_values * sizeof(int64_t));
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+template <Compression::type codec = Compression::UNCOMPRESSED>
+static void BM_ReadEncryptedInt64Column(::benchmark::State& state) {
+  BM_ReadEncryptedInt64Column(state, codec);
+}
+
+static void ReadEncryptedColumnSetArgs(::benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"num_values", "readahead"});
+  for (int64_t readahead : {0, 4}) {
+    bench->Args({1 << 20, readahead});
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ReadEncryptedInt64Column)->Apply(ReadEncryptedColumnSetArgs);
+
+#ifdef ARROW_WITH_ZSTD
+BENCHMARK_TEMPLATE(BM_ReadEncryptedInt64Column, Compression::ZSTD)
+    ->Apply(ReadEncryptedColumnSetArgs);
+#endif
+
+}  // namespace benchmarks
+
+}  // namespace parquet
@@ -198,7 +198,9 @@ class TestPageSerde : public ::testing::Test {
                         bool verification_checksum, bool has_dictionary = false,
                         bool write_data_page_v2 = false);
 
-  void TestPageCompressionRoundTrip(const std::vector<int>& page_sizes);
+  void TestPageCompressionRoundTrip(
+      const std::vector<int>& page_sizes,
+      const ReaderProperties& properties = ReaderProperties());
 
  protected:
   std::shared_ptr<::arrow::io::BufferOutputStream> out_stream_;
@@ -708,7 +710,8 @@ TEST_F(TestPageSerde, TestFailLargePageHeaders) {
   ASSERT_THROW(page_reader_->NextPage(), ParquetException);
 }
 
-void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_sizes) {
+void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_sizes,
+                                                 const ReaderProperties& properties) {
   auto codec_types = GetSupportedCodecTypes();
 
   const int32_t num_rows = 32;  // dummy value
@@ -740,7 +743,7 @@ void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_si
       ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
     }
 
-    InitSerializedPageReader(num_rows * num_pages, codec_type);
+    InitSerializedPageReader(num_rows * num_pages, codec_type, properties);
 
     std::shared_ptr<Page> page;
     const DataPageV1* data_page;
@@ -751,6 +754,7 @@ void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_si
       ASSERT_EQ(data_size, data_page->size());
       ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
     }
+    ASSERT_EQ(nullptr, page_reader_->NextPage());
 
     ResetStream();
   }
@@ -778,6 +782,63 @@ TEST_F(TestPageSerde, PageSizeResetWhenRead) {
   this->TestPageCompressionRoundTrip(page_sizes);
 }
 
+TEST_F(TestPageSerde, CompressionWithDecompressionReadahead) {
+  std::vector<int> page_sizes;
+  page_sizes.reserve(10);
+  for (int i = 0; i < 10; ++i) {
+    page_sizes.push_back((i + 1) * 1024);
+  }
+  for (int32_t readahead : {1, 3, 16}) {
+    ARROW_SCOPED_TRACE("readahead = ", readahead);
+    ReaderProperties properties;
+    properties.set_page_decompression_readahead(readahead);
+    this->TestPageCompressionRoundTrip(page_sizes, properties);
+  }
+}
+
+TEST_F(TestPageSerde, DecompressionReadaheadKeepsPagesValid) {
+  // Pages decompressed ahead of decoding don't share buffers
+  auto codec_types = GetSupportedCodecTypes();
+  if (codec_types.empty()) {
+    GTEST_SKIP() << "No compression codec available";
+  }
+  const Compression::type codec_type = codec_types.front();
+  const int num_pages = 5;
+  const int data_size = 4096;
+  auto codec = GetCodec(codec_type);
+  data_page_header_.num_values = 32;
+
+  std::vector<std::vector<uint8_t>> faux_data(num_pages);
+  std::vector<uint8_t> buffer;
+  for (int i = 0; i < num_pages; ++i) {
+    test::random_bytes(data_size, i, &faux_data[i]);
+    int64_t max_compressed_size = codec->MaxCompressedLen(data_size, faux_data[i].data());
+    buffer.resize(max_compressed_size);
+    ASSERT_OK_AND_ASSIGN(int64_t actual_size,
+                         codec->Compress(data_size, faux_data[i].data(),
+                                         max_compressed_size, buffer.data()));
+    ASSERT_NO_FATAL_FAILURE(
+        WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
+    ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
+  }
+
+  ReaderProperties properties;
+  properties.set_page_decompression_readahead(2);
+  InitSerializedPageReader(32 * num_pages, codec_type, properties);
+
+  std::vector<std::shared_ptr<Page>> pages;
+  for (int i = 0; i < num_pages; ++i) {
+    pages.push_back(page_reader_->NextPage());
+    ASSERT_NE(nullptr, pages.back());
+  }
+  ASSERT_EQ(nullptr, page_reader_->NextPage());
+  for (int i = 0; i < num_pages; ++i) {
+    auto data_page = static_cast<const DataPageV1*>(pages[i].get());
+    ASSERT_EQ(data_size, data_page->size());
+    ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+  }
+}
+
 TEST_F(TestPageSerde, LZONotSupported) {
   // Must await PARQUET-530
   int data_size = 1024;
@@ -317,17 +317,20 @@ class SerializedFile : public ParquetFileReader::Contents {
   void Close() override {}
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
+    std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source;
     std::shared_ptr<Buffer> prebuffered_column_chunks_bitmap;
-    // Avoid updating the bitmap as this function can be called concurrently. The bitmap
-    // can only be updated within Prebuffer().
-    auto prebuffered_column_chunks_iter = prebuffered_column_chunks_.find(i);
-    if (prebuffered_column_chunks_iter != prebuffered_column_chunks_.end()) {
-      prebuffered_column_chunks_bitmap = prebuffered_column_chunks_iter->second;
+    // Avoid updating the map as this function can be called concurrently. It can
+    // only be updated within PreBuffer(), ExtendPreBuffer() and ReleaseBuffered().
+    auto prebuffered_row_group_iter = prebuffered_row_groups_.find(i);
+    if (prebuffered_row_group_iter != prebuffered_row_groups_.end()) {
+      cached_source = prebuffered_row_group_iter->second.cached_source;
+      prebuffered_column_chunks_bitmap =
+          prebuffered_row_group_iter->second.column_chunks_bitmap;
     }
 
     std::unique_ptr<SerializedRowGroup> contents = std::make_unique<SerializedRowGroup>(
-        source_, cached_source_, source_size_, file_metadata_.get(), i, properties_,
-        std::move(prebuffered_column_chunks_bitmap));
+        source_, std::move(cached_source), source_size_, file_metadata_.get(), i,
+        properties_, std::move(prebuffered_column_chunks_bitmap));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
@@ -377,10 +380,20 @@ class SerializedFile : public ParquetFileReader::Contents {
                  const std::vector<int>& column_indices,
                  const ::arrow::io::IOContext& ctx,
                  const ::arrow::io::CacheOptions& options) {
-    cached_source_ =
+    prebuffered_row_groups_.clear();
+    ExtendPreBuffer(row_groups, column_indices, ctx, options);
+  }
+
+  void ExtendPreBuffer(const std::vector<int>& row_groups,
+                       const std::vector<int>& column_indices,
+                       const ::arrow::io::IOContext& ctx,
+                       const ::arrow::io::CacheOptions& options) {
+    // All the row groups buffered by a single call share one cache, so that their
+    // column chunks can be coalesced. The cache is released along with the last of
+    // them.
+    auto cached_source =
         std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, ctx, options);
     std::vector<::arrow::io::ReadRange> ranges;
-    prebuffered_column_chunks_.clear();
     int num_cols = file_metadata_->num_columns();
     // a bitmap for buffered columns.
     std::shared_ptr<Buffer> buffer_columns;
@@ -392,13 +405,19 @@ class SerializedFile : public ParquetFileReader::Contents {
       }
     }
     for (int row : row_groups) {
-      prebuffered_column_chunks_[row] = buffer_columns;
+      prebuffered_row_groups_[row] = {cached_source, buffer_columns};
       for (int col : column_indices) {
         ranges.push_back(
             ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
       }
     }
-    PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
+    PARQUET_THROW_NOT_OK(cached_source->Cache(ranges));
+  }
+
+  void ReleaseBuffered(const std::vector<int>& row_groups) {
+    for (int row : row_groups) {
+      prebuffered_row_groups_.erase(row);
+    }
   }
 
   ::arrow::Result<std::vector<::arrow::io::ReadRange>> GetReadRanges(
@@ -418,17 +437,24 @@ class SerializedFile : public ParquetFileReader::Contents {
 
   ::arrow::Future<> WhenBuffered(const std::vector<int>& row_groups,
                                  const std::vector<int>& column_indices) const {
-    if (!cached_source_) {
+    if (prebuffered_row_groups_.empty()) {
       return ::arrow::Status::Invalid("Must call PreBuffer before WhenBuffered");
     }
-    std::vector<::arrow::io::ReadRange> ranges;
+    std::vector<::arrow::Future<>> futures;
+    futures.reserve(row_groups.size());
     for (int row : row_groups) {
+      auto it = prebuffered_row_groups_.find(row);
+      if (it == prebuffered_row_groups_.end()) {
+        return ::arrow::Status::Invalid("Row group ", row, " was not pre-buffered");
+      }
+      std::vector<::arrow::io::ReadRange> ranges;
       for (int col : column_indices) {
         ranges.push_back(
             ComputeColumnChunkRange(file_metadata_.get(), source_size_, row, col));
       }
+      futures.push_back(it->second.cached_source->WaitFor(std::move(ranges)));
     }
-    return cached_source_->WaitFor(ranges);
+    return ::arrow::AllComplete(futures);
   }
 
   // Metadata/footer parsing. Divided up to separate sync/async paths, and to use
@@ -620,15 +646,18 @@ class SerializedFile : public ParquetFileReader::Contents {
 
  private:
   std::shared_ptr<ArrowInputFile> source_;
-  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
   int64_t source_size_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
   std::shared_ptr<PageIndexReader> page_index_reader_;
   std::unique_ptr<BloomFilterReader> bloom_filter_reader_;
-  // Maps row group ordinal and prebuffer status of its column chunks in the form of a
-  // bitmap buffer.
-  std::unordered_map<int, std::shared_ptr<Buffer>> prebuffered_column_chunks_;
+  struct PrebufferedRowGroup {
+    std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source;
+    // Prebuffer status of the column chunks in the form of a bitmap buffer.
+    std::shared_ptr<Buffer> column_chunks_bitmap;
+  };
+  // Maps row group ordinal to the cache holding its pre-buffered column chunks.
+  std::unordered_map<int, PrebufferedRowGroup> prebuffered_row_groups_;
 
   // \return The true length of the metadata in bytes
   uint32_t ParseUnencryptedFileMetadata(
@@ -922,6 +951,23 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+void ParquetFileReader::ExtendPreBuffer(const std::vector<int>& row_groups,
+                                        const std::vector<int>& column_indices,
+                                        const ::arrow::io::IOContext& ctx,
+                                        const ::arrow::io::CacheOptions& options) {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  file->ExtendPreBuffer(row_groups, column_indices, ctx, options);
+}
+
+void ParquetFileReader::ReleaseBuffered(const std::vector<int>& row_groups) {
+  // Access private methods here
+  SerializedFile* file =
+      ::arrow::internal::checked_cast<SerializedFile*>(contents_.get());
+  file->ReleaseBuffered(row_groups);
+}
+
 ::arrow::Result<std::vector<::arrow::io::ReadRange>> ParquetFileReader::GetReadRanges(
     const std::vector<int>& row_groups, const std::vector<int>& column_indices,
     int64_t hole_size_limit, int64_t range_size_limit) {
@@ -201,6 +201,29 @@ class PARQUET_EXPORT ParquetFileReader {
                  const ::arrow::io::IOContext& ctx,
                  const ::arrow::io::CacheOptions& options);
 
+  /// Pre-buffer the specified column indices in additional row groups.
+  ///
+  /// Unlike \a PreBuffer(), this keeps the row groups that are already
+  /// buffered, so that a sequential reader can keep a bounded window of
+  /// row groups buffered ahead of the one it is decoding. The given row
+  /// groups must not be buffered already.
+  ///
+  /// Their data remains buffered in memory until \a ReleaseBuffered() is
+  /// called for all of them, \a PreBuffer() is called, or the reader
+  /// itself is destructed.
+  ///
+  /// This method may throw.
+  void ExtendPreBuffer(const std::vector<int>& row_groups,
+                       const std::vector<int>& column_indices,
+                       const ::arrow::io::IOContext& ctx,
+                       const ::arrow::io::CacheOptions& options);
+
+  /// Stop buffering the specified row groups.
+  ///
+  /// Readers already created for these row groups keep the data they need
+  /// alive; new ones read directly from the file.
+  void ReleaseBuffered(const std::vector<int>& row_groups);
+
   /// Retrieve the list of byte ranges that would need to be read to retrieve
   /// the data for the specified row groups and column indices.
   ///
@@ -67,6 +67,10 @@ int64_t RowGroupWriter::total_compressed_bytes_written() const {
   return contents_->total_compressed_bytes_written();
 }
 
+int64_t RowGroupWriter::estimated_total_compressed_bytes() const {
+  return contents_->estimated_total_compressed_bytes();
+}
+
 bool RowGroupWriter::buffered() const { return contents_->buffered(); }
 
 int RowGroupWriter::current_column() { return contents_->current_column(); }
@@ -194,6 +198,22 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_compressed_bytes_written;
   }
 
+  int64_t estimated_total_compressed_bytes() const override {
+    if (closed_) {
+      return total_compressed_bytes_written_;
+    }
+    // The columns of an unbuffered row group that are closed already
+    int64_t estimated_bytes = total_compressed_bytes_written_;
+    for (size_t i = 0; i < column_writers_.size(); i++) {
+      if (column_writers_[i]) {
+        estimated_bytes += column_writers_[i]->total_compressed_bytes() +
+                           column_writers_[i]->total_compressed_bytes_written() +
+                           column_writers_[i]->estimated_buffered_value_bytes();
+      }
+    }
+    return estimated_bytes;
+  }
+
   bool buffered() const override { return buffered_row_group_; }
 
   void Close() override {
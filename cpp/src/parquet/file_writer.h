@@ -58,6 +58,11 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_compressed_bytes() const = 0;
     /// \brief total compressed bytes written by the page writer
     virtual int64_t total_compressed_bytes_written() const = 0;
+    /// \brief estimated compressed size of the row group, including the values
+    /// not written to a page yet
+    virtual int64_t estimated_total_compressed_bytes() const {
+      return total_compressed_bytes() + total_compressed_bytes_written();
+    }
 
     virtual bool buffered() const = 0;
   };
@@ -99,6 +104,10 @@ class PARQUET_EXPORT RowGroupWriter {
   int64_t total_compressed_bytes() const;
   /// \brief total compressed bytes written by the page writer
   int64_t total_compressed_bytes_written() const;
+  /// \brief estimated compressed size of the row group, including the values
+  /// buffered in the column writers that are not written to a page yet.
+  /// The size of the buffered values is estimated before compression.
+  int64_t estimated_total_compressed_bytes() const;
 
   /// Returns whether the current RowGroupWriter is in the buffered mode and is created
   /// by calling ParquetFileWriter::AppendBufferedRowGroup.
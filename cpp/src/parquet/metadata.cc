@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <random>
 #include <sstream>
@@ -521,19 +523,144 @@ const std::shared_ptr<const KeyValueMetadata>& ColumnChunkMetaData::key_value_me
   return impl_->key_value_metadata();
 }
 
+// lazily decoded column chunk metadata
+
+namespace {
+
+// Location of a serialized ColumnChunk struct in a footer
+struct ColumnChunkLocation {
+  uint32_t offset;
+  uint32_t length;
+};
+
+using ThriftCompactProtocol = apache::thrift::protocol::TCompactProtocolT<ThriftBuffer>;
+
+// A compact protocol that skips the ColumnChunk structs of the row groups instead of
+// decoding them, and records their location in the footer. All other structs are
+// decoded as usual.
+class ColumnChunkIndexingProtocol : public ThriftCompactProtocol {
+ public:
+  ColumnChunkIndexingProtocol(std::shared_ptr<ThriftBuffer> transport,
+                              int32_t string_size_limit, int32_t container_size_limit,
+                              std::vector<ColumnChunkLocation>* locations)
+      : ThriftCompactProtocol(transport, string_size_limit, container_size_limit),
+        transport_(transport.get()),
+        length_(transport->available_read()),
+        locations_(locations) {}
+
+  uint32_t SkipColumnChunk() {
+    const uint32_t begin = length_ - transport_->available_read();
+    skip(apache::thrift::protocol::T_STRUCT);
+    const uint32_t end = length_ - transport_->available_read();
+    locations_->push_back({begin, end - begin});
+    return end - begin;
+  }
+
+ private:
+  ThriftBuffer* transport_;
+  const uint32_t length_;
+  std::vector<ColumnChunkLocation>* locations_;
+};
+
+// The column chunks of a footer that is decoded lazily (see
+// ReaderProperties::lazy_metadata()). Each column chunk is decoded into the thrift
+// FileMetaData the first time it is accessed.
+class LazyColumnChunks {
+ public:
+  LazyColumnChunks(format::FileMetaData* metadata, std::shared_ptr<Buffer> footer,
+                   std::vector<ColumnChunkLocation> locations,
+                   const ReaderProperties& properties)
+      : metadata_(metadata),
+        footer_(std::move(footer)),
+        locations_(std::move(locations)),
+        decoded_(locations_.size(), false),
+        deserializer_(properties) {
+    row_group_offsets_.reserve(metadata_->row_groups.size());
+    size_t offset = 0;
+    for (const format::RowGroup& row_group : metadata_->row_groups) {
+      row_group_offsets_.push_back(offset);
+      offset += row_group.columns.size();
+    }
+    ARROW_CHECK_EQ(offset, locations_.size());
+  }
+
+  // Return a column chunk, decoding it first if needed
+  const format::ColumnChunk* Get(int row_group, int column) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Decode(row_group, column);
+  }
+
+  void DecodeRowGroup(int row_group) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeRowGroupUnlocked(row_group);
+  }
+
+  void DecodeAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < row_group_offsets_.size(); ++i) {
+      DecodeRowGroupUnlocked(static_cast<int>(i));
+    }
+  }
+
+ private:
+  void DecodeRowGroupUnlocked(int row_group) {
+    const size_t num_columns = metadata_->row_groups[row_group].columns.size();
+    for (size_t i = 0; i < num_columns; ++i) {
+      Decode(row_group, static_cast<int>(i));
+    }
+  }
+
+  const format::ColumnChunk* Decode(int row_group, int column) {
+    format::ColumnChunk* chunk = &metadata_->row_groups[row_group].columns[column];
+    const size_t index = row_group_offsets_[row_group] + column;
+    if (!decoded_[index]) {
+      uint32_t length = locations_[index].length;
+      deserializer_.DeserializeMessage(footer_->data() + locations_[index].offset,
+                                       &length, chunk);
+      decoded_[index] = true;
+    }
+    return chunk;
+  }
+
+  format::FileMetaData* metadata_;
+  std::shared_ptr<Buffer> footer_;
+  std::vector<ColumnChunkLocation> locations_;
+  // Index of the first column chunk of each row group in locations_
+  std::vector<size_t> row_group_offsets_;
+  std::vector<bool> decoded_;
+  ThriftDeserializer deserializer_;
+  std::mutex mutex_;
+};
+
+}  // namespace
+
+namespace format {
+
+// Reading a ColumnChunk with the indexing protocol only records its location
+template <>
+uint32_t ColumnChunk::read<ColumnChunkIndexingProtocol>(
+    ColumnChunkIndexingProtocol* iprot) {
+  return iprot->SkipColumnChunk();
+}
+
+}  // namespace format
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
-  explicit RowGroupMetaDataImpl(const format::RowGroup* row_group,
-                                const SchemaDescriptor* schema,
-                                const ReaderProperties& properties,
-                                const ApplicationVersion* writer_version,
-                                std::shared_ptr<InternalFileDecryptor> file_decryptor)
+  explicit RowGroupMetaDataImpl(
+      const format::RowGroup* row_group, const SchemaDescriptor* schema,
+      const ReaderProperties& properties, const ApplicationVersion* writer_version,
+      std::shared_ptr<InternalFileDecryptor> file_decryptor,
+      std::shared_ptr<LazyColumnChunks> lazy_column_chunks = nullptr,
+      int row_group_index = -1)
       : row_group_(row_group),
         schema_(schema),
         properties_(properties),
         writer_version_(writer_version),
-        file_decryptor_(std::move(file_decryptor)) {
+        file_decryptor_(std::move(file_decryptor)),
+        lazy_column_chunks_(std::move(lazy_column_chunks)),
+        row_group_index_(row_group_index) {
     if (ARROW_PREDICT_FALSE(row_group_->columns.size() >
                             static_cast<size_t>(std::numeric_limits<int>::max()))) {
       throw ParquetException("Row group had too many columns: ",
@@ -542,6 +669,8 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   }
 
   bool Equals(const RowGroupMetaDataImpl& other) const {
+    DecodeColumnChunks();
+    other.DecodeColumnChunks();
     return *row_group_ == *other.row_group_;
   }
 
@@ -563,8 +692,11 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
     if (i >= 0 && i < num_columns()) {
       int16_t row_group_ordinal =
           row_group_->__isset.ordinal ? row_group_->ordinal : static_cast<int16_t>(-1);
-      return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
-                                       properties_, writer_version_, row_group_ordinal, i,
+      const format::ColumnChunk* column_chunk =
+          lazy_column_chunks_ ? lazy_column_chunks_->Get(row_group_index_, i)
+                              : &row_group_->columns[i];
+      return ColumnChunkMetaData::Make(column_chunk, schema_->Column(i), properties_,
+                                       writer_version_, row_group_ordinal, i,
                                        file_decryptor_);
     }
     throw ParquetException("The file only has ", num_columns(),
@@ -584,11 +716,20 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   }
 
  private:
+  void DecodeColumnChunks() const {
+    if (lazy_column_chunks_) {
+      lazy_column_chunks_->DecodeRowGroup(row_group_index_);
+    }
+  }
+
   const format::RowGroup* row_group_;
   const SchemaDescriptor* schema_;
   const ReaderProperties properties_;
   const ApplicationVersion* writer_version_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  // Set if the column chunks of the file metadata are decoded lazily
+  std::shared_ptr<LazyColumnChunks> lazy_column_chunks_;
+  int row_group_index_;
 };
 
 std::unique_ptr<RowGroupMetaData> RowGroupMetaData::Make(
@@ -607,6 +748,9 @@ RowGroupMetaData::RowGroupMetaData(const void* metadata, const SchemaDescriptor*
                                      schema, properties, writer_version,
                                      std::move(file_decryptor))} {}
 
+RowGroupMetaData::RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl)
+    : impl_(std::move(impl)) {}
+
 RowGroupMetaData::~RowGroupMetaData() = default;
 
 bool RowGroupMetaData::Equals(const RowGroupMetaData& other) const {
@@ -703,9 +847,23 @@ class FileMetaData::FileMetaDataImpl {
         file_decryptor_ != nullptr ? file_decryptor_->GetFooterDecryptor() : nullptr;
 
     ThriftDeserializer deserializer(properties_);
-    deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
-                                    metadata_len, metadata_.get(),
-                                    footer_decryptor.get());
+    if (properties_.lazy_metadata() && footer_decryptor == nullptr) {
+      // Only index the column chunks, and keep a copy of the footer to decode them
+      // when they are accessed
+      std::vector<ColumnChunkLocation> locations;
+      deserializer.DeserializeUnencryptedMessageWithProtocol<ColumnChunkIndexingProtocol>(
+          reinterpret_cast<const uint8_t*>(metadata), metadata_len, metadata_.get(),
+          &locations);
+      std::shared_ptr<ResizableBuffer> footer =
+          AllocateBuffer(properties_.memory_pool(), *metadata_len);
+      std::memcpy(footer->mutable_data(), metadata, *metadata_len);
+      lazy_column_chunks_ = std::make_shared<LazyColumnChunks>(
+          metadata_.get(), std::move(footer), std::move(locations), properties_);
+    } else {
+      deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
+                                      metadata_len, metadata_.get(),
+                                      footer_decryptor.get());
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -725,6 +883,7 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException("Decryption not set properly. cannot verify signature");
     }
     // serialize the footer
+    DecodeColumnChunks();
     uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
     ThriftSerializer serializer;
@@ -780,6 +939,7 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    DecodeColumnChunks();
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
@@ -815,11 +975,15 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
-    return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
-                                  &writer_version_, file_decryptor_);
+    return std::unique_ptr<RowGroupMetaData>(
+        new RowGroupMetaData(std::make_unique<RowGroupMetaData::RowGroupMetaDataImpl>(
+            &metadata_->row_groups[i], &schema_, properties_, &writer_version_,
+            file_decryptor_, lazy_column_chunks_, i)));
   }
 
   bool Equals(const FileMetaDataImpl& other) const {
+    DecodeColumnChunks();
+    other.DecodeColumnChunks();
     return *metadata_ == *other.metadata_;
   }
 
@@ -830,6 +994,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    DecodeColumnChunks();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -844,6 +1009,9 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (lazy_column_chunks_) {
+      lazy_column_chunks_->DecodeRowGroup(i);
+    }
     return metadata_->row_groups[i];
   }
 
@@ -860,6 +1028,9 @@ class FileMetaData::FileMetaDataImpl {
     // and incur O(n²) behavior on repeated calls to AppendRowGroups().
     // (see https://en.cppreference.com/w/cpp/container/vector/reserve
     //  about inappropriate uses of reserve()).
+    // The appended row groups are not in the footer, so stop decoding lazily
+    DecodeColumnChunks();
+    lazy_column_chunks_.reset();
     const auto start = metadata_->row_groups.size();
     metadata_->row_groups.resize(start + n);
     for (int i = 0; i < n; i++) {
@@ -909,6 +1080,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   std::string SerializeUnencrypted(bool scrub, bool debug) const {
+    DecodeColumnChunks();
     auto md = *metadata_;
     if (scrub) Scrub(&md);
     if (debug) {
@@ -940,6 +1112,15 @@ class FileMetaData::FileMetaDataImpl {
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
   const ReaderProperties properties_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  // Set if the column chunks are decoded lazily
+  std::shared_ptr<LazyColumnChunks> lazy_column_chunks_;
+
+  // Decode all column chunks before using the whole thrift FileMetaData
+  void DecodeColumnChunks() const {
+    if (lazy_column_chunks_) {
+      lazy_column_chunks_->DecodeAll();
+    }
+  }
 
   void InitSchema() {
     if (metadata_->schema.empty()) {
@@ -236,8 +236,10 @@ class PARQUET_EXPORT RowGroupMetaData {
       const ReaderProperties& properties,
       const ApplicationVersion* writer_version = NULLPTR,
       std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
+  friend class FileMetaData;
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
+  explicit RowGroupMetaData(std::unique_ptr<RowGroupMetaDataImpl> impl);
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
 };
 
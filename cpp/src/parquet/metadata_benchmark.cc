@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 
@@ -92,15 +93,25 @@ class MetadataBenchmark {
     return buf;
   }
 
-  void ReadFile(std::shared_ptr<Buffer> contents) {
+  // Read the file metadata, and the metadata of the first `num_projected_columns`
+  // column chunks in each row group
+  void ReadFile(std::shared_ptr<Buffer> contents, bool lazy_metadata = false,
+                int num_projected_columns = 0) {
     auto source = std::make_shared<BufferReader>(contents);
     ReaderProperties props;
+    props.set_lazy_metadata(lazy_metadata);
     auto reader = ParquetFileReader::Open(source, props);
     auto metadata = reader->metadata();
     ARROW_CHECK_EQ(metadata->num_columns(), num_columns_);
     ARROW_CHECK_EQ(metadata->num_row_groups(), num_row_groups_);
     // There should be one row per row group
     ARROW_CHECK_EQ(metadata->num_rows(), num_row_groups_);
+    for (int rg = 0; rg < num_row_groups_; ++rg) {
+      auto row_group = metadata->RowGroup(rg);
+      for (int col = 0; col < std::min(num_projected_columns, num_columns_); ++col) {
+        ARROW_CHECK_EQ(row_group->ColumnChunk(col)->num_values(), 1);
+      }
+    }
     reader->Close();
   }
 
@@ -150,7 +161,22 @@ void ReadFileMetadata(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// Read the metadata of 3 columns, decoding the column chunks eagerly or lazily
+void ReadFileMetadataProjected(benchmark::State& state, bool lazy_metadata) {
+  MetadataBenchmark benchmark(&state);
+  auto contents = benchmark.WriteFile(&state);
+
+  for (auto _ : state) {
+    benchmark.ReadFile(contents, lazy_metadata, /*num_projected_columns=*/3);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(WriteFileMetadataAndData)->Apply(WriteMetadataSetArgs);
 BENCHMARK(ReadFileMetadata)->Apply(ReadMetadataSetArgs);
+BENCHMARK_CAPTURE(ReadFileMetadataProjected, Eager, /*lazy_metadata=*/false)
+    ->Apply(ReadMetadataSetArgs);
+BENCHMARK_CAPTURE(ReadFileMetadataProjected, Lazy, /*lazy_metadata=*/true)
+    ->Apply(ReadMetadataSetArgs);
 
 }  // namespace parquet
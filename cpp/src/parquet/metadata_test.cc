@@ -267,6 +267,85 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_TRUE(f_accessor_1->Equals(*f_accessor->Subset({2, 0})));
 }
 
+TEST(Metadata, TestLazyMetadata) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+
+  int64_t nrows = 1000;
+  int32_t int_min = 100, int_max = 200;
+  EncodedStatistics stats_int;
+  stats_int.set_null_count(0)
+      .set_distinct_count(nrows)
+      .set_min(std::string(reinterpret_cast<const char*>(&int_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&int_max), 4));
+  EncodedStatistics stats_float;
+  float float_min = 100.100f, float_max = 200.200f;
+  stats_float.set_null_count(0)
+      .set_distinct_count(nrows)
+      .set_min(std::string(reinterpret_cast<const char*>(&float_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&float_max), 4));
+
+  auto props = WriterProperties::Builder().build();
+  auto f_accessor = GenerateTableMetaData(schema, props, nrows, stats_int, stats_float);
+  std::string serialized_metadata = f_accessor->SerializeToString();
+  const uint32_t expected_len = static_cast<uint32_t>(serialized_metadata.length());
+
+  ReaderProperties reader_props;
+  reader_props.set_lazy_metadata(true);
+  auto make_lazy = [&]() {
+    uint32_t decoded_len = expected_len;
+    auto metadata =
+        FileMetaData::Make(serialized_metadata.data(), &decoded_len, reader_props);
+    EXPECT_EQ(expected_len, decoded_len);
+    return metadata;
+  };
+
+  auto lazy = make_lazy();
+  ASSERT_EQ(f_accessor->num_rows(), lazy->num_rows());
+  ASSERT_EQ(f_accessor->num_row_groups(), lazy->num_row_groups());
+  ASSERT_EQ(f_accessor->num_columns(), lazy->num_columns());
+  ASSERT_TRUE(f_accessor->schema()->Equals(*lazy->schema()));
+
+  // Access the column chunks out of order, each one is decoded on first access
+  for (int i = lazy->num_row_groups() - 1; i >= 0; --i) {
+    auto row_group = lazy->RowGroup(i);
+    auto expected_row_group = f_accessor->RowGroup(i);
+    ASSERT_EQ(expected_row_group->num_columns(), row_group->num_columns());
+    ASSERT_EQ(expected_row_group->num_rows(), row_group->num_rows());
+    for (int j = row_group->num_columns() - 1; j >= 0; --j) {
+      auto column_chunk = row_group->ColumnChunk(j);
+      ASSERT_TRUE(expected_row_group->ColumnChunk(j)->Equals(*column_chunk));
+      ASSERT_TRUE(row_group->ColumnChunk(j)->Equals(*column_chunk));
+    }
+  }
+  ASSERT_EQ(expected_len, lazy->size());
+
+  // Operations on the whole metadata decode the column chunks that were not accessed
+  lazy = make_lazy();
+  ASSERT_TRUE(lazy->RowGroup(0)->Equals(*f_accessor->RowGroup(0)));
+  ASSERT_TRUE(lazy->Equals(*f_accessor));
+  lazy = make_lazy();
+  ASSERT_EQ(serialized_metadata, lazy->SerializeToString());
+  lazy = make_lazy();
+  ASSERT_TRUE(lazy->Subset({1})->Equals(*f_accessor->Subset({1})));
+
+  lazy = make_lazy();
+  auto column_chunk = lazy->RowGroup(1)->ColumnChunk(0);
+  lazy->set_file_path("/foo/bar/bar.parquet");
+  ASSERT_EQ("/foo/bar/bar.parquet", column_chunk->file_path());
+  ASSERT_EQ("/foo/bar/bar.parquet", lazy->RowGroup(0)->ColumnChunk(1)->file_path());
+
+  lazy = make_lazy();
+  lazy->AppendRowGroups(*make_lazy());
+  f_accessor->AppendRowGroups(*f_accessor);
+  ASSERT_TRUE(lazy->Equals(*f_accessor));
+  ASSERT_TRUE(lazy->RowGroup(3)->ColumnChunk(1)->Equals(
+      *f_accessor->RowGroup(3)->ColumnChunk(1)));
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -57,6 +58,16 @@ enum class SizeStatisticsLevel : uint8_t {
   PageAndColumnChunk
 };
 
+/// Controls which encoding the writer picks for columns with adaptive encoding
+/// enabled, among the candidate encodings tried on the first data page.
+enum class AdaptiveEncodingPolicy : uint8_t {
+  // The encoding with the smallest encoded and compressed size.
+  Smallest = 0,
+  // The encoding cheapest to decode among those at most 10% larger than the
+  // smallest one.
+  FastestDecode
+};
+
 /// Align the default buffer size to a small multiple of a page size.
 constexpr int64_t kDefaultBufferSize = 4096 * 4;
 
@@ -139,6 +150,33 @@ class PARQUET_EXPORT ReaderProperties {
   void set_footer_read_size(size_t size) { footer_read_size_ = size; }
   size_t footer_read_size() const { return footer_read_size_; }
 
+  /// \brief Return whether the file metadata is decoded lazily.
+  ///
+  /// When enabled, opening a file only decodes the footer's schema and row group
+  /// headers, and the metadata of each column chunk is decoded the first time it
+  /// is accessed. This makes opening files with many columns much cheaper when only
+  /// a few of them are read. Footers encrypted with a footer key are always decoded
+  /// eagerly.
+  bool lazy_metadata() const { return lazy_metadata_; }
+  /// Set whether the file metadata is decoded lazily.
+  void set_lazy_metadata(bool lazy_metadata) { lazy_metadata_ = lazy_metadata; }
+
+  /// \brief Return the number of pages of a column chunk which are decompressed
+  /// ahead of decoding.
+  ///
+  /// When greater than zero, the pages following the one being decoded are
+  /// decrypted and decompressed concurrently on the CPU thread pool, and handed
+  /// to the decoder in order. This helps reading large compressed or encrypted
+  /// column chunks when there are fewer columns than cores, at the cost of
+  /// keeping up to that many more pages in memory per column. The default is 0:
+  /// each page is processed by the decoding thread when it is needed.
+  int32_t page_decompression_readahead() const { return page_decompression_readahead_; }
+  /// Set the number of pages of a column chunk which are decompressed ahead of
+  /// decoding.
+  void set_page_decompression_readahead(int32_t num_pages) {
+    page_decompression_readahead_ = num_pages;
+  }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
@@ -148,6 +186,8 @@ class PARQUET_EXPORT ReaderProperties {
   bool page_checksum_verification_ = false;
   // Used with a RecordReader.
   bool read_dense_for_nullable_ = false;
+  bool lazy_metadata_ = false;
+  int32_t page_decompression_readahead_ = 0;
   size_t footer_read_size_ = kDefaultFooterReadSize;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
@@ -159,12 +199,15 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES =
+    std::numeric_limits<int64_t>::max();
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::UNKNOWN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = true;
+static constexpr bool DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED = false;
 static constexpr SizeStatisticsLevel DEFAULT_SIZE_STATISTICS_LEVEL =
     SizeStatisticsLevel::PageAndColumnChunk;
 
@@ -175,13 +218,15 @@ class PARQUET_EXPORT ColumnProperties {
                    bool dictionary_enabled = DEFAULT_IS_DICTIONARY_ENABLED,
                    bool statistics_enabled = DEFAULT_ARE_STATISTICS_ENABLED,
                    size_t max_stats_size = DEFAULT_MAX_STATISTICS_SIZE,
-                   bool page_index_enabled = DEFAULT_IS_PAGE_INDEX_ENABLED)
+                   bool page_index_enabled = DEFAULT_IS_PAGE_INDEX_ENABLED,
+                   bool adaptive_encoding_enabled = DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED)
       : encoding_(encoding),
         codec_(codec),
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        page_index_enabled_(page_index_enabled) {}
+        page_index_enabled_(page_index_enabled),
+        adaptive_encoding_enabled_(adaptive_encoding_enabled) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -214,6 +259,10 @@ class PARQUET_EXPORT ColumnProperties {
     page_index_enabled_ = page_index_enabled;
   }
 
+  void set_adaptive_encoding_enabled(bool adaptive_encoding_enabled) {
+    adaptive_encoding_enabled_ = adaptive_encoding_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -235,6 +284,8 @@ class PARQUET_EXPORT ColumnProperties {
 
   bool page_index_enabled() const { return page_index_enabled_; }
 
+  bool adaptive_encoding_enabled() const { return adaptive_encoding_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -243,6 +294,7 @@ class PARQUET_EXPORT ColumnProperties {
   size_t max_stats_size_;
   std::shared_ptr<CodecOptions> codec_options_;
   bool page_index_enabled_;
+  bool adaptive_encoding_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -254,19 +306,22 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_2_6),
           data_page_version_(ParquetDataPageVersion::V1),
           created_by_(DEFAULT_CREATED_BY),
           store_decimal_as_integer_(false),
           page_checksum_enabled_(false),
-          size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL) {}
+          size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL),
+          adaptive_encoding_policy_(AdaptiveEncodingPolicy::Smallest) {}
 
     explicit Builder(const WriterProperties& properties)
         : pool_(properties.memory_pool()),
           dictionary_pagesize_limit_(properties.dictionary_pagesize_limit()),
           write_batch_size_(properties.write_batch_size()),
           max_row_group_length_(properties.max_row_group_length()),
+          max_row_group_bytes_(properties.max_row_group_bytes()),
           pagesize_(properties.data_pagesize()),
           version_(properties.version()),
           data_page_version_(properties.data_page_version()),
@@ -274,6 +329,7 @@ class PARQUET_EXPORT WriterProperties {
           store_decimal_as_integer_(properties.store_decimal_as_integer()),
           page_checksum_enabled_(properties.page_checksum_enabled()),
           size_statistics_level_(properties.size_statistics_level()),
+          adaptive_encoding_policy_(properties.adaptive_encoding_policy()),
           sorting_columns_(properties.sorting_columns()),
           default_column_properties_(properties.default_column_properties()) {}
 
@@ -345,8 +401,29 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Specify the target size in bytes of a single row group.
+    ///
+    /// When writing record batches, the Arrow writer estimates the compressed
+    /// size of the data as it is appended and starts a new row group once this
+    /// size is reached, so a row group may end up with fewer rows than
+    /// max_row_group_length. The size is an estimate: a row group may exceed it
+    /// by up to one write batch.
+    ///
+    /// FileWriter::WriteTable writes row groups column by column, so it splits
+    /// the table upfront by its in-memory size instead. With compression or
+    /// efficient encodings, the resulting row groups are smaller than this
+    /// size. Default unlimited.
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     /// Specify the data page size.
-    /// Default 1MB.
+    ///
+    /// Pages are closed once the estimated encoded size of their values
+    /// reaches this size. Values of variable length are written in batches
+    /// small enough for a page not to exceed it by much, even when
+    /// write_batch_size values would be larger than a page. Default 1MB.
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
@@ -418,6 +495,63 @@ class PARQUET_EXPORT WriterProperties {
       return this->encoding(path->ToDotString(), encoding_type);
     }
 
+    /// \brief Let the writer choose the encoding of every column. Default disabled.
+    ///
+    /// The first data page of each column chunk is encoded with all the
+    /// encodings applicable to the column's physical type: PLAIN,
+    /// RLE_DICTIONARY (unless dictionary encoding is disabled),
+    /// DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY,
+    /// BYTE_STREAM_SPLIT and RLE for booleans. Each result is compressed with
+    /// the column's codec, and the encoding chosen by the adaptive encoding
+    /// policy is used for the rest of the column chunk. Only PLAIN and
+    /// dictionary encoding are tried with PARQUET_1_0.
+    ///
+    /// This overrides the encoding specified with encoding(). The choice is
+    /// recorded in the column chunk metadata like any other encoding.
+    Builder* enable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(true);
+      return this;
+    }
+
+    /// Disable adaptive encoding in general for all columns. Default disabled.
+    Builder* disable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(false);
+      return this;
+    }
+
+    /// Enable adaptive encoding for the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = true;
+      return this;
+    }
+
+    /// Enable adaptive encoding for the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_adaptive_encoding(path->ToDotString());
+    }
+
+    /// Disable adaptive encoding for the column specified by `path`.
+    /// Default disabled.
+    Builder* disable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = false;
+      return this;
+    }
+
+    /// Disable adaptive encoding for the column specified by `path`.
+    /// Default disabled.
+    Builder* disable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_encoding(path->ToDotString());
+    }
+
+    /// Specify how columns with adaptive encoding choose their encoding.
+    /// Default AdaptiveEncodingPolicy::Smallest.
+    Builder* adaptive_encoding_policy(AdaptiveEncodingPolicy policy) {
+      adaptive_encoding_policy_ = policy;
+      return this;
+    }
+
     /// Specify compression codec in general for all columns.
     /// Default UNCOMPRESSED.
     Builder* compression(Compression::type codec) {
@@ -695,13 +829,16 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_statistics_enabled(item.second);
       for (const auto& item : page_index_enabled_)
         get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : adaptive_encoding_enabled_)
+        get(item.first).set_adaptive_encoding_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, page_checksum_enabled_,
-          size_statistics_level_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_,
-          store_decimal_as_integer_, std::move(sorting_columns_)));
+          max_row_group_bytes_, pagesize_, version_, created_by_, page_checksum_enabled_,
+          size_statistics_level_, adaptive_encoding_policy_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties, data_page_version_, store_decimal_as_integer_,
+          std::move(sorting_columns_)));
     }
 
    private:
@@ -709,6 +846,7 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
@@ -716,6 +854,7 @@ class PARQUET_EXPORT WriterProperties {
     bool store_decimal_as_integer_;
     bool page_checksum_enabled_;
     SizeStatisticsLevel size_statistics_level_;
+    AdaptiveEncodingPolicy adaptive_encoding_policy_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -730,6 +869,7 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
     std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, bool> adaptive_encoding_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -740,6 +880,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetDataPageVersion data_page_version() const {
@@ -758,6 +900,10 @@ class PARQUET_EXPORT WriterProperties {
     return size_statistics_level_;
   }
 
+  inline AdaptiveEncodingPolicy adaptive_encoding_policy() const {
+    return adaptive_encoding_policy_;
+  }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -816,6 +962,10 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).page_index_enabled();
   }
 
+  bool adaptive_encoding_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_enabled();
+  }
+
   bool page_index_enabled() const {
     if (default_column_properties_.page_index_enabled()) {
       return true;
@@ -849,9 +999,11 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
+      int64_t max_row_group_length, int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version,
       const std::string& created_by, bool page_write_checksum_enabled,
       SizeStatisticsLevel size_statistics_level,
+      AdaptiveEncodingPolicy adaptive_encoding_policy,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
@@ -861,6 +1013,7 @@ class PARQUET_EXPORT WriterProperties {
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
@@ -868,6 +1021,7 @@ class PARQUET_EXPORT WriterProperties {
         store_decimal_as_integer_(store_short_decimal_as_integer),
         page_checksum_enabled_(page_write_checksum_enabled),
         size_statistics_level_(size_statistics_level),
+        adaptive_encoding_policy_(adaptive_encoding_policy),
         file_encryption_properties_(file_encryption_properties),
         sorting_columns_(std::move(sorting_columns)),
         default_column_properties_(default_column_properties),
@@ -877,6 +1031,7 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
@@ -884,6 +1039,7 @@ class PARQUET_EXPORT WriterProperties {
   bool store_decimal_as_integer_;
   bool page_checksum_enabled_;
   SizeStatisticsLevel size_statistics_level_;
+  AdaptiveEncodingPolicy adaptive_encoding_policy_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -910,8 +1066,11 @@ class PARQUET_EXPORT ArrowReaderProperties {
       : use_threads_(use_threads),
         read_dict_indices_(),
         batch_size_(kArrowDefaultBatchSize),
+        binary_type_(::arrow::Type::BINARY),
         pre_buffer_(true),
         cache_options_(::arrow::io::CacheOptions::LazyDefaults()),
+        pre_buffer_readahead_row_groups_(0),
+        pre_buffer_readahead_bytes_(0),
         coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO),
         arrow_extensions_enabled_(false),
         should_load_statistics_(false) {}
@@ -955,6 +1114,17 @@ class PARQUET_EXPORT ArrowReaderProperties {
   /// Note that some APIs such as ReadTable may ignore this setting.
   int64_t batch_size() const { return batch_size_; }
 
+  /// \brief Set the Arrow binary type to read BYTE_ARRAY columns as, unless
+  /// the serialized Arrow schema says otherwise.
+  ///
+  /// One of BINARY (default), LARGE_BINARY or BINARY_VIEW. Columns annotated as
+  /// strings are read as the corresponding string type. With BINARY_VIEW, values
+  /// reference the decompressed pages and dictionaries instead of being copied,
+  /// which keeps those buffers alive as long as the arrays that were read.
+  void set_binary_type(::arrow::Type::type binary_type) { binary_type_ = binary_type; }
+  /// Return the Arrow binary type to read BYTE_ARRAY columns as.
+  ::arrow::Type::type binary_type() const { return binary_type_; }
+
   /// Enable read coalescing (default false).
   ///
   /// When enabled, the Arrow reader will pre-buffer necessary regions
@@ -970,6 +1140,34 @@ class PARQUET_EXPORT ArrowReaderProperties {
   /// Return the options for read coalescing.
   const ::arrow::io::CacheOptions& cache_options() const { return cache_options_; }
 
+  /// \brief Set the number of row groups to pre-buffer ahead of the one being
+  /// decoded by GetRecordBatchReader().
+  ///
+  /// By default (0), pre-buffering covers all the requested row groups up front,
+  /// and keeps them in memory until the reader is done. When positive, only the
+  /// row groups of the current batch and up to this many after them are buffered,
+  /// and each row group is released once decoded. Their I/O then overlaps with
+  /// decoding while memory usage stays bounded. Only used if pre_buffer() is
+  /// enabled.
+  void set_pre_buffer_readahead_row_groups(int64_t readahead) {
+    pre_buffer_readahead_row_groups_ = readahead;
+  }
+  /// Return the number of row groups pre-buffered ahead of the current one.
+  int64_t pre_buffer_readahead_row_groups() const {
+    return pre_buffer_readahead_row_groups_;
+  }
+
+  /// \brief Set a limit on the compressed size of the row groups pre-buffered
+  /// ahead of the current batch by GetRecordBatchReader().
+  ///
+  /// At least one row group is always buffered ahead. 0 (the default) means no
+  /// limit. Only used if pre_buffer_readahead_row_groups() is positive.
+  void set_pre_buffer_readahead_bytes(int64_t readahead_bytes) {
+    pre_buffer_readahead_bytes_ = readahead_bytes;
+  }
+  /// Return the limit on the size of the row groups pre-buffered ahead.
+  int64_t pre_buffer_readahead_bytes() const { return pre_buffer_readahead_bytes_; }
+
   /// Set execution context for read coalescing.
   void set_io_context(const ::arrow::io::IOContext& ctx) { io_context_ = ctx; }
   /// Return the execution context used for read coalescing.
@@ -1010,9 +1208,12 @@ class PARQUET_EXPORT ArrowReaderProperties {
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
   int64_t batch_size_;
+  ::arrow::Type::type binary_type_;
   bool pre_buffer_;
   ::arrow::io::IOContext io_context_;
   ::arrow::io::CacheOptions cache_options_;
+  int64_t pre_buffer_readahead_row_groups_;
+  int64_t pre_buffer_readahead_bytes_;
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
   bool arrow_extensions_enabled_;
   bool should_load_statistics_;
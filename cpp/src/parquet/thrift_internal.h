@@ -451,6 +451,29 @@ class ThriftDeserializer {
     }
   }
 
+  // Deserialize an unencrypted thrift message from buf/len, like
+  // DeserializeMessage(), but with a protocol derived from the compact protocol.
+  // The protocol is constructed from the memory transport, the size limits and
+  // `protocol_args`, which allows it to customize how some structs are read.
+  template <class Protocol, class T, typename... ProtocolArgs>
+  void DeserializeUnencryptedMessageWithProtocol(const uint8_t* buf, uint32_t* len,
+                                                 T* deserialized_msg,
+                                                 ProtocolArgs&&... protocol_args) {
+    // Deserialize msg bytes into c++ thrift msg using memory transport.
+    auto tmem_transport = CreateReadOnlyMemoryBuffer(const_cast<uint8_t*>(buf), *len);
+    Protocol tproto(tmem_transport, string_size_limit_, container_size_limit_,
+                    std::forward<ProtocolArgs>(protocol_args)...);
+    try {
+      deserialized_msg->template read<Protocol>(&tproto);
+    } catch (std::exception& e) {
+      std::stringstream ss;
+      ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+      throw ParquetException(ss.str());
+    }
+    uint32_t bytes_left = tmem_transport->available_read();
+    *len = *len - bytes_left;
+  }
+
  private:
   // On Thrift 0.14.0+, we want to use TConfiguration to raise the max message size
   // limit (ARROW-13655).  If we wanted to protect against huge messages, we could
@@ -468,21 +491,9 @@ class ThriftDeserializer {
   template <class T>
   void DeserializeUnencryptedMessage(const uint8_t* buf, uint32_t* len,
                                      T* deserialized_msg) {
-    // Deserialize msg bytes into c++ thrift msg using memory transport.
-    auto tmem_transport = CreateReadOnlyMemoryBuffer(const_cast<uint8_t*>(buf), *len);
-    auto tproto = apache::thrift::protocol::TCompactProtocolT<ThriftBuffer>(
-        tmem_transport, string_size_limit_, container_size_limit_);
-    try {
-      deserialized_msg
-          ->template read<apache::thrift::protocol::TCompactProtocolT<ThriftBuffer>>(
-              &tproto);
-    } catch (std::exception& e) {
-      std::stringstream ss;
-      ss << "Couldn't deserialize thrift: " << e.what() << "\n";
-      throw ParquetException(ss.str());
-    }
-    uint32_t bytes_left = tmem_transport->available_read();
-    *len = *len - bytes_left;
+    DeserializeUnencryptedMessageWithProtocol<
+        apache::thrift::protocol::TCompactProtocolT<ThriftBuffer>>(buf, len,
+                                                                   deserialized_msg);
   }
 
   const int32_t string_size_limit_;